@@ -33,6 +33,12 @@ classdef Experiment < dynamicprops
 
  end	% public properties
 
+ properties ( Hidden )
+
+  Derived									% DerivedCache of Q, Phi ... of the points
+
+ end
+
  %============================================================================
  % DEPENDENT PROPERTIES
  %============================================================================
@@ -73,6 +79,7 @@ classdef Experiment < dynamicprops
    self.Unit_T		= point(1).Unit_T;
 
    self.Point		= point;						% import the point classes as props
+   self.Derived		= DerivedCache;
 
   end	% constructor
 
@@ -83,12 +90,28 @@ classdef Experiment < dynamicprops
   %============================================================================
   % GET METHODS FOR DEPENDENT PROPERTIES
   %============================================================================
+  function d = derived ( self )
+  % Q, Phi of all points (vectors, see DerivedCache), evaluated
+  % again only if n, Angle, C or the instrument of a point changed
+   if isempty(self.Derived)
+    self.Derived	= DerivedCache;
+   end
+   d	= self.Derived.update( self.Point );
+  end
+
+  function set.Point ( self, point )
+  % another point array: a new cache
+   self.Point	= point;
+   self.Derived	= DerivedCache;
+  end
+
   function C = get.C ( self )
    C	= unique( [ self.Point.C ] );
   end
 
   function Phi = get.Phi ( self )
-   Phi	= unique( [ self.Point.Phi ] );
+   d	= self.derived();
+   Phi	= unique( d.Phi );
   end
 
   function Cs = get.Cs ( self )
@@ -100,7 +123,8 @@ classdef Experiment < dynamicprops
   end
 
   function Q = get.Q ( self )
-   Q	= unique( [ self.Point.Q ] );
+   d	= self.derived();
+   Q	= unique( d.Q );
   end
 
   function T = get.T ( self )
@@ -126,6 +150,11 @@ classdef Experiment < dynamicprops
    end
   end
 
+  function res = cumulants ( self, varargin )
+  % closed-form cumulant analysis of all points at once, see DLS.cumulants
+   res	= DLS.cumulants( self.Point, varargin{:} );
+  end
+
   function cn = coeffnames ( self, method )
    cn	= coeffnames(self.Point(1).(['Fit_' method]));
   end
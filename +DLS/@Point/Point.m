@@ -21,6 +21,8 @@ properties
     G
     dG
 
+    Rebin                   % points per decade of the fits and of CONTIN ([]: all lags for the fits, 12 for CONTIN)
+
 end
 
 properties ( Dependent, SetAccess = private )
@@ -47,6 +49,16 @@ properties ( Hidden )
     datetime
     datetime_raw
 
+end
+
+properties ( Hidden )
+
+    source = '';        % autosave file of a lazily loaded point (read_dynamic_headers)
+    loaded = true;      % false until Tau, G, dG are read from source
+    channels = 1;       % channel(s) read from source (see read_dynamic_series)
+    stamp  = 0;         % last access (tic), for the LRU of DLS.lazy_cache
+    cache_key = 0;      % key of the point in DLS.lazy_cache (0: never loaded)
+
 end
 
  % VARIOUS METHODS
@@ -57,14 +69,68 @@ methods
         Phi = self.C * v0;
     end
 
+    % lazy points read their correlogram on first access; once resident an
+    % access only stamps the point (no call of DLS.lazy_cache)
+    function Tau = get.Tau ( self )
+        if ~isempty(self.source)
+            self.materialize();
+        end
+        Tau = self.Tau;
+    end
+    function G = get.G ( self )
+        if ~isempty(self.source)
+            self.materialize();
+        end
+        G = self.G;
+    end
+    function dG = get.dG ( self )
+        if ~isempty(self.source)
+            self.materialize();
+        end
+        dG = self.dG;
+    end
+
+    function materialize ( self )
+    % read (normalized, cropped) Tau, G, dG of a lazy point from its file and
+    % register it in DLS.lazy_cache. N.B.: must not read Tau, G or dG itself
+        if ~self.loaded
+            [tau g dg angle T datetime norm] = self.Instrument.read_dynamic_series_fast( {self.source}, [], ...
+                {}, self.channels );
+            self.Tau      = tau;
+            self.G        = g;
+            self.dG       = dg;
+            self.norm_raw = norm;
+            self.loaded   = true;
+            DLS.lazy_cache('add', self, 8 * ( numel(tau) + numel(g) + numel(dg) ));
+        else
+            self.stamp    = tic;
+        end
+    end
+    function unload ( self )
+    % free the correlogram of a lazy point, read again on the next access
+        if ~isempty(self.source)
+            self.Tau    = [];
+            self.G      = [];
+            self.dG     = [];
+            self.loaded = false;
+        end
+    end
+
+    function check_raw ( self )
+    % the 'fast', 'lazy' and 'autosave' loaders keep only the normalized data
+        if isempty(self.G_raw)
+            error('DLS:Point:noRaw', ['No raw correlogram: the point was read with the ''fast'', ' ...
+                '''lazy'' or ''autosave'' loader; read the sample with ''Loader'', ''matlab'' for fit_raw and correct_G.']);
+        end
+    end
+
     function Q = get.Q ( self )
-        Qexp = '4 * pi * n * sind( 0.5 * theta ) / lambda';
-        Qf   = inline(Qexp,'n','theta','lambda');
-        Q    = Qf( self.n, self.Angle, self.Instrument.Lambda );
+        Q    = DerivedCache.q( self.n, self.Angle, self.Instrument.Lambda );
     end
 
     function correct_G ( self )
 
+        self.check_raw();
         i    = ( self.Tau_raw < 1e-4 & self.Tau_raw > 1e-5);            % limit time: 10 ns
         norm = abs(mean( self.G_raw( i ) ));
 
@@ -82,9 +148,9 @@ end
  % STATIC METHODS
 methods ( Static )
 
-    fit_obj   = fit_discrete ( t, g, dg, method, q, protein);
+    [ fit_obj output ] = fit_discrete ( t, g, dg, method, q, protein, start);
     fit_obj   = fit_discrete_raw ( t, g, dg, method, q, protein);
-    [s, g, b] = contin  ( t, y, var, s0, s1, m, alpha, kernel);
+    [s, g, b, g_lo, g_hi, G_rep] = contin  ( t, y, var, s0, s1, m, alpha, kernel, n_rep, seed, mode);
     [ s g ]   = contin2 ( t, gt, dg, smin, smax, m, alpha, cycles );
 
 end
@@ -92,20 +158,66 @@ end
  % FIT METHODS
 methods
 
-    function fit ( self, method )
-
-        fit_obj	= self.fit_discrete ( self.Tau, self.G, self.dG, method, self.Q, self.Protein );
+    function output = fit ( self, method, start )
+    % optional: start, start point of the coefficients (warm start)
+        if nargin < 3
+            start = [];
+        end
+        [ t g dg ] = DLS.concat_points( self );
+        [ fit_obj output ] = self.fit_discrete ( t, g, dg, method, self.Q, self.Protein, start );
         try self.addprop(['Fit_' method]);	end
         self.(['Fit_' method])	= fit_obj;
     end
     function fit_raw ( self, method )
+        self.check_raw();
         fit_obj	= self.fit_discrete_raw ( self.Tau_raw, self.G_raw, self.dG_raw, method, self.Q, self.Protein );
 
         try self.addprop(['Fit_' method]);	end
         self.(['Fit_' method])	= fit_obj;
     end
 
-    function invert_laplace ( self )
+    function bootstrap ( self, method, n_rep, seed, mode )
+    % bootstrap errors of the native fit (DLS.bootstrap) of this point, stored as
+    % Bootstrap_<method> with the coefficients named as in fit_discrete (Gammas
+    % in ms^-1). optional: n_rep (default 500), seed (default 0),
+    % mode ('bootstrap' (default) or 'jackknife')
+        if nargin < 3, n_rep = [];          end
+        if nargin < 4, seed  = 0;           end
+        if nargin < 5, mode  = 'bootstrap'; end
+        res   = DLS.bootstrap( self, method, n_rep, seed, mode );
+        gf    = 1e6 * self.Q^2;        % D [A^2/ns] -> Gamma [ms^-1]
+        names = regexprep( res.Global, '^D', 'Gamma' );
+        L     = length( res.Local );
+        b.Method     = method;
+        b.Mode       = mode;
+        b.Seed       = seed;
+        b.Coeffnames = [ res.Local names ];
+        b.Values     = [ res.Values' gf * res.D       ];
+        b.Lower      = [ res.Lower' gf * res.D_Lower ];
+        b.Upper      = [ res.Upper' gf * res.D_Upper ];
+        b.SE         = [ res.SE'    gf * res.D_SE    ];
+        b.Replicates = res.Replicates;
+        b.Replicates(L+1:end,:) = gf * b.Replicates(L+1:end,:);
+        b.Info       = res.Info;
+        try self.addprop(['Bootstrap_' method]);	end
+        self.(['Bootstrap_' method]) = b;
+    end
+    function err = bootstrap_error ( self, method, parameter )
+    % half width of the 95% bootstrap interval of a coefficient, NaN if the point
+    % has not been bootstrapped with this method
+        err = NaN;
+        if isprop( self, ['Bootstrap_' method] )
+            b   = self.(['Bootstrap_' method]);
+            ind = strcmp( b.Coeffnames, parameter );
+            if any(ind)
+                err = ( b.Upper(ind) - b.Lower(ind) ) * 0.5;
+            end
+        end
+    end
+
+    function invert_laplace ( self, n_rep, seed, mode )
+    % optional: n_rep, seed, mode (0 bootstrap, 1 jackknife) -> 95% intervals
+    % Gs_lo, Gs_hi of the distribution from n_rep resampled inversions
 
    % PART 1: FILTER THE DATA
         ind = ( self.Tau > 1e-3 & self.Tau < 50 & self.G > 0 );
@@ -113,32 +225,67 @@ methods
         G   = self.G(ind);
         dG  = self.dG(ind);
 
-   % PART 2: REDUCE THE DATA
-        l       = length(Tau);
-        N       = 10;
-        lN      = floor(l/N);
-        closeto = 5;
-
-        for i = 1 : N
-            ind    = [ lN * (i-1) + 1 : lN * (i -1 ) + closeto ];
-            t(i)   = mean( Tau(ind) );
-            gt(i)  = mean( G(ind) );
-            dgt(i) = mean( dG(ind) );
+   % PART 2: REDUCE THE DATA: log-spaced bins, inverse-variance means (rebin_fast)
+        per_decade = self.Rebin;
+        if isempty(per_decade)
+            per_decade = 12;
         end
+        [ t gt dgt ] = DLS.rebin_fast( Tau, G, dG, [ 0 length(Tau) ], per_decade );
+        t   = t';
+        gt  = gt';
+        dgt = dgt';
+        M   = 100;              % grid of the distribution
 
         y  = sqrt(gt);
         dy = 0.5 ./ y .* dgt;
 
         % PART 3: PERFORM INVERSE LAPLACE TRANSFORM
-        %  s = self.contin2(t, y, dy, min(t), max(t), 15*N, 0.1, 1); %%% output controllare !!!
-        [ s, gs, bs ]= self.contin(t, y, dy, min(t), max(t), 10*N, 0.15, 0);
+        %  s = self.contin2(t, y, dy, min(t), max(t), 1.5*M, 0.1, 1); %%% output controllare !!!
+        if nargin > 1
+            if nargin < 3, seed = 0; end
+            if nargin < 4, mode = 0; end
+            [ s, gs, bs, gs_lo, gs_hi, gs_rep ] = self.contin(t, y, dy, min(t), max(t), M, 0.15, 0, n_rep, seed, mode);
+        else
+            [ s, gs, bs ]= self.contin(t, y, dy, min(t), max(t), M, 0.15, 0);
+        end
         D = 1e-6 ./ ( self.Q^2 * s );
 
         try   self.addprop('CONTIN'); end % maybe it is already a property
         self.CONTIN.S  = s;
         self.CONTIN.D  = D;
         self.CONTIN.Gs = gs;
+        if nargin > 1
+            self.CONTIN.Gs_lo  = gs_lo;
+            self.CONTIN.Gs_hi  = gs_hi;
+            self.CONTIN.Gs_rep = gs_rep;
+        end
     end
 end
 
+methods
+
+    % inputs of the vectors of DerivedCache: count every change
+    function set.n ( self, n )
+        self.n = n;
+        DerivedCache.changed();
+    end
+    function set.Angle ( self, Angle )
+        self.Angle = Angle;
+        DerivedCache.changed();
+    end
+    function set.C ( self, C )
+        self.C = C;
+        DerivedCache.changed();
+    end
+    function set.Protein ( self, Protein )
+        self.Protein = Protein;
+        DerivedCache.changed();
+    end
+    function set.Instrument ( self, Instrument )
+        self.Instrument = Instrument;
+        DerivedCache.changed();
+    end
+
+end
+
 end % end of Point class definition
@@ -1,9 +1,12 @@
 %============================================================================
 % FIT CORRELOGRAMMS USING DISCRETE DECAYS
 %============================================================================
-function fit_obj = fit_discrete ( t, g, dg, method, q, protein)
+function [ fit_obj output ] = fit_discrete ( t, g, dg, method, q, protein, start)
 % take correlogramm and Q-vector as input and return values of fit coefficient as output
 % the fit is limited to discrete discrete times
+% optional: start, start point for the coefficients (e.g. the result of a previous
+% fit); it replaces the default startpoint and is moved inside the bounds.
+% output is the output struct of fit (funcCount, iterations, exitflag ...)
     Min_D1       = 0.5;           % A^2 / ns
     Max_D1       = 100;           % A^2 / ns
     Start_D1     = 6;             % A^2 / ns
@@ -135,6 +138,9 @@ function fit_obj = fit_discrete ( t, g, dg, method, q, protein)
     otherwise
         error('Method not recognized!');
     end
+    if nargin > 6 && ~isempty(start) && exist('startpoint', 'var') && length(start) == length(startpoint)
+        startpoint = min( max( start(:)', lowerbond ), upperbond );   % warm start
+    end
     %==  PART 2: perform the fit ==
     switch method         % depending on the method chosen, perform the fit
     case 'Cumulants'
@@ -147,7 +153,7 @@ function fit_obj = fit_discrete ( t, g, dg, method, q, protein)
                 'dependent'   , 'logg1'          , ...
                 'independent' , 't'    , ...
                 'options', fit_options  ); % a linear model is ok
-        fit_obj = fit( t, yc, fit_type );
+        [ fit_obj gof output ] = fit( t, yc, fit_type );
     otherwise
         weights =  1 ./ dg .^ 2;     % set the weights for the fit
         % set other fit options
@@ -165,6 +171,6 @@ function fit_obj = fit_discrete ( t, g, dg, method, q, protein)
         %        first decay time. If there is still something important, do not fit
         %        the data and impose NaN for both Gamma and dGamma. One can not live with
         %        scorpions is his bed!
-        fit_obj = fit( t, g, fit_type );
+        [ fit_obj gof output ] = fit( t, g, fit_type );
     end
 end % fit_discrete
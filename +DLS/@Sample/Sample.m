@@ -35,6 +35,7 @@ properties ( Hidden)
     number_of_counts
     start_index
     end_index
+    Derived         % DerivedCache of Q, Phi of the points (a handle: shared by copies)
 
 end
 
@@ -43,6 +44,7 @@ methods
     %constructor
     function self = Sample( varargin )
         a = Args(varargin{:});% get  the args
+        self.Derived = DerivedCache;
         try self.Instrument = Instruments.(a.Instrument); % get the instrument
         catch err; error('Instrument not found!');
         end
@@ -63,52 +65,124 @@ methods
         else
             filegroup_index = 1;
         end
-        [s_array e_array nc_array] = self.Instrument.find_start_end( self.raw_data_path );
-        s = s_array(filegroup_index);
-        e = e_array(filegroup_index);
-        nc = nc_array(filegroup_index);
-        if any(strcmp('start_index', properties(a))) && a.start_index > 0
-            s = a.start_index;
-        end
-        if any(strcmp('end_index', properties(a))) &&a.end_index > 0
-            e = a.end_index;
-        end
-        if any(strcmp('number_of_counts', properties(a))) && a.number_of_counts > 0
-            nc = a.number_of_counts;
-        end
-        self.Point = DLS.Point;
-        disp(['load: ' self.raw_data_path '[' num2str(s, '%4.4u') ':' num2str(e, '%4.4u') ']' ]);
-        self.Point = DLS.Point;
-        counter = 0;
-        for i = s : e
-            flag = true;
-            i_c = 1;
-            while flag
-                counter = counter + 1;
-                file = self.Instrument.generate_filename(self.raw_data_path, i, i_c);
-                % self.Point(counter) = self.Instrument.invoke_read_dynamic_file_fast( file );
-                self.Point(counter) = self.Instrument.read_dynamic_file(file);
-                % condition here used to simulate behavior of do - while loop of C.
-                if i_c >= nc
-                    flag = false;
-                else
-                    i_c = i_c + 1;
+        if ismethod(self.Instrument, 'read_dynamic_table')
+            % instruments exporting all correlograms in one table (Malvern):
+            % start_index / end_index select the records
+            self.Point = self.Instrument.read_dynamic_table(self.raw_data_path);
+            s  = 1;
+            e  = length(self.Point);
+            nc = 1;
+            if any(strcmp('start_index', properties(a))) && a.start_index > 0
+                s = a.start_index;
+            end
+            if any(strcmp('end_index', properties(a))) && a.end_index > 0
+                e = a.end_index;
+            end
+            self.Point = self.Point(s : e);
+            disp(['load: ' self.raw_data_path '[' num2str(s) ':' num2str(e) ']' ]);
+            % temperature of the sample if not in the export
+            for i = find(isnan([self.Point.T]))
+                self.Point(i).T = self.T;
+            end
+        else
+            given = @(name) any(strcmp(name, properties(a))) && a.(name) > 0;
+            if ~( given('start_index') && given('end_index') && given('number_of_counts') )
+                [s_array e_array nc_array] = self.Instrument.find_start_end( self.raw_data_path );
+                s = s_array(filegroup_index);
+                e = e_array(filegroup_index);
+                nc = nc_array(filegroup_index);
+            end
+            if given('start_index')
+                s = a.start_index;
+            end
+            if given('end_index')
+                e = a.end_index;
+            end
+            if given('number_of_counts')
+                nc = a.number_of_counts;
+            end
+            % loader: 'matlab' (default, keeps the raw data) or 'fast' (the whole
+            % series at once, normalized and cropped natively, no raw data)
+            loader = 'matlab';
+            if any(strcmp('Loader', properties(a)))
+                loader = a.Loader;
+            end
+            % lazy: only the headers are read, the correlograms on first access
+            % (optional 'Budget' in MB for all lazy points, see DLS.lazy_cache)
+            if any(strcmp('Lazy', properties(a))) && a.Lazy
+                loader = 'lazy';
+            end
+            if any(strcmp('Budget', properties(a)))
+                DLS.lazy_cache('budget', a.Budget);
+            end
+            % channels: correlation channel (1 to 4) or the channels combined
+            % ('weighted', 'all', 'best', see DLS.combine_channels), read natively
+            channels = 1;
+            if any(strcmp('Channels', properties(a)))
+                channels = a.Channels;
+                if strcmp(loader, 'matlab')
+                    loader = 'fast';
                 end
             end
+            % autosave: data of a shared parse of the same files with the static
+            % data (Instruments.ALVBASE.read_autosave_series, see load_autosave)
+            if any(strcmp('Autosave', properties(a))) && ~isempty(a.Autosave)
+                loader = 'autosave';
+            end
+            disp(['load: ' self.raw_data_path '[' num2str(s, '%4.4u') ':' num2str(e, '%4.4u') ']' ]);
+            self.Point = DLS.Point;
+            counter = 0;
+            files   = {};
+            for i = s : e
+                flag = true;
+                i_c = 1;
+                while flag
+                    counter = counter + 1;
+                    files{counter} = self.Instrument.generate_filename(self.raw_data_path, i, i_c);
+                    % condition here used to simulate behavior of do - while loop of C.
+                    if i_c >= nc
+                        flag = false;
+                    else
+                        i_c = i_c + 1;
+                    end
+                end
+            end
+            switch loader
+            case 'fast'
+                self.Point = self.Instrument.read_dynamic_series(files, channels);
+            case 'lazy'
+                self.Point = self.Instrument.read_dynamic_headers(files, channels);
+            case 'autosave'
+                if ~isequal(a.Autosave.Files(:), files(:))
+                    error('The autosave data do not match the files of the sample!');
+                end
+                self.Point = a.Autosave.Point;
+            case 'matlab'
+                for counter = 1 : length(files)
+                    % self.Point(counter) = self.Instrument.invoke_read_dynamic_file_fast( files{counter} );
+                    self.Point(counter) = self.Instrument.read_dynamic_file(files{counter});
+                end
+            otherwise
+                error('Loader not recognized!');
+            end
         end
         self.start_index = s;
         self.end_index = e;
         self.number_of_counts = nc;
         
-        regexpstr = Instruments.get_datetime_format(self.Point(1).datetime_raw);
-        if ~isempty(regexpstr)
+        % all date / time strings in one native pass (the fast loader has already
+        % parsed them)
+        if all(arrayfun(@(p) isscalar(p.datetime), self.Point))
+            datetime = horzcat(self.Point.datetime);
+        else
+            datetime = Instruments.parse_datetime({self.Point.datetime_raw});
             for i = 1 : length(self.Point)
-                self.Point(i).datetime = datenum(self.Point(i).datetime_raw, regexpstr);
+                self.Point(i).datetime = datetime(i);
             end
-            datetime_bool = true;
-        else
-            warning('datetime format not found, please add to +Instruments/get_datetime_format the right regexp')
-            datetime_bool = false;
+        end
+        datetime_bool = ~all(isnan(datetime));
+        if ~datetime_bool
+            warning('datetime format not found, please register it with Instruments.datetime_formats(''add'', format)')
         end
         pointprops	= {'Protein','Salt',...
                     'C' , 'C_set'    , ...
@@ -120,6 +194,10 @@ methods
         if datetime_bool
             self.datetime = mean(horzcat(self.Point(1:end).datetime));
         end
+        % rebin: points per decade of the fits and of CONTIN (DLS.concat_points)
+        if any(strcmp('Rebin', properties(a)))
+            [ self.Point.Rebin ] = deal(a.Rebin);
+        end
     end
 
     function Angle= get.Angle ( self )
@@ -127,16 +205,35 @@ methods
     end
 
     function Q = get.Q ( self )
-        Q = unique([self.Point.Q]);
+        d = self.derived();
+        Q = unique(d.Q);
     end
     function Q = Qv ( self )
     % function which return full Q vector of the length of self.Point
-        Q = [self.Point.Q]';
+        d = self.derived();
+        Q = d.Q';
+    end
+    function d = derived ( self )
+    % Q, Phi of all points (vectors), evaluated again only if n, Angle, C or
+    % the instrument of a point changed
+        d = self.Derived;
+        if isempty(d)
+            d = DerivedCache;                   % saved before the cache existed
+        end
+        d = d.update(self.Point);
+    end
+    function self = set.Point ( self, point )
+    % another point array: a new cache (copies of the sample share the old one)
+        self.Point   = point;
+        self.Derived = DerivedCache;
     end
     function [fit_val, error_fit_val] = get_fit(self, method, parameter, varargin)
         % get_fit : function to retrieve fit values and errors of 95% confidence interval
-        % input : method (e.g. 'DoubleBKG') , parameter (e.g. 'Gamma1')
+        % input : method (e.g. 'DoubleBKG') , parameter (e.g. 'Gamma1'),
+        %         optional 'Bootstrap': take the errors from the bootstrap intervals
+        %         (see bootstrap), which are also used where confint is not defined
         fitmethod = ['Fit_' method];
+        use_boot  = any(strcmpi(varargin, 'Bootstrap'));
         len = length(self.Point);
         varnames  = coeffnames(self.Point(1).(fitmethod));
         ind       = strcmp(varnames, parameter);
@@ -149,6 +246,9 @@ methods
             fit_val(i)       = p.(parameter);
             errors           = confint(p);
             error_fit_val(i) = abs((errors(i_err+1) - errors(i_err))) * 0.5;
+            if use_boot || isnan(error_fit_val(i))
+                error_fit_val(i) = self.Point(i).bootstrap_error(method, parameter);
+            end
             if isnan(error_fit_val(i))
                 disp(['confidence value not defined at: ' num2str(i)])
                 error_fit_val(i) = fit_val(i);
@@ -160,6 +260,20 @@ end
 methods ( Access = private, Static )
 
     [ s e nc] = find_start_end ( path );
+    function n = fevals ( output )
+    % number of function evaluations reported by fit (0 for linear fits)
+        if isfield(output, 'funcCount')
+            n = output.funcCount;
+        else
+            n = 0;
+        end
+    end
+
+end
+
+methods ( Static )
+
+    [xg dxg xl dxl info] = fit_global_fast(t, g, dg, offset, q, model, lower, upper, start, options);
 
 end
 
@@ -171,17 +285,110 @@ methods
             self.Point(i).fit( model );
         end
     end
+    function stats = fit_warm ( self, model, compare )
+        % fit_warm : fit all points ordered by (angle, count), seeding every fit
+        % with the converged coefficients of its predecessor; the decay rates
+        % (coefficients Gamma*) are rescaled by q^2. If a warm started fit does
+        % not converge, the point is fitted again from the default startpoint.
+        % input : model, compare (optional, default false): fit first from the
+        %         default startpoints to measure the saving of function evaluations
+        % output: struct with the function evaluations per point (Warm, Cold), the
+        %         points fitted again from the default start (Fallback) and the
+        %         reduction of function evaluations in % (Reduction, NaN without compare)
+        if nargin < 3
+            compare = false;
+        end
+        n        = length( self.Point );
+        cold     = nan(n, 1);
+        if compare
+            for i = 1 : n
+                cold(i) = self.fevals( self.Point(i).fit( model ) );
+            end
+        end
+        [tmp order] = sortrows( [ [self.Point.Angle]' (1:n)' ] );
+        warm     = zeros(n, 1);
+        fallback = false(n, 1);
+        prev     = [];
+        for i = order'
+            p     = self.Point(i);
+            start = [];
+            if ~isempty(prev)
+                start = prev.cf;
+                isgamma = strncmp(prev.names, 'Gamma', 5);
+                start(isgamma) = start(isgamma) * ( p.Q / prev.q )^2;
+            end
+            output  = p.fit( model, start );
+            warm(i) = self.fevals( output );
+            if ~isempty(start) && isfield(output, 'exitflag') && output.exitflag <= 0
+                warm(i)     = warm(i) + self.fevals( p.fit( model ) );
+                fallback(i) = true;
+            end
+            fit_obj = p.(['Fit_' model]);
+            prev.cf    = coeffvalues( fit_obj );
+            prev.names = coeffnames( fit_obj )';
+            prev.q     = p.Q;
+        end
+        stats.Order    = order;
+        stats.Warm     = warm;
+        stats.Cold     = cold;
+        stats.Fallback = fallback;
+        stats.Reduction = 100 * ( 1 - sum(warm) / sum(cold) );
+    end
     function fit_raw ( self , model )
         for i = 1 : length( self.Point )
             self.Point(i).fit_raw( model );
         end
     end
-    function invert_laplace ( self )
+    function invert_laplace ( self, varargin )
+        % optional: n_rep, seed, mode -> bootstrap intervals of the distributions
         for i = 1 : length( self.Point )
             fprintf([num2str(i) ': ']);
-            self.Point(i).invert_laplace;
+            self.Point(i).invert_laplace( varargin{:} );
             fprintf('\n');
         end
     end
+    function res = cumulants ( self, varargin )
+        % cumulants : closed-form cumulant analysis of all points at once,
+        % see DLS.cumulants (optional arguments: order, min_g)
+        res = DLS.cumulants(self.Point, varargin{:});
+    end
+    function bootstrap ( self, method, n_rep, seed, mode )
+        % bootstrap : bootstrap (or jackknife) errors of the native fit of every
+        % point, see DLS.Point.bootstrap; point i uses the seed seed + i - 1.
+        % input : method ('Single', 'Double' or 'DoubleBKG'), optional n_rep
+        %         (default 500), seed (default 0), mode ('bootstrap' or 'jackknife')
+        if nargin < 3, n_rep = [];          end
+        if nargin < 4, seed  = 0;           end
+        if nargin < 5, mode  = 'bootstrap'; end
+        for i = 1 : length( self.Point )
+            self.Point(i).bootstrap( method, n_rep, seed + i - 1, mode );
+        end
+    end
+    function res = fit_global ( self, method, varargin )
+        % fit_global : fit all correlograms at once, sharing the diffusion
+        % coefficients (Gamma = D * q^2) between all points of the sample.
+        % amplitudes and baselines stay local to every correlogram.
+        % input : method ('Single', 'Double' or 'DoubleBKG'), optional options
+        %         vector [max_iter tol] passed to fit_global_fast
+        % output: struct with global D's [A^2/ns] and their 95% confidence half
+        %         widths, local parameters (one column per point), Gammas of every
+        %         point [ms^-1] and the fit info (iterations, timings ...)
+        [model localnames globalnames lowerbond upperbond startpoint] = DLS.global_model(method);
+        [t g dg offset] = DLS.concat_points(self.Point);
+        q      = self.Qv();
+        [xg dxg xl dxl info] = self.fit_global_fast(t, g, dg, offset, q, model, ...
+            lowerbond, upperbond, startpoint, varargin{:});
+        res.Method      = method;
+        res.Coeffnames  = [ localnames globalnames ];
+        res.Local       = localnames;
+        res.Global      = globalnames;
+        res.D           = xg';
+        res.dD          = dxg';
+        res.Unit_D      = 'A^2/ns';
+        res.Values      = xl;
+        res.dValues     = dxl;
+        res.Gamma       = 1e6 * q.^2 * xg';   % ms^{-1}, one row per point
+        res.Info        = info;
+    end
 end
 end
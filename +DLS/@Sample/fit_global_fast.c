@@ -0,0 +1,164 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  fit_global_fast.c
+ *
+ *    Description:  global (shared-parameter) fit of all correlograms of a DLS.Sample,
+ *                  matlab interface of the engine in libls/global_fit.c; with
+ *                  options(3) every correlogram is fitted on its own (gf_fit_each,
+ *                  DLS.Store.fit)
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/* check if calling from matlab and include necessary mex.h*/
+#ifdef MATLAB_MEX_FILE
+#include "mex.h"
+#endif
+
+#include "../../libls/ls.h"
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  mexFunction
+ *  Description:  comunicate between matlab and c program
+ *
+ *  [xg dxg xl dxl info] = fit_global_fast(t, g, dg, offset, q, model, lower, upper, start, options)
+ *
+ *  t, g, dg    : correlograms of all points, concatenated (column vectors)
+ *  offset      : (n_points + 1) 0-based start indices of every point in t, g, dg
+ *  q           : scattering vector of every point [A^-1]
+ *  model       : 0 Single, 1 Double, 2 DoubleBKG
+ *  lower, upper, start : bounds and start values (local parameters, then D's in A^2/ns)
+ *  options     : [max_iter tol separate] (optional); separate ~= 0: nothing is shared,
+ *                xg and dxg are (n_global x n_points), info.converged and info.stalled
+ *                count the points
+ * =====================================================================================
+ */
+#ifdef MATLAB_MEX_FILE
+void mexFunction(int nlhs,
+        mxArray *plhs[],
+        int nrhs,
+        const mxArray *prhs[])
+{
+    const char *info_fields[] = { "iterations", "fevals", "jevals", "converged", "stalled", "chi2",
+        "dof", "n_points", "n_data", "time_setup", "time_solve", "time_errors", "time_total" };
+    gf_problem p;
+    gf_info    info;
+    const double *dg, *q, *start, *off_d;
+    double *q2, *xl, *xg, *dxl, *dxg;
+    int *offset;
+    int i, a, n_data, L, G, max_iter = 1000, separate = 0;
+    double tol = 1e-10, t0;
+
+    LS_SPAN_BEGIN(t0);
+    if (nrhs < 9)
+        mexErrMsgTxt("usage: [xg dxg xl dxl info] = fit_global_fast(t, g, dg, offset, q, model, lower, upper, start, options)");
+    p.model    = (int) mxGetScalar(prhs[5]);
+    if (!gf_model_size(p.model, &L, &G))
+        mexErrMsgTxt("fit_global_fast: unknown model");
+    p.n_local  = L;
+    p.n_global = G;
+    p.n_points = (int) mxGetNumberOfElements(prhs[4]);
+    if ((int) mxGetNumberOfElements(prhs[3]) != p.n_points + 1)
+        mexErrMsgTxt("fit_global_fast: offset must have n_points + 1 elements");
+    if ((int) mxGetNumberOfElements(prhs[6]) != L + G ||
+        (int) mxGetNumberOfElements(prhs[7]) != L + G ||
+        (int) mxGetNumberOfElements(prhs[8]) != L + G)
+        mexErrMsgTxt("fit_global_fast: lower, upper and start must have one entry per parameter");
+    if (nrhs > 9 && mxGetNumberOfElements(prhs[9]) >= 1)
+        max_iter = (int) mxGetPr(prhs[9])[0];
+    if (nrhs > 9 && mxGetNumberOfElements(prhs[9]) >= 2)
+        tol = mxGetPr(prhs[9])[1];
+    if (nrhs > 9 && mxGetNumberOfElements(prhs[9]) >= 3)
+        separate = mxGetPr(prhs[9])[2] != 0;
+
+    n_data = (int) mxGetNumberOfElements(prhs[0]);
+    if ((int) mxGetNumberOfElements(prhs[1]) != n_data || (int) mxGetNumberOfElements(prhs[2]) != n_data)
+        mexErrMsgTxt("fit_global_fast: t, g and dg must have the same length");
+    p.t    = mxGetPr(prhs[0]);
+    p.g    = mxGetPr(prhs[1]);
+    dg     = mxGetPr(prhs[2]);
+    off_d  = mxGetPr(prhs[3]);
+    q      = mxGetPr(prhs[4]);
+    p.lower = mxGetPr(prhs[6]);
+    p.upper = mxGetPr(prhs[7]);
+    start   = mxGetPr(prhs[8]);
+
+    offset = mxMalloc((p.n_points + 1) * sizeof(int));
+    q2     = mxMalloc(p.n_points * sizeof(double));
+    p.w    = mxMalloc(n_data * sizeof(double));
+    for (i = 0; i <= p.n_points; i++)
+    {
+        offset[i] = (int) off_d[i];
+        if (offset[i] < 0 || offset[i] > n_data || (i > 0 && offset[i] < offset[i - 1]))
+            mexErrMsgTxt("fit_global_fast: offsets out of range");
+    }
+    for (i = 0; i < p.n_points; i++)
+        q2[i] = q[i] * q[i];
+    for (i = 0; i < n_data; i++)
+        p.w[i] = dg[i] > 0 ? 1 / (dg[i] * dg[i]) : 0;
+    p.offset = offset;
+    p.q2     = q2;
+
+    plhs[0] = mxCreateDoubleMatrix(G, separate ? p.n_points : 1, mxREAL);
+    plhs[1] = mxCreateDoubleMatrix(G, separate ? p.n_points : 1, mxREAL);
+    plhs[2] = mxCreateDoubleMatrix(L, p.n_points, mxREAL);
+    plhs[3] = mxCreateDoubleMatrix(L, p.n_points, mxREAL);
+    xg  = mxGetPr(plhs[0]);
+    dxg = mxGetPr(plhs[1]);
+    xl  = mxGetPr(plhs[2]);
+    dxl = mxGetPr(plhs[3]);
+    for (i = 0; i < p.n_points; i++)
+        for (a = 0; a < L; a++)
+            xl[i * L + a] = start[a];
+    for (i = 0; i < (separate ? p.n_points : 1); i++)
+        for (a = 0; a < G; a++)
+            xg[i * G + a] = start[L + a];
+
+    if (separate)
+    {
+        if (!gf_fit_each(&p, xl, xg, dxl, dxg, max_iter, tol, &info))
+            mexWarnMsgIdAndTxt("fit_global_fast:converged",
+                    "fit_global_fast: %d of %d points not converged (%d stalled)",
+                    p.n_points - info.converged, p.n_points, info.stalled);
+    }
+    else if (!gf_fit(&p, xl, xg, dxl, dxg, max_iter, tol, &info) && info.iterations == 0)
+        mexWarnMsgTxt("fit_global_fast: out of memory");
+    else if (info.stalled)
+        mexWarnMsgTxt("fit_global_fast: stalled, no descent step left (not converged)");
+    else if (!info.converged)
+        mexWarnMsgTxt("fit_global_fast: maximum number of iterations reached");
+
+    plhs[4] = mxCreateStructMatrix(1, 1, 13, info_fields);
+    mxSetField(plhs[4], 0, "iterations",  mxCreateDoubleScalar(info.iterations));
+    mxSetField(plhs[4], 0, "fevals",      mxCreateDoubleScalar(info.fevals));
+    mxSetField(plhs[4], 0, "jevals",      mxCreateDoubleScalar(info.jevals));
+    mxSetField(plhs[4], 0, "converged",   mxCreateDoubleScalar(info.converged));
+    mxSetField(plhs[4], 0, "stalled",     mxCreateDoubleScalar(info.stalled));
+    mxSetField(plhs[4], 0, "chi2",        mxCreateDoubleScalar(info.chi2));
+    mxSetField(plhs[4], 0, "dof",         mxCreateDoubleScalar(info.dof));
+    mxSetField(plhs[4], 0, "n_points",    mxCreateDoubleScalar(p.n_points));
+    mxSetField(plhs[4], 0, "n_data",      mxCreateDoubleScalar(n_data));
+    mxSetField(plhs[4], 0, "time_setup",  mxCreateDoubleScalar(info.time_setup));
+    mxSetField(plhs[4], 0, "time_solve",  mxCreateDoubleScalar(info.time_solve));
+    mxSetField(plhs[4], 0, "time_errors", mxCreateDoubleScalar(info.time_errors));
+    mxSetField(plhs[4], 0, "time_total",  mxCreateDoubleScalar(info.time_setup
+                + info.time_solve + info.time_errors));
+
+    mxFree(offset);
+    mxFree(q2);
+    mxFree(p.w);
+    LS_SPAN_END(t0, LS_MEX, "fit_global_fast", NULL);
+}				/* ----------  end of function mexFunction  ---------- */
+#endif
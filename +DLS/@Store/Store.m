@@ -0,0 +1,399 @@
+classdef Store < handle
+% This class stores the correlograms of many samples column by column: one shared
+% lag grid Tau, the matrices G, dG (one column per correlogram), one metadata row
+% per column and fit result tables, instead of one DLS.Point object per count.
+% Vector queries (Q, get_fit, select) are single matrix operations and the native
+% functions (cumulants_fast) work on G directly, without concatenating points.
+% DLS.Point objects are only created on request by point(i).
+% G, dG and the fit tables keep spare columns (the capacity doubles when full), so
+% adding one sample after the other costs amortized O(1) copies per column; reading
+% s.G or s.Fit from outside returns the first N columns.
+%
+% Syntax: s = DLS.Store();
+%         s.add(sample)                                 % DLS.Sample (array) or DLS.Point array
+%         s.add_series(Instruments.ALVTUE, paths, 'Protein', 'BSA', 'C', 5)
+%         s.fit('DoubleBKG'); [g dg] = s.get_fit('DoubleBKG', 'Gamma1', s.select('Sample', 2));
+
+properties ( SetAccess = private )
+
+    Tau = zeros(0, 1);  % [ms] shared lag grid
+
+    % metadata: (1 x N) one entry per column
+    Angle    = [];
+    T        = [];
+    C        = [];
+    Cs       = [];
+    n        = [];
+    Lambda   = [];      % [A] wavelength of the instrument
+    norm     = [];      % normalization of the raw correlogram
+    datetime = [];
+    Sample   = [];      % index into Samples
+
+    Samples  = struct('Protein', {}, 'Salt', {}, 'Path', {}, 'Instrument', {});
+
+end
+
+properties ( Dependent, SetAccess = private )
+
+    G                   % (length(Tau) x N) normalized correlograms, NaN outside their own lags
+    dG
+    Fit                 % Fit.(method): Coeffnames, Values, Lower, Upper (k x N, NaN if not fitted)
+    N                   % number of correlograms
+    Q                   % [A^-1] (1 x N)
+
+end
+
+properties ( Access = private )
+
+    count   = 0;        % columns in use
+    G_buf   = [];       % (length(Tau) x capacity)
+    dG_buf  = [];
+    Fit_buf = struct;   % as Fit, (k x capacity)
+
+end
+
+properties ( Constant, Access = private )
+
+    % methods fitted by the native engine (fit_global_fast, one fit per column):
+    % model names, order of the fit_discrete coefficients in [local; Gammas]
+    Native = struct( ...
+        'Single',    struct('Names', {{ 'Ae' 'Gammae' }},                  'Order', [ 1 2 ]), ...
+        'Double',    struct('Names', {{ 'A1' 'Gamma1' 'A2' 'Gamma2' }},     'Order', [ 1 3 2 4 ]), ...
+        'DoubleBKG', struct('Names', {{ 'A1' 'Gamma1' 'A2' 'Gamma2' 'b' }}, 'Order', [ 1 4 2 5 3 ]) );
+
+end
+
+methods
+
+    function N = get.N ( self )
+        N = self.count;
+    end
+
+    function G = get.G ( self )
+        G = self.G_buf(:, 1:self.count);
+    end
+
+    function dG = get.dG ( self )
+        dG = self.dG_buf(:, 1:self.count);
+    end
+
+    function Fit = get.Fit ( self )
+        Fit  = self.Fit_buf;
+        fits = fieldnames(Fit);
+        for i = 1 : length(fits)
+            f = Fit.(fits{i});
+            f.Values = f.Values(:, 1:self.count);
+            f.Lower  = f.Lower(:, 1:self.count);
+            f.Upper  = f.Upper(:, 1:self.count);
+            Fit.(fits{i}) = f;
+        end
+    end
+
+    function Q = get.Q ( self )
+        Q = 4 * pi * self.n .* sind( 0.5 * self.Angle ) ./ self.Lambda;
+    end
+
+    function idx = add ( self, source )
+        % append the points of a DLS.Sample (array) or of a DLS.Point array as new
+        % columns; correlograms on another lag grid are interpolated (log tau).
+        % output: the column indices
+        idx = zeros(1, 0);
+        if isa(source, 'DLS.Sample')
+            for k = 1 : length(source)
+                s = source(k);
+                i = self.add_sample(s.Protein, s.Salt, s.raw_data_path, s.Instrument);
+                idx = [ idx self.add_points(s.Point, i) ];
+            end
+        else
+            p = source(1);
+            i = self.add_sample(p.Protein, p.Salt, '', p.Instrument);
+            idx = self.add_points(source, i);
+        end
+    end
+
+    function idx = add_series ( self, instrument, paths, varargin )
+        % read a series of dynamic files straight into new columns with
+        % read_dynamic_series_fast (no DLS.Point objects). optional name/value
+        % pairs: Protein, Salt, C, Cs, n, Solvent, Path. instrument: object or name.
+        % n defaults to the refractive index of the solvent (Index_Refraction,
+        % default 'H2O'), as the n of the samples of the example
+        options = struct('Protein', '', 'Salt', '', 'C', NaN, 'Cs', NaN, 'n', [], ...
+            'Solvent', 'H2O', 'Path', '');
+        for i=1:2:length(varargin)
+            options.(varargin{i}) = varargin{i+1};
+        end
+        if isempty(options.n)
+            options.n = Index_Refraction.(options.Solvent);
+        end
+        if ischar(instrument)
+            instrument = Instruments.(instrument);
+        end
+        if ~ispc
+            paths = regexprep(paths, '^~', getenv('HOME'));
+        end
+        [tau g dg angle T datetime norm serial] = instrument.read_dynamic_series_fast( paths, [], ...
+            Instruments.datetime_formats() );
+        k   = self.add_sample(options.Protein, options.Salt, options.Path, instrument);
+        m   = size(g, 2);
+        idx = self.append(tau, g, dg);
+        self.Angle    = [ self.Angle    angle(:)' ];
+        self.T        = [ self.T        T(:)'     ];
+        self.C        = [ self.C        repmat(options.C,  1, m) ];
+        self.Cs       = [ self.Cs       repmat(options.Cs, 1, m) ];
+        self.n        = [ self.n        repmat(options.n,  1, m) ];
+        self.Lambda   = [ self.Lambda   repmat(instrument.Lambda, 1, m) ];
+        self.norm     = [ self.norm     norm(:)'   ];
+        self.datetime = [ self.datetime serial(:)' ];
+        self.Sample   = [ self.Sample   repmat(k, 1, m) ];
+    end
+
+    function mask = select ( self, varargin )
+        % logical (1 x N) mask of the columns matching all name/value conditions:
+        % 'Sample', indices; 'Angle', 'T', 'C', 'Cs', 'Q', 'datetime', [min max]
+        mask = true(1, self.N);
+        for i=1:2:length(varargin)
+            x = self.(varargin{i});
+            v = varargin{i+1};
+            if strcmp(varargin{i}, 'Sample')
+                mask = mask & ismember(x, v);
+            else
+                mask = mask & x >= v(1) & x <= v(end);
+            end
+        end
+    end
+
+    function p = point ( self, idx )
+        % DLS.Point objects of the columns idx (copies of the data)
+        if islogical(idx)
+            idx = find(idx);
+        end
+        if isempty(idx)
+            p = DLS.Point.empty(1, 0);
+            return
+        end
+        p(length(idx)) = DLS.Point;
+        for j = 1 : length(idx)
+            i     = idx(j);
+            s     = self.Samples(self.Sample(i));
+            valid = ~isnan(self.G_buf(:,i));
+            p(j)  = DLS.Point;
+            p(j).Instrument   = s.Instrument;
+            p(j).Protein      = s.Protein;
+            p(j).Salt         = s.Salt;
+            p(j).Angle        = self.Angle(i);
+            p(j).T            = self.T(i);
+            p(j).C            = self.C(i);
+            p(j).Cs           = self.Cs(i);
+            p(j).n            = self.n(i);
+            p(j).Tau          = self.Tau(valid);
+            p(j).G            = self.G_buf(valid,i);
+            p(j).dG           = self.dG_buf(valid,i);
+            p(j).norm_raw     = self.norm(i);
+            p(j).datetime     = self.datetime(i);
+        end
+    end
+
+    function fit ( self, method, idx )
+        % fit the columns idx (default all) and keep only the coefficients and
+        % their 95% confidence bounds. Single, Double and DoubleBKG: all columns
+        % in one call of the native engine (fit_global_fast, nothing shared);
+        % the other methods: fit_discrete column by column (see Fit-Methods)
+        if nargin < 3
+            idx = 1 : self.N;
+        elseif islogical(idx)
+            idx = find(idx);
+        end
+        idx = idx(:)';
+        q   = self.Q;
+        if isfield(self.Native, method)
+            [values lower upper] = self.fit_native(method, idx, q(idx));
+            self.fit_table(method, self.Native.(method).Names);
+            self.Fit_buf.(method).Values(:,idx) = values;
+            self.Fit_buf.(method).Lower(:,idx)  = lower;
+            self.Fit_buf.(method).Upper(:,idx)  = upper;
+            return
+        end
+        for i = idx
+            valid   = ~isnan(self.G_buf(:,i));
+            fit_obj = DLS.Point.fit_discrete(self.Tau(valid), self.G_buf(valid,i), self.dG_buf(valid,i), ...
+                method, q(i), self.Samples(self.Sample(i)).Protein, []);
+            self.fit_table(method, coeffnames(fit_obj)');
+            ci = confint(fit_obj);
+            self.Fit_buf.(method).Values(:,i) = coeffvalues(fit_obj)';
+            self.Fit_buf.(method).Lower(:,i)  = ci(1,:)';
+            self.Fit_buf.(method).Upper(:,i)  = ci(2,:)';
+        end
+    end
+
+    function [fit_val, error_fit_val] = get_fit ( self, method, parameter, idx )
+        % values and 95% confidence half widths of a coefficient, as
+        % DLS.Sample.get_fit, for the columns idx (default all)
+        if nargin < 4
+            idx = 1 : self.N;
+        end
+        f = self.Fit_buf.(method);
+        k = strcmp(f.Coeffnames, parameter);
+        fit_val       = f.Values(k, idx)';
+        error_fit_val = 0.5 * abs( f.Upper(k, idx) - f.Lower(k, idx) )';
+    end
+
+    function res = cumulants ( self, order, min_g, idx )
+        % closed-form cumulant analysis (as DLS.cumulants) of the columns idx
+        % (default all): G is passed to cumulants_fast as is
+        if nargin < 2, order = [];          end
+        if nargin < 3, min_g = 0.15;        end
+        if nargin < 4, idx   = 1 : self.N;  end
+        m      = length(self.Tau);
+        g      = self.G_buf(:, idx);
+        dg     = self.dG_buf(:, idx);
+        k      = size(g, 2);
+        [cf dcf num] = DLS.cumulants_fast(repmat(self.Tau, k, 1), g(:), dg(:), ...
+            m * (0 : k), order, min_g);
+        order      = size(cf, 1) - 1;
+        q          = self.Q;
+        q          = q(idx);
+        res.Order  = order;
+        res.loga   = cf(1,:);
+        res.dloga  = dcf(1,:);
+        res.Gamma  = cf(2,:);
+        res.dGamma = dcf(2,:);
+        if order > 1
+            res.mu2 = cf(3,:);
+            res.dmu2 = dcf(3,:);
+            res.PDI = res.mu2 ./ res.Gamma.^2;
+        end
+        if order > 2
+            res.mu3 = cf(4,:);
+            res.dmu3 = dcf(4,:);
+        end
+        res.D      = res.Gamma  ./ ( 1e6 * q.^2 );
+        res.dD     = res.dGamma ./ ( 1e6 * q.^2 );
+        res.N      = num;
+    end
+
+end
+
+methods ( Access = private )
+
+    function k = add_sample ( self, protein, salt, path, instrument )
+        k = length(self.Samples) + 1;
+        self.Samples(k).Protein    = protein;
+        self.Samples(k).Salt       = salt;
+        self.Samples(k).Path       = path;
+        self.Samples(k).Instrument = instrument;
+    end
+
+    function idx = add_points ( self, point, k )
+        m = length(point);
+        if isempty(self.Tau)
+            tau = point(1).Tau(:);
+        else
+            tau = self.Tau;
+        end
+        g  = nan(length(tau), m);
+        dg = nan(length(tau), m);
+        for j = 1 : m
+            [g(:,j) dg(:,j)] = self.on_grid(tau, point(j).Tau, point(j).G, point(j).dG);
+        end
+        idx = self.append(tau, g, dg);
+        self.Angle    = [ self.Angle    point.Angle ];
+        self.T        = [ self.T        point.T     ];
+        self.C        = [ self.C        self.column(point, 'C')        ];
+        self.Cs       = [ self.Cs       self.column(point, 'Cs')       ];
+        self.n        = [ self.n        self.column(point, 'n')        ];
+        self.norm     = [ self.norm     self.column(point, 'norm_raw') ];
+        self.datetime = [ self.datetime self.column(point, 'datetime') ];
+        self.Lambda   = [ self.Lambda   arrayfun(@(p) p.Instrument.Lambda, point) ];
+        self.Sample   = [ self.Sample   repmat(k, 1, m) ];
+    end
+
+    function idx = append ( self, tau, g, dg )
+        % append columns on the lag grid tau (the grid of the store if not empty)
+        if isempty(self.Tau)
+            self.Tau = tau(:);
+        elseif ~isequal(tau(:), self.Tau)
+            [g dg] = self.on_grid(self.Tau, tau, g, dg);
+        end
+        m   = size(g, 2);
+        idx = self.count + ( 1 : m );
+        if idx(end) > size(self.G_buf, 2)
+            self.reserve(max(idx(end), 2 * size(self.G_buf, 2)));
+        end
+        self.G_buf(:, idx)  = g;
+        self.dG_buf(:, idx) = dg;
+        self.count = idx(end);
+    end
+
+    function reserve ( self, capacity )
+        % grow G, dG and the fit tables to capacity columns; the spare columns
+        % are NaN (not fitted yet)
+        m           = capacity - size(self.G_buf, 2);
+        self.G_buf  = [ self.G_buf  nan(length(self.Tau), m) ];
+        self.dG_buf = [ self.dG_buf nan(length(self.Tau), m) ];
+        fits = fieldnames(self.Fit_buf);
+        for i = 1 : length(fits)
+            f = self.Fit_buf.(fits{i});
+            k = length(f.Coeffnames);
+            f.Values = [ f.Values nan(k, m) ];
+            f.Lower  = [ f.Lower  nan(k, m) ];
+            f.Upper  = [ f.Upper  nan(k, m) ];
+            self.Fit_buf.(fits{i}) = f;
+        end
+    end
+
+    function fit_table ( self, method, names )
+        % empty (NaN) table of the coefficients names of method, if not there yet
+        if ~isfield(self.Fit_buf, method)
+            k = length(names);
+            c = size(self.G_buf, 2);
+            self.Fit_buf.(method) = struct('Coeffnames', {names}, 'Values', nan(k, c), ...
+                'Lower', nan(k, c), 'Upper', nan(k, c));
+        end
+    end
+
+    function [values lower upper] = fit_native ( self, method, idx, q )
+        % every column of idx fitted on its own by fit_global_fast; values and
+        % 95% confidence bounds in the order of the fit_discrete coefficients
+        [model localnames globalnames lowerbond upperbond startpoint] = DLS.global_model(method);
+        g      = self.G_buf(:, idx);
+        dg     = self.dG_buf(:, idx);
+        valid  = ~isnan(g);
+        t      = repmat(self.Tau, 1, length(idx));
+        offset = [ 0 cumsum(sum(valid, 1)) ];
+        [xg dxg xl dxl] = DLS.Sample.fit_global_fast(t(valid), g(valid), dg(valid), offset, q, ...
+            model, lowerbond, upperbond, startpoint, [ 1000 1e-10 1 ]);
+        s      = 1e6 * q.^2;                    % D [A^2/ns] -> Gamma [ms^-1]
+        order  = self.Native.(method).Order;
+        x      = [ xl  ; bsxfun(@times, xg,  s) ];
+        dx     = [ dxl ; bsxfun(@times, dxg, s) ];
+        values = x(order, :);
+        lower  = values - dx(order, :);
+        upper  = values + dx(order, :);
+    end
+
+end
+
+methods ( Static, Access = private )
+
+    function [g dg] = on_grid ( grid, tau, g, dg )
+        % correlograms (columns) of lags tau on grid, linear in log(tau), NaN outside
+        if isequal(tau(:), grid(:))
+            return
+        end
+        g  = interp1(log(tau(:)), g,  log(grid(:)), 'linear', NaN);
+        dg = interp1(log(tau(:)), dg, log(grid(:)), 'linear', NaN);
+    end
+
+    function x = column ( point, prop )
+        % (1 x length(point)) scalar property of every point, NaN if empty
+        x = nan(1, length(point));
+        for i = 1 : length(point)
+            if ~isempty(point(i).(prop))
+                x(i) = point(i).(prop);
+            end
+        end
+    end
+
+end
+
+end
@@ -0,0 +1,175 @@
+classdef Watcher < handle
+% This class ingests the autosave files of a running DLS measurement incrementally:
+% the directory is watched natively (Instruments.watch_directory_fast), only the
+% files finished since the previous poll are read and only the new points are
+% fitted / inverted. Results can be polled or pushed to a callback by a timer.
+%
+% Syntax: w = DLS.Watcher('Instrument', 'ALVTUE', 'Path', '/data/lyso_', ...
+%                         'Model', 'DoubleBKG', 'Callback', @(w, points) ...)
+%         w.start(10)   % poll every 10 s,  w.stop(), or
+%         points = w.poll(timeout)
+
+properties
+
+    Protein             % copied to every new point
+    Salt
+    C
+    Cs
+    n
+
+    Model               % fit of every new point ('' : no fit)
+    Invert = false;     % invert_laplace every new point
+    Callback            % called as Callback(watcher, new_points) after every poll
+    Store               % .mat file updated after every poll ('' : memory only)
+
+end
+
+properties ( SetAccess = private )
+
+    Point               % all ingested points, in the order of the file names
+    Files = {};         % file names of Point
+
+end
+
+properties ( Hidden )
+
+    Instrument
+    raw_data_path       % prefix of the files, as DLS.Sample
+    Loader = 'fast';
+    id     = 0;         % watch of watch_directory_fast
+    pattern             % regular expression of the file names of the series
+    Timer
+
+end
+
+methods
+
+    %constructor
+    function self = Watcher( varargin )
+        a = Args(varargin{:});
+        try self.Instrument = Instruments.(a.Instrument);
+        catch err; error('Instrument not found!');
+        end
+        self.raw_data_path = a.Path;
+        props = { 'Protein', 'Salt', 'C', 'Cs', 'n', ...
+                'Model', 'Invert', 'Callback', 'Store', 'Loader' };
+        for i = 1 : length(props)
+            if any(strcmp(props{i}, properties(a)))
+                self.(props{i}) = a.(props{i});
+            end
+        end
+        if ~ispc
+            self.raw_data_path = regexprep(self.raw_data_path, '^~', getenv('HOME'));
+        end
+        self.pattern = self.file_pattern();
+        self.id = Instruments.watch_directory_fast('open', self.directory(), '.ASC');
+    end
+
+    function delete ( self )
+        self.stop();
+        if self.id > 0
+            Instruments.watch_directory_fast('close', self.id);
+            self.id = 0;
+        end
+    end
+
+    function points = poll ( self, timeout )
+        % read, fit and store the files finished since the previous poll
+        % (waiting up to timeout seconds, default 0). Output: the new points.
+        % The files stay queued until they are read: after an error they are
+        % returned again by the next poll
+        if nargin < 2
+            timeout = 0;
+        end
+        queued = Instruments.watch_directory_fast('poll', self.id, timeout);
+        files  = queued( ~cellfun(@isempty, regexpi(queued, self.pattern, 'once')) );
+        files  = setdiff(files, self.Files);    % sorted: angle, then count
+        points = DLS.Point.empty;
+        if isempty(files)
+            Instruments.watch_directory_fast('done', self.id, length(queued));
+            return
+        end
+        paths = fullfile(self.directory(), files);
+        switch self.Loader
+        case 'fast'
+            points = self.Instrument.read_dynamic_series(paths);
+        case 'matlab'
+            for i = 1 : length(paths)
+                points(i) = self.Instrument.read_dynamic_file(paths{i});
+            end
+            datetime = Instruments.parse_datetime({points.datetime_raw});
+            for i = 1 : length(points)
+                points(i).datetime = datetime(i);
+            end
+        otherwise
+            error('Loader not recognized!');
+        end
+        Instruments.watch_directory_fast('done', self.id, length(queued));
+        pointprops = { 'Protein', 'Salt', 'C', 'Cs', 'n' };
+        for i = 1 : length(pointprops)
+            [ points.(pointprops{i}) ] = deal(self.(pointprops{i}));
+        end
+        fprintf('watch: %d new files (%s ... %s)\n', length(files), files{1}, files{end});
+        for i = 1 : length(points)
+            if ~isempty(self.Model)
+                points(i).fit(self.Model);
+            end
+            if self.Invert
+                points(i).invert_laplace();
+            end
+        end
+        [self.Files order] = sort([self.Files(:); files(:)]);
+        all_points = [self.Point(:); points(:)];
+        self.Point = all_points(order)';
+        if ~isempty(self.Store)
+            Point = self.Point; Files = self.Files;
+            save(self.Store, 'Point', 'Files');
+        end
+        if ~isempty(self.Callback)
+            self.Callback(self, points);
+        end
+    end
+
+    function start ( self, period )
+        % poll every period seconds (default 5) in the background
+        if nargin < 2
+            period = 5;
+        end
+        self.stop();
+        self.Timer = timer('ExecutionMode', 'fixedSpacing', 'Period', period, ...
+            'BusyMode', 'drop', 'TimerFcn', @(varargin) self.poll());
+        start(self.Timer);
+    end
+
+    function stop ( self )
+        if ~isempty(self.Timer) && isvalid(self.Timer)
+            stop(self.Timer);
+            delete(self.Timer);
+        end
+        self.Timer = [];
+    end
+
+end
+
+methods ( Access = private )
+
+    function p = file_pattern ( self )
+        % file names of the series: generate_filename of the instrument with
+        % every digit of the indices as \d (ALV: NNNN.ASC, ALVTUE: NNNN_NNNN.ASC)
+        [tmp prefix] = fileparts([self.raw_data_path 'x']);
+        prefix = prefix(1 : end-1);
+        name   = self.Instrument.generate_filename('', 1, 1);
+        p = ['^' regexptranslate('escape', prefix) ...
+            regexprep(regexptranslate('escape', name), '\d', '\\d') '$'];
+    end
+
+    function d = directory ( self )
+        d = fileparts([self.raw_data_path 'x']);
+        if isempty(d)
+            d = '.';
+        end
+    end
+
+end
+
+end
@@ -0,0 +1,59 @@
+function res = bootstrap ( point, method, n_rep, seed, mode, options )
+% bootstrap (residual resampling) or jackknife errors of the native fit of an
+% array of DLS.Point; the D's are shared between the points as in
+% DLS.Sample.fit_global (a single point gives the errors of its own fit).
+% input : method ('Single', 'Double' or 'DoubleBKG'), n_rep (default 500),
+%         seed (default 0), mode ('bootstrap' (default) or 'jackknife'; for
+%         the jackknife n_rep is the number of deleted blocks), options
+%         [max_iter tol n_threads] passed to bootstrap_fast
+% output: struct with the estimate, 95% intervals (percentile for the
+%         bootstrap), standard errors and replicates of the local parameters
+%         (one column per point) and of the D's [A^2/ns]
+ if nargin < 3 || isempty(n_rep)
+  n_rep	= 500;
+ end
+ if nargin < 4 || isempty(seed)
+  seed	= 0;
+ end
+ if nargin < 5 || isempty(mode)
+  mode	= 'bootstrap';
+ end
+ if nargin < 6
+  options	= [];
+ end
+ switch mode
+ case 'bootstrap'
+  imode	= 0;
+ case 'jackknife'
+  imode	= 1;
+ otherwise
+  error('Mode not recognized!');
+ end
+
+ [ model localnames globalnames lowerbond upperbond startpoint ] = DLS.global_model( method );
+ [ t g dg offset ]	= DLS.concat_points( point );
+ q			= [ point.Q ];
+ [ est lo hi se rep info ] = DLS.bootstrap_fast( t, g, dg, offset, q, model, ...
+	lowerbond, upperbond, startpoint, n_rep, seed, imode, options );
+
+ L		= length(localnames);
+ N		= length(point);
+ il		= 1 : N * L;
+ ig		= N * L + 1 : N * L + length(globalnames);
+ res.Method	= method;
+ res.Mode	= mode;
+ res.Seed	= seed;
+ res.Local	= localnames;
+ res.Global	= globalnames;
+ res.Values	= reshape( est(il), L, N );
+ res.Lower	= reshape( lo(il),  L, N );
+ res.Upper	= reshape( hi(il),  L, N );
+ res.SE		= reshape( se(il),  L, N );
+ res.D		= est(ig)';
+ res.D_Lower	= lo(ig)';
+ res.D_Upper	= hi(ig)';
+ res.D_SE	= se(ig)';
+ res.Unit_D	= 'A^2/ns';
+ res.Replicates	= rep;
+ res.Info	= info;
+end
@@ -0,0 +1,171 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  bootstrap_fast.c
+ *
+ *    Description:  bootstrap and jackknife errors of the discrete fits: matlab interface
+ *                  of bs_resample / bs_summary (libls/bootstrap.c, resampling and the
+ *                  parallel refits).
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdlib.h>
+
+/* check if calling from matlab and include necessary mex.h*/
+#ifdef MATLAB_MEX_FILE
+#include "mex.h"
+#endif
+
+#include "../libls/ls.h"
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  mexFunction
+ *  Description:  comunicate between matlab and c program
+ *
+ *  [est lo hi se rep info] = bootstrap_fast(t, g, dg, offset, q, model, lower, upper,
+ *                                           start, n_rep, seed, mode, options)
+ *
+ *  t ... start : as fit_global_fast
+ *  n_rep       : number of replicates (bootstrap: 200 - 1000, jackknife: blocks)
+ *  seed        : seed of the random streams (replicate b uses stream b)
+ *  mode        : 0 bootstrap, 1 jackknife
+ *  options     : [max_iter tol n_threads] (optional, n_threads = 0: all)
+ *  est, lo, hi, se : estimate, 95% interval and standard error of the parameters,
+ *                ordered as the local parameters of every point, then the global ones
+ *  rep         : (n_par x n_rep) the refitted parameters of every replicate
+ * =====================================================================================
+ */
+#ifdef MATLAB_MEX_FILE
+void mexFunction(int nlhs,
+        mxArray *plhs[],
+        int nrhs,
+        const mxArray *prhs[])
+{
+    const char *info_fields[] = { "n_rep", "n_failed", "n_threads", "converged",
+        "iterations", "chi2", "dof", "time_fit", "time_resample" };
+    gf_problem p;
+    gf_info    fi;
+    bs_info    info;
+    const double *dg, *q, *start, *off_d, *opt;
+    double *q2, *est, *dx, t0;
+    int *offset;
+    int i, a, n_data, n_par, L, G, n_rep, mode, max_iter = 1000, n_threads = 0;
+    double tol = 1e-10, span;
+    unsigned long long seed;
+
+    LS_SPAN_BEGIN(span);
+    if (nrhs < 12)
+        mexErrMsgTxt("usage: [est lo hi se rep info] = bootstrap_fast(t, g, dg, offset, q, model, lower, upper, start, n_rep, seed, mode, options)");
+    p.model = (int) mxGetScalar(prhs[5]);
+    if (!gf_model_size(p.model, &L, &G))
+        mexErrMsgTxt("bootstrap_fast: unknown model");
+    p.n_local  = L;
+    p.n_global = G;
+    p.n_points = (int) mxGetNumberOfElements(prhs[4]);
+    if ((int) mxGetNumberOfElements(prhs[3]) != p.n_points + 1)
+        mexErrMsgTxt("bootstrap_fast: offset must have n_points + 1 elements");
+    if ((int) mxGetNumberOfElements(prhs[6]) != L + G ||
+        (int) mxGetNumberOfElements(prhs[7]) != L + G ||
+        (int) mxGetNumberOfElements(prhs[8]) != L + G)
+        mexErrMsgTxt("bootstrap_fast: lower, upper and start must have one entry per parameter");
+    n_rep = (int) mxGetScalar(prhs[9]);
+    seed  = (unsigned long long) mxGetScalar(prhs[10]);
+    mode  = (int) mxGetScalar(prhs[11]);
+    if (n_rep < 2)
+        mexErrMsgTxt("bootstrap_fast: at least 2 replicates needed");
+    if (mode != BS_BOOTSTRAP && mode != BS_JACKKNIFE)
+        mexErrMsgTxt("bootstrap_fast: mode must be 0 (bootstrap) or 1 (jackknife)");
+    if (nrhs > 12)
+    {
+        opt = mxGetPr(prhs[12]);
+        if (mxGetNumberOfElements(prhs[12]) >= 1)
+            max_iter = (int) opt[0];
+        if (mxGetNumberOfElements(prhs[12]) >= 2)
+            tol = opt[1];
+        if (mxGetNumberOfElements(prhs[12]) >= 3)
+            n_threads = (int) opt[2];
+    }
+
+    n_data  = (int) mxGetNumberOfElements(prhs[0]);
+    p.t     = mxGetPr(prhs[0]);
+    p.g     = mxGetPr(prhs[1]);
+    dg      = mxGetPr(prhs[2]);
+    off_d   = mxGetPr(prhs[3]);
+    q       = mxGetPr(prhs[4]);
+    p.lower = mxGetPr(prhs[6]);
+    p.upper = mxGetPr(prhs[7]);
+    start   = mxGetPr(prhs[8]);
+
+    offset = mxMalloc((p.n_points + 1) * sizeof(int));
+    q2     = mxMalloc(p.n_points * sizeof(double));
+    p.w    = mxMalloc(n_data * sizeof(double));
+    for (i = 0; i <= p.n_points; i++)
+    {
+        offset[i] = (int) off_d[i];
+        if (offset[i] < 0 || offset[i] > n_data || (i > 0 && offset[i] < offset[i - 1]))
+            mexErrMsgTxt("bootstrap_fast: offsets out of range");
+    }
+    if (offset[0] != 0)
+        mexErrMsgTxt("bootstrap_fast: the first offset must be 0");
+    for (i = 0; i < p.n_points; i++)
+        q2[i] = q[i] * q[i];
+    for (i = 0; i < n_data; i++)
+        p.w[i] = dg[i] > 0 ? 1 / (dg[i] * dg[i]) : 0;
+    p.offset = offset;
+    p.q2     = q2;
+
+    n_par = p.n_points * L + G;
+    plhs[0] = mxCreateDoubleMatrix(n_par, 1, mxREAL);
+    plhs[1] = mxCreateDoubleMatrix(n_par, 1, mxREAL);
+    plhs[2] = mxCreateDoubleMatrix(n_par, 1, mxREAL);
+    plhs[3] = mxCreateDoubleMatrix(n_par, 1, mxREAL);
+    plhs[4] = mxCreateDoubleMatrix(n_par, n_rep, mxREAL);
+    est = mxGetPr(plhs[0]);
+    dx  = mxMalloc(n_par * sizeof(double));
+    for (i = 0; i < p.n_points; i++)
+        for (a = 0; a < L; a++)
+            est[i * L + a] = start[a];
+    for (a = 0; a < G; a++)
+        est[p.n_points * L + a] = start[L + a];
+
+    /*  the estimate, then the replicates around it */
+    t0 = ls_now();
+    gf_fit(&p, est, est + p.n_points * L, dx, dx + p.n_points * L, max_iter, tol, &fi);
+    if (fi.stalled)
+        mexWarnMsgTxt("bootstrap_fast: the fit of the data stalled (no descent step left)");
+    else if (!fi.converged)
+        mexWarnMsgTxt("bootstrap_fast: the fit of the data did not converge");
+    if (!bs_resample(&p, est, est + p.n_points * L, mode, n_rep, seed, max_iter, tol,
+                n_threads, mxGetPr(plhs[4]), &info))
+        mexErrMsgTxt("bootstrap_fast: out of memory");
+    info.time_fit = ls_now() - t0 - info.time_resample;
+    bs_summary(mxGetPr(plhs[4]), n_par, n_rep, mode, est,
+            mxGetPr(plhs[1]), mxGetPr(plhs[2]), mxGetPr(plhs[3]));
+    if (info.n_failed > 0)
+        mexWarnMsgTxt("bootstrap_fast: some replicates did not converge (NaN)");
+
+    plhs[5] = mxCreateStructMatrix(1, 1, 9, info_fields);
+    mxSetField(plhs[5], 0, "n_rep",         mxCreateDoubleScalar(info.n_rep));
+    mxSetField(plhs[5], 0, "n_failed",      mxCreateDoubleScalar(info.n_failed));
+    mxSetField(plhs[5], 0, "n_threads",     mxCreateDoubleScalar(info.n_threads));
+    mxSetField(plhs[5], 0, "converged",     mxCreateDoubleScalar(fi.converged));
+    mxSetField(plhs[5], 0, "iterations",    mxCreateDoubleScalar(fi.iterations));
+    mxSetField(plhs[5], 0, "chi2",          mxCreateDoubleScalar(fi.chi2));
+    mxSetField(plhs[5], 0, "dof",           mxCreateDoubleScalar(fi.dof));
+    mxSetField(plhs[5], 0, "time_fit",      mxCreateDoubleScalar(info.time_fit));
+    mxSetField(plhs[5], 0, "time_resample", mxCreateDoubleScalar(info.time_resample));
+
+    mxFree(dx);
+    mxFree(offset);
+    mxFree(q2);
+    mxFree(p.w);
+    LS_SPAN_END(span, LS_MEX, "bootstrap_fast", NULL);
+}				/* ----------  end of function mexFunction  ---------- */
+#endif
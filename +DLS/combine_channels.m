@@ -0,0 +1,25 @@
+function [ g dg weight ] = combine_channels ( gc, dg, channels )
+% one correlation function per file from all channels of the ALV correlator
+% (in the "C-CH0/1+1/0" mode the first two channels are the pseudo cross
+% correlations, the last two the auto correlations from a later lag on), natively
+% with combine_channels_fast. The noise of every channel relative to the first is
+% estimated from the second differences of the lags, for the means around every
+% lag. Values <= -0.99 are no value (the ALV writes -1 with rounding noise).
+% input : gc (lags x channels x files, or cell array of lags x channels matrices:
+%         7th output of read_dynamic_file_fast), dg (lags x files standard deviation
+%         of the files, [] for ones), channels ('weighted' (default): inverse-variance
+%         mean of the pseudo cross pair (channels 1 and 2), 'all': of all channels
+%         (the auto correlations may be offset), 'best': the channel of the lowest
+%         noise, or a channel number)
+% output: g, dg (lags x files), weight (channels x files)
+ if nargin < 2
+  dg	= [];
+ end
+ if nargin < 3 || isempty(channels)
+  channels	= 'weighted';
+ end
+ if iscell(gc)
+  gc	= cat(3, gc{:});
+ end
+ [ g dg weight ]	= DLS.combine_channels_fast( gc, dg, channels );
+end
@@ -0,0 +1,93 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  combine_channels_fast.c
+ *
+ *    Description:  MEX shim of the combination of the correlation channels of many
+ *                  files (rs_combine_channels, libls/alv_autosave.c): inverse-variance
+ *                  mean of the pseudo cross pair or of all channels with the weights
+ *                  of every lag, the channel of the lowest noise or one channel, with
+ *                  the standard deviation scaled accordingly.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/* check if calling from matlab and include necessary mex.h*/
+#ifdef MATLAB_MEX_FILE
+#include "mex.h"
+#include "../libls/ls_mex.h"
+#endif
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  mexFunction
+ *  Description:  comunicate between matlab and c program
+ *
+ *  [g dg weight] = combine_channels_fast(gc, dg, channels)
+ *
+ *  gc       : lags x channels x files (gc of read_dynamic_file_fast, concatenated
+ *             along the third dimension), -1 (<= -0.99): no value at this lag
+ *  dg       : lags x files standard deviation of the files ([]: ones)
+ *  channels : 'weighted' (default, channels 1 and 2), 'all', 'best' or a channel number
+ *  g, dg    : lags x files; weight : channels x files
+ * =====================================================================================
+ */
+#ifdef MATLAB_MEX_FILE
+void mexFunction(int nlhs,
+        mxArray *plhs[],
+        int nrhs,
+        const mxArray *prhs[])
+{
+    const mwSize *dims;
+    const double *gc, *dg = NULL;
+    double *g, *dg_out, *weight, w[RS_MAX_CHANNELS];
+    int i, j, n, n_ch, n_files, select = RS_CH_WEIGHTED;
+    double t0;
+
+    LS_SPAN_BEGIN(t0);
+    if (nrhs < 1 || !mxIsDouble(prhs[0]))
+        mexErrMsgTxt("usage: [g dg weight] = combine_channels_fast(gc, dg, channels)");
+    if (nrhs > 2 && !mxIsEmpty(prhs[2]))
+        select = rs_select_from_matlab(prhs[2]);
+    dims    = mxGetDimensions(prhs[0]);
+    n       = (int) dims[0];
+    n_ch    = mxGetNumberOfDimensions(prhs[0]) > 1 ? (int) dims[1] : 1;
+    n_files = n * n_ch > 0 ? (int) (mxGetNumberOfElements(prhs[0]) / ((size_t) n * n_ch)) : 0;
+    if (n_ch > RS_MAX_CHANNELS)
+        mexErrMsgTxt("combine_channels_fast: at most 4 channels");
+    if (nrhs > 1 && !mxIsEmpty(prhs[1]))
+    {
+        if ((int) mxGetNumberOfElements(prhs[1]) != n * n_files)
+            mexErrMsgTxt("combine_channels_fast: dg must be lags x files");
+        dg = mxGetPr(prhs[1]);
+    }
+    gc = mxGetPr(prhs[0]);
+
+    plhs[0] = mxCreateDoubleMatrix(n, n_files, mxREAL);
+    plhs[1] = mxCreateDoubleMatrix(n, n_files, mxREAL);
+    plhs[2] = mxCreateDoubleMatrix(n_ch, n_files, mxREAL);
+    g      = mxGetPr(plhs[0]);
+    dg_out = mxGetPr(plhs[1]);
+    weight = mxGetPr(plhs[2]);
+    for (i = 0; i < n_files; i++)
+    {
+        if (!rs_combine_channels(gc + (size_t) i * n * n_ch, n, n_ch, 1, n,
+                    dg ? dg + (size_t) i * n : NULL, select,
+                    g + (size_t) i * n, dg_out + (size_t) i * n, w))
+            mexErrMsgIdAndTxt("combine_channels_fast:channels", "no such channel in file %d", i + 1);
+        for (j = 0; j < n_ch; j++)
+            weight[(size_t) i * n_ch + j] = w[j];
+    }
+    LS_SPAN_END(t0, LS_MEX, "combine_channels_fast", NULL);
+}				/* ----------  end of function mexFunction  ---------- */
+#endif
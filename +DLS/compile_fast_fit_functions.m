@@ -0,0 +1,11 @@
+% the engines are part of libls (../libls): build the shared library, the MEX files are thin shims linked to it
+libls = fullfile(fileparts(fileparts(mfilename('fullpath'))), 'libls');
+system(['make -C ' libls ' lib']);
+link  = {fullfile(libls, 'ls_mex.c'), ['-I' libls], ['-L' libls], '-lls'};
+mex('-outdir', './@Sample', './@Sample/fit_global_fast.c', link{:}, ['LDFLAGS=$LDFLAGS -Wl,-rpath,' libls]);
+mex('./cumulants_fast.c', link{:}, ['LDFLAGS=$LDFLAGS -Wl,-rpath,' libls]);
+mex('./combine_channels_fast.c', link{:}, ['LDFLAGS=$LDFLAGS -Wl,-rpath,' libls]);
+mex('./rebin_fast.c', link{:}, ['LDFLAGS=$LDFLAGS -Wl,-rpath,' libls]);
+mex('./bootstrap_fast.c', link{:}, ['LDFLAGS=$LDFLAGS -Wl,-rpath,' libls]);
+% batched weighted regression (linreg, DLS.diffusion), in the root of the toolbox
+mex('-outdir', '..', '../linreg_fast.c', link{:}, ['LDFLAGS=$LDFLAGS -Wl,-rpath,' libls]);
@@ -0,0 +1,20 @@
+function [ t g dg offset ] = concat_points ( point, per_decade )
+% concatenate the correlograms of an array of DLS.Point into column vectors, as
+% needed by the native functions working on all points at once (fit_global_fast,
+% cumulants_fast). offset holds the 0-based start index of every point, plus the
+% total length as last element.
+% optional: per_decade, points per decade of the log-spaced rebinning (rebin_fast:
+% inverse-variance means, propagated dG), one for all points or one per point
+% (default: the Rebin of the points, none if empty or 0)
+ if nargin < 2
+  per_decade	= arrayfun(@(p) max([ p.Rebin 0 ]), point);
+ end
+ len	= arrayfun(@(p) length(p.Tau), point);
+ offset	= [ 0 cumsum(len(:)') ];
+ t	= vertcat( point.Tau );
+ g	= vertcat( point.G   );
+ dg	= vertcat( point.dG  );
+ if any( per_decade > 0 )
+  [ t g dg offset ]	= DLS.rebin_fast( t, g, dg, offset, per_decade );
+ end
+end
@@ -0,0 +1,36 @@
+function res = cumulants ( point, order, min_g )
+% closed-form weighted cumulant analysis of all points (array of DLS.Point).
+% input : order (1, 2 or 3; default: the one of cumulants_fast), min_g (default
+%         0.15, as fit_discrete)
+% output: struct with one entry per point, Gamma [ms^-1], mu2, mu3, the
+%         polydispersity mu2 / Gamma^2, D [A^2/ns] and the 95% confidence errors
+ if nargin < 2
+  order	= [];
+ end
+ if nargin < 3
+  min_g	= 0.15;
+ end
+
+ [ t g dg offset ]	= DLS.concat_points( point );
+ [ cf dcf n ]		= DLS.cumulants_fast( t, g, dg, offset, order, min_g );
+ order		= size( cf, 1 ) - 1;
+
+ q		= [ point.Q ];
+ res.Order	= order;
+ res.loga	= cf(1,:);
+ res.dloga	= dcf(1,:);
+ res.Gamma	= cf(2,:);
+ res.dGamma	= dcf(2,:);
+ if order > 1
+  res.mu2	= cf(3,:);
+  res.dmu2	= dcf(3,:);
+  res.PDI	= res.mu2 ./ res.Gamma.^2;
+ end
+ if order > 2
+  res.mu3	= cf(4,:);
+  res.dmu3	= dcf(4,:);
+ end
+ res.D		= res.Gamma  ./ ( 1e6 * q.^2 );		% A^2 / ns
+ res.dD		= res.dGamma ./ ( 1e6 * q.^2 );
+ res.N		= n;					% points used per correlogram
+end
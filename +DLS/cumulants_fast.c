@@ -0,0 +1,99 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  cumulants_fast.c
+ *
+ *    Description:  MEX shim of the closed-form weighted cumulant analysis of many
+ *                  correlograms (cu_cumulants, libls/cumulants.c).
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/* check if calling from matlab and include necessary mex.h*/
+#ifdef MATLAB_MEX_FILE
+#include "mex.h"
+#endif
+
+#include "../libls/ls.h"
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  mexFunction
+ *  Description:  comunicate between matlab and c program
+ *
+ *  [cf dcf n] = cumulants_fast(t, g, dg, offset, order, min_g)
+ *
+ *  t, g, dg : correlograms of all points, concatenated (column vectors)
+ *  offset   : (n_points + 1) 0-based start indices of every point
+ *  order    : 1, 2 or 3 (default or []: CU_DEFAULT_ORDER, libls/cumulants.h)
+ *  min_g    : only points with g > min_g (and dg > 0) are used (default 0.15, as fit_discrete)
+ *  cf, dcf  : (order + 1) x n_points coefficients [loga; Gamma; mu2; mu3] and the
+ *             half widths of their 95% confidence intervals
+ *  n        : number of points used for every correlogram
+ * =====================================================================================
+ */
+#ifdef MATLAB_MEX_FILE
+void mexFunction(int nlhs,
+        mxArray *plhs[],
+        int nrhs,
+        const mxArray *prhs[])
+{
+    const double *t, *g, *dg, *offset;
+    double *cf, *dcf, *nused, min_g = 0.15;
+    int i, j, n_points, n_data, order = CU_DEFAULT_ORDER, s, e;
+    cu_result res;
+    double t0;
+
+    LS_SPAN_BEGIN(t0);
+    if (nrhs < 4)
+        mexErrMsgTxt("usage: [cf dcf n] = cumulants_fast(t, g, dg, offset, order, min_g)");
+    if (nrhs > 4 && !mxIsEmpty(prhs[4]))
+        order = (int) mxGetScalar(prhs[4]);
+    if (nrhs > 5)
+        min_g = mxGetScalar(prhs[5]);
+    if (order < 1 || order > CU_MAX_ORDER)
+        mexErrMsgTxt("cumulants_fast: order must be 1, 2 or 3");
+
+    n_data   = (int) mxGetNumberOfElements(prhs[0]);
+    n_points = (int) mxGetNumberOfElements(prhs[3]) - 1;
+    if (n_points < 0 || (int) mxGetNumberOfElements(prhs[1]) != n_data
+            || (int) mxGetNumberOfElements(prhs[2]) != n_data)
+        mexErrMsgTxt("cumulants_fast: t, g and dg must have the same length");
+    t      = mxGetPr(prhs[0]);
+    g      = mxGetPr(prhs[1]);
+    dg     = mxGetPr(prhs[2]);
+    offset = mxGetPr(prhs[3]);
+
+    plhs[0] = mxCreateDoubleMatrix(order + 1, n_points, mxREAL);
+    plhs[1] = mxCreateDoubleMatrix(order + 1, n_points, mxREAL);
+    plhs[2] = mxCreateDoubleMatrix(1, n_points, mxREAL);
+    cf    = mxGetPr(plhs[0]);
+    dcf   = mxGetPr(plhs[1]);
+    nused = mxGetPr(plhs[2]);
+    for (i = 0; i < n_points; i++)
+    {
+        s = (int) offset[i];
+        e = (int) offset[i + 1];
+        if (s < 0 || e > n_data || e < s)
+            mexErrMsgTxt("cumulants_fast: offsets out of range");
+        cu_cumulants(t + s, g + s, dg + s, e - s, order, min_g, &res);
+        for (j = 0; j <= order; j++)
+        {
+            cf[i * (order + 1) + j]  = res.coeff[j];
+            dcf[i * (order + 1) + j] = res.error[j];
+        }
+        nused[i] = res.n;
+    }
+    LS_SPAN_END(t0, LS_MEX, "cumulants_fast", NULL);
+}				/* ----------  end of function mexFunction  ---------- */
+#endif
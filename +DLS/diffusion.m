@@ -0,0 +1,47 @@
+function res = diffusion ( sample, method, parameter, varargin )
+% diffusion coefficient of every DLS.Sample (array) from the decay rates of a
+% fit method,
+%
+%		Gamma = 1e6 * D * q^2		( + Gamma0 with 'Offset' )
+%
+% weighted by the 95% errors of the decay rates (get_fit), all samples in one
+% native regression (linreg). Gamma in ms^-1, q in A^-1, D in A^2/ns.
+% input : method (e.g. 'DoubleBKG'), parameter (default 'Gamma1'), options
+%         'Offset' (free intercept Gamma0) and 'Bootstrap' (errors of the decay
+%         rates from the bootstrap, see DLS.Sample.get_fit)
+% output: struct, one value per sample in every field: D, dD (half widths of the
+%         95% confidence intervals), Gamma0, dGamma0 (0 without 'Offset'), N, Chi2
+ if nargin < 3 || isempty(parameter)
+  parameter	= 'Gamma1';
+ end
+ offset	= any( strcmpi( varargin, 'Offset' ) );
+ opts	= varargin( strcmpi( varargin, 'Bootstrap' ) );
+
+ x	= [];
+ y	= [];
+ dy	= [];
+ group	= [];
+ for i = 1 : length(sample)
+  [ g dg ]	= sample(i).get_fit( method, parameter, opts{:} );
+  q		= sample(i).Qv();
+  x		= [ x ;		q.^2			];
+  y		= [ y ;		g			];
+  dy		= [ dy ;	dg			];
+  group		= [ group ;	repmat(i, length(g), 1)	];
+ end
+
+ r	= linreg( x, y, dy, group, 1, ~offset );
+
+ m	= length(sample);
+ res	= struct( 'D', NaN(1,m), 'dD', NaN(1,m), 'Gamma0', zeros(1,m), 'dGamma0', zeros(1,m), ...
+		'N', zeros(1,m), 'Chi2', NaN(1,m) );
+ i	= r.Group;
+ res.D(i)	= r.Coeff(end,:) / 1e6;
+ res.dD(i)	= r.Error(end,:) / 1e6;
+ if offset
+  res.Gamma0(i)		= r.Coeff(1,:);
+  res.dGamma0(i)	= r.Error(1,:);
+ end
+ res.N(i)	= r.N;
+ res.Chi2(i)	= r.Chi2;
+end
@@ -0,0 +1,36 @@
+function [ model localnames globalnames lowerbond upperbond startpoint ] = global_model ( method )
+% models of the native fit engine (fit_global_fast, bootstrap_fast): model
+% number, names of the local (per point) and global (shared D's) parameters,
+% bounds and startpoint (local parameters first, D's in A^2/ns last)
+ Min_D1   = 0.5;   % A^2 / ns, same limits as fit_discrete
+ Max_D1   = 100;   % A^2 / ns
+ Start_D1 = 6;     % A^2 / ns
+ Min_D2   = 0;     % A^2 / ns
+ Max_D2   = 2.5;   % A^2 / ns
+ Start_D2 = 6e-1;  % A^2 / ns
+ switch method
+ case 'Single'
+  model        = 0;
+  localnames   = { 'Ae' };
+  globalnames  = { 'De' };
+  lowerbond    = [ 0.99 Min_D2   ];
+  upperbond    = [ 1.01 Max_D1   ];
+  startpoint   = [ 1.0  Start_D1 ];
+ case 'Double'
+  model        = 1;
+  localnames   = { 'A1' 'A2' };
+  globalnames  = { 'D1' 'D2' };
+  lowerbond    = [ 0.5  0    Min_D1   Min_D2   ];
+  upperbond    = [ 1    1    Max_D1   Max_D2   ];
+  startpoint   = [ 0.9  0.1  Start_D1 Start_D2 ];
+ case 'DoubleBKG'
+  model        = 2;
+  localnames   = { 'A1' 'A2' 'b'  };
+  globalnames  = { 'D1' 'D2' };
+  lowerbond    = [ 0.0  0    -1e-3 Min_D1   Min_D2   ];
+  upperbond    = [ 1    1    1e-3  Max_D1   Max_D2   ];
+  startpoint   = [ 0.9  0.1  0     Start_D1 Start_D2 ];
+ otherwise
+  error('Method not recognized!');
+ end
+end
@@ -0,0 +1,116 @@
+function out = lazy_cache ( cmd, point, bytes )
+% memory budget of the lazily loaded correlograms (DLS.Sample with 'Lazy', true):
+% once the loaded correlograms exceed the budget, the least recently used ones
+% are unloaded (read again from their file on the next access).
+%   DLS.lazy_cache('budget', MB)    : set the budget (default Inf: no limit),
+%                                     applied at once to the points already loaded
+%   DLS.lazy_cache('clear')         : unload all registered points
+%   DLS.lazy_cache('usage')         : [MB points] loaded and registered
+%   DLS.lazy_cache('add', p, bytes) : used by DLS.Point when it loads its data
+% Every loaded point is registered, whatever the budget, in a map keyed by the
+% point (its cache_key). The points stamp their own accesses (DLS.Point.stamp),
+% nothing is called here while their data are resident; the map is only walked
+% when the budget is exceeded. Where MATLAB has matlab.lang.WeakReference the
+% points are held weakly (a cleared sample is freed and dropped here); otherwise
+% by handle until unloaded or 'clear'.
+ persistent budget refs total next_key
+ if isempty(budget)
+  budget   = Inf;
+  refs     = containers.Map('KeyType', 'double', 'ValueType', 'any');
+  total    = 0;
+  next_key = 0;
+ end
+ out = [];
+ switch cmd
+ case 'add'
+  if point.cache_key == 0
+   next_key        = next_key + 1;
+   point.cache_key = next_key;
+  end
+  if isKey(refs, point.cache_key)	% unloaded meanwhile, registered again
+   entry = refs(point.cache_key);
+   total = total - entry.bytes;
+  end
+  point.stamp = tic;
+  refs(point.cache_key) = struct('ref', reference(point), 'bytes', bytes);
+  total = total + bytes;
+ case 'budget'
+  budget = 2^20 * point;
+  point  = [];
+ case 'clear'
+  entries = values(refs);
+  for i = 1 : length(entries)
+   p = dereference(entries{i}.ref);
+   if ~isempty(p)
+    p.unload();
+   end
+  end
+  remove(refs, keys(refs));
+  total = 0;
+  return
+ case 'usage'
+  total = prune(refs);
+  out   = [ total / 2^20 double(refs.Count) ];
+  return
+ otherwise
+  error('DLS:lazy_cache', 'unknown command %s', cmd);
+ end
+ % evict the least recently used points until the budget is met
+ if total > budget
+  total   = prune(refs);
+  k       = cell2mat(keys(refs));
+  entries = values(refs);
+  points  = cellfun(@(e) dereference(e.ref), entries, 'UniformOutput', false);
+  [tmp order] = sort(cellfun(@(p) double(p.stamp), points));
+  i = 0;
+  while total > budget && i < length(order)
+   i = i + 1;
+   if ~isempty(point) && points{order(i)} == point	% keep the point just loaded
+    continue
+   end
+   total = total - entries{order(i)}.bytes;
+   points{order(i)}.unload();
+   remove(refs, k(order(i)));
+  end
+ end
+end
+
+function r = reference ( point )
+% weak reference to the point where available
+ persistent weak
+ if isempty(weak)
+  weak = exist('matlab.lang.WeakReference', 'class') == 8;
+ end
+ if weak
+  r = matlab.lang.WeakReference(point);
+ else
+  r = point;
+ end
+end
+
+function p = dereference ( r )
+% the point of a reference, [] once deleted
+ if isa(r, 'matlab.lang.WeakReference')
+  p = r.Handle;
+ else
+  p = r;
+ end
+ if isempty(p) || ~isvalid(p)
+  p = [];
+ end
+end
+
+function total = prune ( refs )
+% drop the points deleted or unloaded meanwhile; bytes of the remaining ones
+ total = 0;
+ k     = keys(refs);
+ for i = 1 : length(k)
+  entry = refs(k{i});
+  p     = dereference(entry.ref);
+  if isempty(p) || ~p.loaded
+   remove(refs, k{i});
+  else
+   total = total + entry.bytes;
+  end
+ end
+end
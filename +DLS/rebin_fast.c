@@ -0,0 +1,106 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  rebin_fast.c
+ *
+ *    Description:  MEX shim of the log-spaced rebinning of many correlograms with
+ *                  inverse-variance weights and propagated errors (rb_batch,
+ *                  libls/rebin.c).
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/* check if calling from matlab and include necessary mex.h*/
+#ifdef MATLAB_MEX_FILE
+#include "mex.h"
+#endif
+
+#include "../libls/ls.h"
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  mexFunction
+ *  Description:  comunicate between matlab and c program
+ *
+ *  [tr gr dgr offset_r] = rebin_fast(t, g, dg, offset, per_decade)
+ *
+ *  t, g, dg   : correlograms of all points, concatenated (as DLS.concat_points,
+ *               dg = [] for unit weights), t ascending within every point
+ *  offset     : (n_points + 1) 0-based start indices of every point
+ *  per_decade : points per decade, one for all points or one per point
+ *               (<= 0: the lags of the point are kept)
+ *  tr, gr, dgr: the rebinned correlograms, concatenated (column vectors)
+ *  offset_r   : (n_points + 1) 0-based start indices of the rebinned points
+ * =====================================================================================
+ */
+#ifdef MATLAB_MEX_FILE
+void mexFunction(int nlhs,
+        mxArray *plhs[],
+        int nrhs,
+        const mxArray *prhs[])
+{
+    const double *t, *g, *dg = NULL, *offset, *per_decade;
+    double *tr, *gr, *dgr, *out;
+    int i, n_points, n_data, n_per_decade, m, *off, *off_r;
+    double t0;
+
+    LS_SPAN_BEGIN(t0);
+    if (nrhs < 5)
+        mexErrMsgTxt("usage: [tr gr dgr offset_r] = rebin_fast(t, g, dg, offset, per_decade)");
+    n_data       = (int) mxGetNumberOfElements(prhs[0]);
+    n_points     = (int) mxGetNumberOfElements(prhs[3]) - 1;
+    n_per_decade = (int) mxGetNumberOfElements(prhs[4]);
+    if (n_points < 0 || (int) mxGetNumberOfElements(prhs[1]) != n_data
+            || (!mxIsEmpty(prhs[2]) && (int) mxGetNumberOfElements(prhs[2]) != n_data))
+        mexErrMsgTxt("rebin_fast: t, g and dg must have the same length");
+    if (n_per_decade != 1 && n_per_decade != n_points)
+        mexErrMsgTxt("rebin_fast: per_decade must be a scalar or have one value per point");
+    t          = mxGetPr(prhs[0]);
+    g          = mxGetPr(prhs[1]);
+    if (!mxIsEmpty(prhs[2]))
+        dg = mxGetPr(prhs[2]);
+    offset     = mxGetPr(prhs[3]);
+    per_decade = mxGetPr(prhs[4]);
+
+    off   = mxMalloc((n_points + 1) * sizeof(int));
+    off_r = mxMalloc((n_points + 1) * sizeof(int));
+    for (i = 0; i <= n_points; i++)
+    {
+        off[i] = (int) offset[i];
+        if (off[i] < 0 || off[i] > n_data || (i > 0 && off[i] < off[i - 1]))
+            mexErrMsgTxt("rebin_fast: offsets out of range");
+    }
+    /*  the rebinned points are at most as many as the lags */
+    tr  = mxMalloc((n_data > 0 ? n_data : 1) * sizeof(double));
+    gr  = mxMalloc((n_data > 0 ? n_data : 1) * sizeof(double));
+    dgr = mxMalloc((n_data > 0 ? n_data : 1) * sizeof(double));
+    m   = rb_batch(t, g, dg, off, n_points, per_decade, n_per_decade, tr, gr, dgr, off_r);
+
+    plhs[0] = mxCreateDoubleMatrix(m, 1, mxREAL);
+    plhs[1] = mxCreateDoubleMatrix(m, 1, mxREAL);
+    plhs[2] = mxCreateDoubleMatrix(m, 1, mxREAL);
+    plhs[3] = mxCreateDoubleMatrix(1, n_points + 1, mxREAL);
+    memcpy(mxGetPr(plhs[0]), tr,  m * sizeof(double));
+    memcpy(mxGetPr(plhs[1]), gr,  m * sizeof(double));
+    memcpy(mxGetPr(plhs[2]), dgr, m * sizeof(double));
+    out = mxGetPr(plhs[3]);
+    for (i = 0; i <= n_points; i++)
+        out[i] = off_r[i];
+    mxFree(tr);
+    mxFree(gr);
+    mxFree(dgr);
+    mxFree(off);
+    mxFree(off_r);
+    LS_SPAN_END(t0, LS_MEX, "rebin_fast", NULL);
+}				/* ----------  end of function mexFunction  ---------- */
+#endif
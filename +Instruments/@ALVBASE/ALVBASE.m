@@ -8,13 +8,22 @@ methods
 
     Point           = invoke_read_dynamic_file_fast(self, path);
     Point           = read_dynamic_file   (self, path );
+    Point           = read_dynamic_series (self, paths, channels);
+    Point           = read_dynamic_headers(self, paths, channels);
+    data            = read_autosave_series(self, paths, channels);
     Point           = read_static_file    (self, path );
-    [Point RawData] = read_static(self, path_standard, path_solvent, path_file, protein_conc, dn_over_dc, start_index, end_index, count_number);
+    Point           = read_sta_file       (self, path );
+    [Point RawData] = read_static(self, path_standard, path_solvent, path_file, protein_conc, dn_over_dc, start_index, end_index, count_number, varargin);
 end
 
 methods ( Static )
-    [t gt dgt Angle temperature datetime] = read_dynamic_file_fast( path );
+    [t gt dgt Angle temperature datetime gc mode] = read_dynamic_file_fast( path );
+    [tau G dG Angle T datetime norm serial weight] = read_dynamic_series_fast( paths, limits, formats, channels );
+    [Angle T datetime serial] = read_dynamic_header_fast( paths, formats );
+    [tau G dG Angle T datetime norm serial cr imon trace weight] = read_autosave_series_fast( paths, limits, formats, channels );
     s = read_tol_file(path_of_tol_file);
+    [data counts names] = read_sta_file_fast(path);
+    [data refraction_index] = read_tol_file_fast(path_of_tol_file);
     [count_rate1 count_rate2 I_mon angle temperature datetime] = read_static_from_autosave(path_of_autosave_file);
     [count_rate1 count_rate2 I_mon angle temperature datetime] = read_static_from_autosave_fast(path_of_autosave_file);
     % [s e nc] = find_start_end( path );
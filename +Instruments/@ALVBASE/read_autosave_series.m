@@ -0,0 +1,47 @@
+function data = read_autosave_series ( self, paths, channels )
+    % read the dynamic and the static data of a series of autosave files (cell
+    % array of paths) in one pass per file with read_autosave_series_fast
+    % (written in c), so that a DLS.Sample and an SLS.Sample of the same
+    % measurement share one parse (option 'Autosave' of both, see load_autosave).
+    % output: struct with
+    %   Files                   : the paths
+    %   Point                   : DLS.Point array, as read_dynamic_series
+    %   CR0, CR1, I_mon         : mean count rates [kHz] and monitor diode intensity
+    %   Angle, T, datetime_raw, datetime : of every file (columns, as read_static)
+    %   Trace                   : cell array, [time CR0 CR1] of every file
+    %--------------------------------------------------------------------------
+    % change home directory to full path, since fopen does not recognize
+    %it in C
+    %--------------------------------------------------------------------------
+    files = paths;
+    if nargin < 3
+        channels = 1;
+    end
+    if ~ispc
+        paths = regexprep(paths, '^~', getenv('HOME'));
+    end
+    %==========================================================================
+    % get normalized correlations and static data from all files
+    %==========================================================================
+    [tau G dG angle T datetime norm serial cr imon trace] = self.read_autosave_series_fast( ...
+        paths, [], Instruments.datetime_formats(), channels );
+    %==========================================================================
+    % save the correlations in DLS.Point class, column by column
+    %==========================================================================
+    point(length(paths)) = DLS.Point;
+    for i = 1 : length(paths)
+        point(i)              = DLS.Point;
+        point(i).Instrument   = self;
+        point(i).T            = T(i);
+        point(i).Angle        = angle(i);
+        point(i).Tau          = tau;            % shared lag grid (copy on write)
+        point(i).G            = G(:,i);
+        point(i).dG           = dG(:,i);
+        point(i).norm_raw     = norm(i);
+        point(i).datetime_raw = datetime{i};
+        point(i).datetime     = serial(i);      % parsed natively
+    end
+    data = struct( 'Files', {files}, 'Point', {point}, ...
+        'CR0', cr(1,:)', 'CR1', cr(2,:)', 'I_mon', imon', 'Angle', angle', 'T', T', ...
+        'datetime_raw', {datetime'}, 'datetime', serial', 'Trace', {trace} );
+end
@@ -0,0 +1,192 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  read_autosave_series_fast.c
+ *
+ *    Description:  read the dynamic and the static data of a whole series of ALV
+ *                  autosave files in one pass per file (as_read_file): the
+ *                  correlation functions, normalized and cropped as by
+ *                  read_dynamic_series_fast, and the mean count rates, the monitor
+ *                  diode intensity and the count rate trace as by
+ *                  read_static_from_autosave. One parse feeds DLS.Sample and
+ *                  SLS.Sample (ALVBASE.read_autosave_series). MEX shim of libls
+ *                  (alv_autosave.c, datetime_parse.c).
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/* check if calling from matlab and include necessary mex.h*/
+#ifdef MATLAB_MEX_FILE
+#include "mex.h"
+#include "../../libls/ls_mex.h"
+#endif
+
+/*  the buffers of the call, before an error as at the end */
+static void rd_free(char **formats, int n_formats, double *grid)
+{
+    dt_free_formats(formats, n_formats);
+    mxFree(grid);
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  mexFunction
+ *  Description:  comunicate between matlab and c program
+ *
+ *  [tau G dG angle T datetime norm serial cr imon trace weight] = read_autosave_series_fast(paths, limits, formats, channels)
+ *
+ *  paths, limits, formats, channels, tau ... serial, weight : as read_dynamic_series_fast
+ *  cr     : 2 x n_files mean count rates MeanCR0, MeanCR1 [kHz] (NaN if missing)
+ *  imon   : monitor diode intensity of every file (NaN if missing)
+ *  trace  : cell array, [time CR0 CR1] of the count rate trace of every file (only
+ *           read if requested)
+ *  Files without correlation (static only) give NaN columns of G, dG and norm.
+ *  All files with correlation must share the cropped lag grid (error otherwise).
+ * =====================================================================================
+ */
+#ifdef MATLAB_MEX_FILE
+void mexFunction(int nlhs,
+        mxArray *plhs[],
+        int nrhs,
+        const mxArray *prhs[])
+{
+    double limits[4] = { RS_NORM_MIN, RS_NORM_MAX, RS_CROP_MIN, RS_CROP_MAX };
+    rs_file  *f  = ls_scratch_file();
+    as_trace *cr = nlhs > 10 ? ls_scratch_trace() : NULL;
+    rs_window w;
+    st_file s;
+    mxArray *m;
+    double *grid = NULL, *tau, *G, *dG, *angle, *temperature, *norm, *serial, *rate, *imon, *out;
+    double *weight = NULL;
+    char *path, **formats;
+    int i, k, n_files, n_grid = 0, n_crop = 0, n_formats, hint = -1, select;
+    double t0;
+
+    LS_SPAN_BEGIN(t0);
+    if (nrhs < 1 || !mxIsCell(prhs[0]))
+        mexErrMsgTxt("usage: [tau G dG angle T datetime norm serial cr imon trace weight] = read_autosave_series_fast(paths, limits, formats, channels)");
+    if (nrhs > 1 && mxGetNumberOfElements(prhs[1]) == 4)
+        memcpy(limits, mxGetPr(prhs[1]), 4 * sizeof(double));
+    select    = rs_select_from_matlab(nrhs > 3 ? prhs[3] : NULL);
+    n_formats = dt_formats_from_matlab(nrhs > 2 ? prhs[2] : NULL, &formats);
+    n_files = (int) mxGetNumberOfElements(prhs[0]);
+    ls_mex_init();
+    f->channels = select != 1;
+
+    plhs[0] = NULL;
+    plhs[3] = mxCreateDoubleMatrix(1, n_files, mxREAL);
+    plhs[4] = mxCreateDoubleMatrix(1, n_files, mxREAL);
+    plhs[5] = mxCreateCellMatrix(1, n_files);
+    plhs[6] = mxCreateDoubleMatrix(1, n_files, mxREAL);
+    plhs[7] = mxCreateDoubleMatrix(1, n_files, mxREAL);
+    plhs[8] = mxCreateDoubleMatrix(2, n_files, mxREAL);
+    plhs[9] = mxCreateDoubleMatrix(1, n_files, mxREAL);
+    if (cr)
+        plhs[10] = mxCreateCellMatrix(1, n_files);
+    if (nlhs > 11)
+    {
+        plhs[11] = mxCreateDoubleMatrix(RS_MAX_CHANNELS, n_files, mxREAL);
+        weight   = mxGetPr(plhs[11]);
+    }
+    angle       = mxGetPr(plhs[3]);
+    temperature = mxGetPr(plhs[4]);
+    norm        = mxGetPr(plhs[6]);
+    serial      = mxGetPr(plhs[7]);
+    rate        = mxGetPr(plhs[8]);
+    imon        = mxGetPr(plhs[9]);
+    G = dG = NULL;
+
+    for (i = 0; i < n_files; i++)
+    {
+        path = mxArrayToString(mxGetCell(prhs[0], i));
+        if (!path || (!as_read_file(path, f, &s, cr) && isnan(s.cr0) && isnan(s.imon)))
+        {
+            rd_free(formats, n_formats, grid);
+            mexErrMsgIdAndTxt("read_autosave_series_fast:read", "cannot read %s", path ? path : "(not a string)");
+        }
+        mxFree(path);
+
+        norm[i] = NAN;
+        if (f->n > 0 && select != 1 && !rs_combine(f, select, weight ? weight + (size_t) i * RS_MAX_CHANNELS : NULL))
+        {
+            rd_free(formats, n_formats, grid);
+            mexErrMsgIdAndTxt("read_autosave_series_fast:channels", "no such channel in file %d", i + 1);
+        }
+        if (f->n > 0 && select == 1 && weight)
+            weight[(size_t) i * RS_MAX_CHANNELS] = 1;
+        if (f->n > 0)
+        {
+            /*  windows once per lag grid */
+            if (!grid || f->n != n_grid || memcmp(grid, f->t, n_grid * sizeof(double)) != 0)
+            {
+                if (!ls_windows_cached(f->t, f->n, limits, &w) || w.n1 == w.n0)
+                {
+                    rd_free(formats, n_formats, grid);
+                    mexErrMsgTxt("read_autosave_series_fast: no lags in the normalization window");
+                }
+                if (!grid)
+                {
+                    /*  first grid: allocate the outputs, NaN for the files before */
+                    n_crop  = w.c1 - w.c0;
+                    plhs[0] = mxCreateDoubleMatrix(n_crop, 1, mxREAL);
+                    plhs[1] = mxCreateDoubleMatrix(n_crop, n_files, mxREAL);
+                    plhs[2] = mxCreateDoubleMatrix(n_crop, n_files, mxREAL);
+                    tau = mxGetPr(plhs[0]);
+                    G   = mxGetPr(plhs[1]);
+                    dG  = mxGetPr(plhs[2]);
+                    memcpy(tau, f->t + w.c0, n_crop * sizeof(double));
+                    for (k = 0; k < i * n_crop; k++)
+                        G[k] = dG[k] = NAN;
+                }
+                else if (w.c1 - w.c0 != n_crop ||
+                        memcmp(mxGetPr(plhs[0]), f->t + w.c0, n_crop * sizeof(double)) != 0)
+                {
+                    rd_free(formats, n_formats, grid);
+                    mexErrMsgIdAndTxt("read_autosave_series_fast:grid", "the lag grid of file %d differs from the first file", i + 1);
+                }
+                n_grid = f->n;
+                grid   = mxRealloc(grid, n_grid * sizeof(double));
+                memcpy(grid, f->t, n_grid * sizeof(double));
+            }
+            norm[i] = rs_normalize(f, &w, G + (size_t) i * n_crop, dG + (size_t) i * n_crop);
+        }
+        else if (G)
+            for (k = 0; k < n_crop; k++)
+                G[(size_t) i * n_crop + k] = dG[(size_t) i * n_crop + k] = NAN;
+        angle[i]        = s.angle;
+        temperature[i]  = s.temperature;
+        rate[2 * i]     = s.cr0;
+        rate[2 * i + 1] = s.cr1;
+        imon[i]         = s.imon;
+        mxSetCell(plhs[5], i, mxCreateString(s.datetime));
+        dt_parse(s.datetime, (const char *const *) formats, n_formats, &hint, &serial[i]);
+        if (cr)
+        {
+            m   = mxCreateDoubleMatrix(cr->n, 3, mxREAL);
+            out = mxGetPr(m);
+            memcpy(out,              cr->t,   cr->n * sizeof(double));
+            memcpy(out + cr->n,      cr->cr0, cr->n * sizeof(double));
+            memcpy(out + 2 * cr->n,  cr->cr1, cr->n * sizeof(double));
+            mxSetCell(plhs[10], i, m);
+        }
+    }
+    if (!plhs[0])
+    {
+        plhs[0] = mxCreateDoubleMatrix(0, 1, mxREAL);
+        plhs[1] = mxCreateDoubleMatrix(0, n_files, mxREAL);
+        plhs[2] = mxCreateDoubleMatrix(0, n_files, mxREAL);
+    }
+    rd_free(formats, n_formats, grid);
+    LS_SPAN_END(t0, LS_MEX, "read_autosave_series_fast", NULL);
+}				/* ----------  end of function mexFunction  ---------- */
+#endif
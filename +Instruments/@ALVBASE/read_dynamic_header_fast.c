@@ -0,0 +1,87 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  read_dynamic_header_fast.c
+ *
+ *    Description:  read only the headers of a series of ALV autosave files (date,
+ *                  time, temperature, angle): every file is read up to the
+ *                  "Correlation" line, the correlation data are not touched. Used
+ *                  by the lazy loading of DLS.Sample. MEX shim of libls
+ *                  (rh_read_header, alv_autosave.c).
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/* check if calling from matlab and include necessary mex.h*/
+#ifdef MATLAB_MEX_FILE
+#include "mex.h"
+#include "../../libls/ls_mex.h"
+#endif
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  mexFunction
+ *  Description:  comunicate between matlab and c program
+ *
+ *  [angle T datetime serial] = read_dynamic_header_fast(paths, formats)
+ *
+ *  paths    : cell array with the paths of the autosave files
+ *  formats  : cell array of user date formats (Instruments.datetime_formats), tried
+ *             before the builtin ones
+ *  angle, T : one entry per file (NaN if missing); datetime : cell array of strings
+ *  serial   : serial date numbers of datetime (NaN if no format matches)
+ * =====================================================================================
+ */
+#ifdef MATLAB_MEX_FILE
+void mexFunction(int nlhs,
+        mxArray *plhs[],
+        int nrhs,
+        const mxArray *prhs[])
+{
+    rh_header h;
+    double *angle, *temperature, *serial;
+    char *path, **formats;
+    int i, n_files, n_formats, hint = -1;
+    double t0;
+
+    LS_SPAN_BEGIN(t0);
+    if (nrhs < 1 || !mxIsCell(prhs[0]))
+        mexErrMsgTxt("usage: [angle T datetime serial] = read_dynamic_header_fast(paths, formats)");
+    n_files = (int) mxGetNumberOfElements(prhs[0]);
+    plhs[0] = mxCreateDoubleMatrix(1, n_files, mxREAL);
+    plhs[1] = mxCreateDoubleMatrix(1, n_files, mxREAL);
+    plhs[2] = mxCreateCellMatrix(1, n_files);
+    plhs[3] = mxCreateDoubleMatrix(1, n_files, mxREAL);
+    angle       = mxGetPr(plhs[0]);
+    temperature = mxGetPr(plhs[1]);
+    serial      = mxGetPr(plhs[3]);
+    n_formats = dt_formats_from_matlab(nrhs > 1 ? prhs[1] : NULL, &formats);
+
+    for (i = 0; i < n_files; i++)
+    {
+        path = mxArrayToString(mxGetCell(prhs[0], i));
+        if (!path || !rh_read_header(path, &h))
+        {
+            dt_free_formats(formats, n_formats);
+            mexErrMsgIdAndTxt("read_dynamic_header_fast:read", "cannot read %s", path ? path : "(not a string)");
+        }
+        mxFree(path);
+        angle[i]       = h.angle;
+        temperature[i] = h.temperature;
+        mxSetCell(plhs[2], i, mxCreateString(h.datetime));
+        dt_parse(h.datetime, (const char *const *) formats, n_formats, &hint, &serial[i]);
+    }
+    dt_free_formats(formats, n_formats);
+    LS_SPAN_END(t0, LS_MEX, "read_dynamic_header_fast", NULL);
+}				/* ----------  end of function mexFunction  ---------- */
+#endif
@@ -0,0 +1,25 @@
+function point = read_dynamic_headers ( self, paths, channels )
+    % read only the headers (angle, T, date / time) of a series of dynamic files
+    % with read_dynamic_header_fast (written in c). The correlograms are loaded
+    % by the points on first access of Tau, G or dG (see DLS.lazy_cache).
+    % channels (optional): as read_dynamic_series, kept by the points for the load.
+    if ~ispc
+        paths = regexprep(paths, '^~', getenv('HOME'));
+    end
+    if nargin < 3
+        channels = 1;
+    end
+    [angle T datetime serial] = self.read_dynamic_header_fast( paths, Instruments.datetime_formats() );
+    point(length(paths)) = DLS.Point;
+    for i = 1 : length(paths)
+        point(i)              = DLS.Point;
+        point(i).Instrument   = self;
+        point(i).T            = T(i);
+        point(i).Angle        = angle(i);
+        point(i).datetime_raw = datetime{i};
+        point(i).datetime     = serial(i);
+        point(i).source       = paths{i};
+        point(i).channels     = channels;
+        point(i).loaded       = false;
+    end
+end
@@ -0,0 +1,40 @@
+function point = read_dynamic_series ( self, paths, channels )
+    % read a series of dynamic files (cell array of paths) at once with
+    % read_dynamic_series_fast (written in c), which normalizes and crops all
+    % correlation functions in the same pass (as DLS.Point.correct_G).
+    % channels (optional): correlation channel used, 1 (default) to 4, or the
+    % channels combined: 'weighted', 'all' or 'best' (see DLS.combine_channels).
+    % The points keep only the cropped Tau, G, dG: Tau_raw, G_raw, dG_raw stay empty.
+    % The date / time is converted natively (formats of Instruments.datetime_formats).
+    %--------------------------------------------------------------------------
+    % change home directory to full path, since fopen does not recognize
+    %it in C
+    %--------------------------------------------------------------------------
+    if ~ispc
+        paths = regexprep(paths, '^~', getenv('HOME'));
+    end
+    if nargin < 3
+        channels = 1;
+    end
+    %==========================================================================
+    % get normalized data from all dynamic files
+    %==========================================================================
+    [tau G dG angle T datetime norm serial] = self.read_dynamic_series_fast( paths, [], ...
+        Instruments.datetime_formats(), channels );
+    %==========================================================================
+    % save data in DLS.Point class, column by column
+    %==========================================================================
+    point(length(paths)) = DLS.Point;
+    for i = 1 : length(paths)
+        point(i)              = DLS.Point;
+        point(i).Instrument   = self;
+        point(i).T            = T(i);
+        point(i).Angle        = angle(i);
+        point(i).Tau          = tau;            % shared lag grid (copy on write)
+        point(i).G            = G(:,i);
+        point(i).dG           = dG(:,i);
+        point(i).norm_raw     = norm(i);
+        point(i).datetime_raw = datetime{i};
+        point(i).datetime     = serial(i);      % parsed natively
+    end
+end
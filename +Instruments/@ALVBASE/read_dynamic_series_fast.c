@@ -0,0 +1,169 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  read_dynamic_series_fast.c
+ *
+ *    Description:  read the correlation functions of a whole series of ALV autosave
+ *                  files and normalize / crop them in the same pass (as
+ *                  DLS.Point.correct_G): G and dG are divided by |mean(G)| over the
+ *                  lags 1e-5 < t < 1e-4 ms and cropped to 1e-3 < t < 1e2 ms.
+ *                  The index windows are computed once per lag grid (all files of a
+ *                  series share it, libls keeps the last one between calls), the raw
+ *                  data of a file only lives in the scratch buffer of libls and the
+ *                  cropped, normalized columns are written directly into the output
+ *                  matrices. The date / time of every file is also converted into a
+ *                  serial date number. The channels of the correlation can be
+ *                  combined before (rs_combine). MEX shim of libls (alv_autosave.c,
+ *                  datetime_parse.c).
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/* check if calling from matlab and include necessary mex.h*/
+#ifdef MATLAB_MEX_FILE
+#include "mex.h"
+#include "../../libls/ls_mex.h"
+#endif
+
+/*  the buffers of the call, before an error as at the end */
+static void rd_free(char **formats, int n_formats, double *grid)
+{
+    dt_free_formats(formats, n_formats);
+    mxFree(grid);
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  mexFunction
+ *  Description:  comunicate between matlab and c program
+ *
+ *  [tau G dG angle T datetime norm serial weight] = read_dynamic_series_fast(paths, limits, formats, channels)
+ *
+ *  paths    : cell array with the paths of the autosave files
+ *  limits   : [norm_min norm_max crop_min crop_max] in ms (optional, default as
+ *             correct_G: [1e-5 1e-4 1e-3 1e2])
+ *  tau      : cropped lag times (column), shared by all files
+ *  G, dG    : normalized and cropped correlation functions, one column per file
+ *  formats  : cell array of user date formats (Instruments.datetime_formats), tried
+ *             before the builtin ones
+ *  angle, T, norm : one entry per file; datetime : cell array of strings
+ *  serial   : serial date numbers of datetime (NaN if no format matches)
+ *  channels : correlation used: channel 1 (default) to 4, 'weighted' (inverse-variance
+ *             mean of the pseudo cross pair, channels 1 and 2), 'all' (of all channels)
+ *             or 'best' (channel of the lowest noise), see rs_combine_channels
+ *  weight   : 4 x n_files weights of the channels
+ *  All files must share the cropped lag grid (error otherwise).
+ * =====================================================================================
+ */
+#ifdef MATLAB_MEX_FILE
+void mexFunction(int nlhs,
+        mxArray *plhs[],
+        int nrhs,
+        const mxArray *prhs[])
+{
+    double limits[4] = { RS_NORM_MIN, RS_NORM_MAX, RS_CROP_MIN, RS_CROP_MAX };
+    rs_file  *f = ls_scratch_file();
+    rs_window w;
+    double *grid = NULL, *tau, *G, *dG, *angle, *temperature, *norm, *serial, *weight;
+    char *path, **formats;
+    int i, n_files, n_grid = 0, n_crop = 0, n_formats, hint = -1, select;
+    double t0;
+
+    LS_SPAN_BEGIN(t0);
+    if (nrhs < 1 || !mxIsCell(prhs[0]))
+        mexErrMsgTxt("usage: [tau G dG angle T datetime norm serial weight] = read_dynamic_series_fast(paths, limits, formats, channels)");
+    if (nrhs > 1 && mxGetNumberOfElements(prhs[1]) == 4)
+        memcpy(limits, mxGetPr(prhs[1]), 4 * sizeof(double));
+    select    = rs_select_from_matlab(nrhs > 3 ? prhs[3] : NULL);
+    n_formats = dt_formats_from_matlab(nrhs > 2 ? prhs[2] : NULL, &formats);
+    n_files = (int) mxGetNumberOfElements(prhs[0]);
+    ls_mex_init();
+    f->channels = select != 1;
+
+    plhs[0] = NULL;
+    plhs[3] = mxCreateDoubleMatrix(1, n_files, mxREAL);
+    plhs[4] = mxCreateDoubleMatrix(1, n_files, mxREAL);
+    plhs[5] = mxCreateCellMatrix(1, n_files);
+    plhs[6] = mxCreateDoubleMatrix(1, n_files, mxREAL);
+    plhs[7] = mxCreateDoubleMatrix(1, n_files, mxREAL);
+    plhs[8] = mxCreateDoubleMatrix(RS_MAX_CHANNELS, n_files, mxREAL);
+    angle       = mxGetPr(plhs[3]);
+    temperature = mxGetPr(plhs[4]);
+    norm        = mxGetPr(plhs[6]);
+    serial      = mxGetPr(plhs[7]);
+    weight      = mxGetPr(plhs[8]);
+    G = dG = NULL;
+
+    for (i = 0; i < n_files; i++)
+    {
+        path = mxArrayToString(mxGetCell(prhs[0], i));
+        if (!path || !rs_read_file(path, f))
+        {
+            rd_free(formats, n_formats, grid);
+            mexErrMsgIdAndTxt("read_dynamic_series_fast:read", "cannot read %s", path ? path : "(not a string)");
+        }
+        mxFree(path);
+        if (select == 1)
+            weight[(size_t) i * RS_MAX_CHANNELS] = 1;
+        else if (!rs_combine(f, select, weight + (size_t) i * RS_MAX_CHANNELS))
+        {
+            rd_free(formats, n_formats, grid);
+            mexErrMsgIdAndTxt("read_dynamic_series_fast:channels", "no such channel in file %d", i + 1);
+        }
+
+        /*  windows once per lag grid */
+        if (!grid || f->n != n_grid || memcmp(grid, f->t, n_grid * sizeof(double)) != 0)
+        {
+            if (!ls_windows_cached(f->t, f->n, limits, &w) || w.n1 == w.n0)
+            {
+                rd_free(formats, n_formats, grid);
+                mexErrMsgTxt("read_dynamic_series_fast: no lags in the normalization window");
+            }
+            if (!grid)
+            {
+                /*  first grid: allocate the outputs */
+                n_crop  = w.c1 - w.c0;
+                plhs[0] = mxCreateDoubleMatrix(n_crop, 1, mxREAL);
+                plhs[1] = mxCreateDoubleMatrix(n_crop, n_files, mxREAL);
+                plhs[2] = mxCreateDoubleMatrix(n_crop, n_files, mxREAL);
+                tau = mxGetPr(plhs[0]);
+                G   = mxGetPr(plhs[1]);
+                dG  = mxGetPr(plhs[2]);
+                memcpy(tau, f->t + w.c0, n_crop * sizeof(double));
+            }
+            else if (w.c1 - w.c0 != n_crop ||
+                    memcmp(mxGetPr(plhs[0]), f->t + w.c0, n_crop * sizeof(double)) != 0)
+            {
+                rd_free(formats, n_formats, grid);
+                mexErrMsgIdAndTxt("read_dynamic_series_fast:grid", "the lag grid of file %d differs from the first file", i + 1);
+            }
+            n_grid = f->n;
+            grid   = mxRealloc(grid, n_grid * sizeof(double));
+            memcpy(grid, f->t, n_grid * sizeof(double));
+        }
+        norm[i] = rs_normalize(f, &w, G + (size_t) i * n_crop, dG + (size_t) i * n_crop);
+        angle[i]       = f->angle;
+        temperature[i] = f->temperature;
+        mxSetCell(plhs[5], i, mxCreateString(f->datetime));
+        dt_parse(f->datetime, (const char *const *) formats, n_formats, &hint, &serial[i]);
+    }
+    if (!plhs[0])
+    {
+        plhs[0] = mxCreateDoubleMatrix(0, 1, mxREAL);
+        plhs[1] = mxCreateDoubleMatrix(0, 0, mxREAL);
+        plhs[2] = mxCreateDoubleMatrix(0, 0, mxREAL);
+    }
+    rd_free(formats, n_formats, grid);
+    LS_SPAN_END(t0, LS_MEX, "read_dynamic_series_fast", NULL);
+}				/* ----------  end of function mexFunction  ---------- */
+#endif
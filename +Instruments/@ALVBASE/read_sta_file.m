@@ -0,0 +1,21 @@
+function point = read_sta_file (self, path )
+% read SLS data (Kc/R per angle) from the binary status file .sta written by
+% the ALV software for every series (read_sta_file_fast), instead of the
+% text table read by read_static_file
+ min_error = 1e-4;                              % smallest accepted relative error [%]
+
+ data      = Instruments.ALVBASE.read_sta_file_fast( path );
+ point     = SLS.Point;
+ for i = 1 : size(data, 1)
+  kcr  = data(i,3);
+  dkcr = max(data(i,4), 0.01 * min_error * kcr);
+
+  point(i) = SLS.Point;
+  point(i).Instrument = self;
+  point(i).T          = data(i,2);
+  point(i).Angle      = data(i,1);
+  point(i).KcR_raw    = kcr;
+  point(i).dKcR_raw   = dkcr;
+ end
+
+end	% read_sta_file
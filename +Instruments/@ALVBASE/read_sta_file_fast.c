@@ -0,0 +1,109 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  read_sta_file_fast.c
+ *
+ *    Description:  decode the binary status file (.sta) written by the ALV software for
+ *                  every static series: matlab interface of sta_read
+ *                  (libls/alv_static.c, the layout of the records is described there).
+ *                  The file has no count rates or monitor intensities: these are only
+ *                  in the autosave .ASC files.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/* check if calling from matlab and include necessary mex.h*/
+#ifdef MATLAB_MEX_FILE
+#include "mex.h"
+#include "../../libls/ls_mex.h"
+#endif
+
+#define STA_COLUMNS      11
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  mexFunction
+ *  Description:  comunicate between matlab and c program
+ *
+ *  [data counts names] = read_sta_file_fast(path)
+ *
+ *  data   : (n_angles x 11) columns angle [deg], T [K], KcR, dKcR, conc [g/ml],
+ *           dndc [ml/g], wavelength [nm], viscosity [cP], n_solvent, n_standard,
+ *           rayleigh_ratio of the standard [1/cm]
+ *  counts : (n_angles x 12) value, error of the single counts (NaN if absent)
+ *  names  : {sample, solvent, standard} of the first record (quotes kept)
+ * =====================================================================================
+ */
+#ifdef MATLAB_MEX_FILE
+void mexFunction(int nlhs,
+        mxArray *plhs[],
+        int nrhs,
+        const mxArray *prhs[])
+{
+    sta_record *r;
+    char *path;
+    double *d, *c;
+    int n, i, j;
+    double t0;
+
+    LS_SPAN_BEGIN(t0);
+    if (nrhs < 1 || !mxIsChar(prhs[0]))
+        mexErrMsgTxt("usage: [data counts names] = read_sta_file_fast(path)");
+    path = mxArrayToString(prhs[0]);
+    n = sta_read(path, &r);
+    if (n < 0)
+    {
+        mxFree(path);
+        mexErrMsgTxt("read_sta_file_fast: cannot read the .sta file");
+    }
+
+    plhs[0] = mxCreateDoubleMatrix(n, STA_COLUMNS, mxREAL);
+    plhs[1] = mxCreateDoubleMatrix(n, 2 * STA_MAX_COUNTS, mxREAL);
+    plhs[2] = mxCreateCellMatrix(1, 3);
+    d = mxGetPr(plhs[0]);
+    c = mxGetPr(plhs[1]);
+    for (i = 0; i < n; i++)
+    {
+        d[i]         = r[i].angle;
+        d[n + i]     = r[i].T;
+        d[2 * n + i] = r[i].KcR;
+        d[3 * n + i] = r[i].dKcR;
+        d[4 * n + i] = r[i].conc;
+        d[5 * n + i] = r[i].dndc;
+        d[6 * n + i] = r[i].wavelength;
+        d[7 * n + i] = r[i].viscosity;
+        d[8 * n + i] = r[i].n_solvent;
+        d[9 * n + i] = r[i].n_standard;
+        d[10 * n + i] = r[i].rayleigh_ratio;
+        /*  pairs are filled from the first: a zero pair ends the counts */
+        for (j = 0; j < STA_MAX_COUNTS; j++)
+        {
+            if (r[i].count[2 * j] == 0 && r[i].count[2 * j + 1] == 0)
+                break;
+            c[2 * j * n + i]       = r[i].count[2 * j];
+            c[(2 * j + 1) * n + i] = r[i].count[2 * j + 1];
+        }
+        for (; j < STA_MAX_COUNTS; j++)
+            c[2 * j * n + i] = c[(2 * j + 1) * n + i] = NAN;
+    }
+    if (n > 0)
+    {
+        mxSetCell(plhs[2], 0, mxCreateString(r[0].sample));
+        mxSetCell(plhs[2], 1, mxCreateString(r[0].solvent));
+        mxSetCell(plhs[2], 2, mxCreateString(r[0].standard));
+    }
+    free(r);
+    LS_SPAN_END(t0, LS_MEX, "read_sta_file_fast", path);
+    mxFree(path);
+}				/* ----------  end of function mexFunction  ---------- */
+#endif
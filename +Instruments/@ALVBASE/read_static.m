@@ -7,8 +7,18 @@ function [sls_point RawData] = read_static(self,path_standard, path_solvent, pat
     % and protein concentration, differential index of refraction. 
     % furthermore start_index and end_index are the file indices which to load
     %
+    %optional name / value pairs:
+    %   'Outliers'         : rejection of outlying count rates per angle,
+    %                        'none' (default), 'mad', 'sigma' or 'hampel'
+    %                        (see SLS.reject_outliers: needs >= 7 counts per angle)
+    %   'OutlierThreshold' : threshold in standard deviations (default 3)
+    %   'OutlierWindow'    : half width of the hampel window (default 3)
+    %   'Autosave'         : struct of read_autosave_series of the same files: the
+    %                        autosave files are not read again
+    %
     %output : [Point SlsData]
     %SlsData is AngleData class array with single file-data info
+    %RawData.Rejected lists the file_index [i j] of every rejected count
 %******************************************************************************
 % Written By: Daniel Soraruf
 % last change : 19/02/2012
@@ -16,10 +26,21 @@ function [sls_point RawData] = read_static(self,path_standard, path_solvent, pat
     %------------------------------------------------------------------------------
     % get solvent and standard data
     %------------------------------------------------------------------------------
+    options = struct('Outliers', 'none', 'OutlierThreshold', 3, 'OutlierWindow', 3, 'Autosave', []);
+    for i = 1 : 2 : length(varargin)
+        options.(varargin{i}) = varargin{i + 1};
+    end
     solvent  = self.read_tol_file(path_solvent);
     standard = self.read_tol_file(path_standard);
+    n_counts = (end_index - start_index + 1) * count_number;
+    cr0      = zeros(n_counts, 1);
+    cr1      = zeros(n_counts, 1);
+    I_mon    = zeros(n_counts, 1);
+    angle    = zeros(n_counts, 1);
+    T        = zeros(n_counts, 1);
+    file_index   = zeros(n_counts, 2);
+    datetime_raw = cell(n_counts, 1);
     index    = 0;
-    point(end_index - start_index + 1) = struct('scatt_angle', 0, 'count_rate', 0, 'monitor_intensity', 0, 'error_count_rate', 0);
     %------------------------------------------------------------------------------
     % get data from autosave ALV files
     %------------------------------------------------------------------------------
@@ -33,20 +54,14 @@ function [sls_point RawData] = read_static(self,path_standard, path_solvent, pat
         end
             path_file     = [homepath path_file(2:end)];
     end
+    files = cell(n_counts, 1);
     for i = start_index : end_index
         flag = true;
         j = 1;
         while flag
             index = index + 1;
-            file  = self.generate_filename(path_file, i, j);
-             % [count_rate1 count_rate2 point(index).monitor_intensity point(index).scatt_angle point(index).temperature datetime]...
-             % = self.read_static_from_autosave_fast(file);
-             [count_rate1 count_rate2 point(index).monitor_intensity point(index).scatt_angle point(index).temperature datetime]...
-             = self.read_static_from_autosave(file);
-            point(index).count_rate       = count_rate1 + count_rate2;
-            point(index).error_count_rate = sqrt(count_rate1 * 1000) + sqrt(count_rate2 * 1000);
-            point(index).file_index       = [i j];
-            point(index).datetime_raw     = datetime;
+            files{index} = self.generate_filename(path_file, i, j);
+            file_index(index,:) = [i j];
             if j >= count_number
                 flag = false;
             else
@@ -54,48 +69,69 @@ function [sls_point RawData] = read_static(self,path_standard, path_solvent, pat
             end
         end
     end
-    regexpstr = Instruments.get_datetime_format(point(1).datetime_raw);
-    if ~isempty(regexpstr)
-        for i = 1 : length(point)
-            point(i).datetime = datenum(point(i).datetime_raw, regexpstr);
+    if ~isempty(options.Autosave)
+        % one parse shared with the DLS sample (read_autosave_series)
+        data = options.Autosave;
+        if ~isequal(regexprep(data.Files(:), '^~', getenv('HOME')), files)
+            error('The autosave data do not match the files of the sample!');
         end
-        datetime_bool = true;
+        cr0          = data.CR0;
+        cr1          = data.CR1;
+        I_mon        = data.I_mon;
+        angle        = data.Angle;
+        T            = data.T;
+        datetime_raw = data.datetime_raw;
+        datetime     = data.datetime;           % parsed natively
     else
-        for i = 1 : length(point)
-            point(i).datetime = false;
+        for index = 1 : n_counts
+             % [cr0(index) cr1(index) I_mon(index) angle(index) T(index) datetime_raw{index}]...
+             % = self.read_static_from_autosave_fast(files{index});
+             [cr0(index) cr1(index) I_mon(index) angle(index) T(index) datetime_raw{index}]...
+             = self.read_static_from_autosave(files{index});
         end
-        datetime_bool = false;
-        warning('wrong format regular expression for datetime extraction: change Instrument.get_datetime_format to correct format please')
+        datetime = Instruments.parse_datetime(datetime_raw);
     end
-    %[KcR] = calc_kc_over_r(scatt_angle, standard, solvent,cr_mean,0.001, Imean);
-    % find all angles in file
-    a = unique([point.scatt_angle]);
-    % sort them ( to be consistent with the program generated file)
-    angles = sort(a);
-    % preallocate memory
-    SlsData = SLS.AngleData.empty(length(angles),0);
-    angle_tolerance = 1e-3;
-    for index = 1 : length(angles)
-        SlsData(index) = SLS.AngleData(angles(index));
-        for index_1 = 1 : length(point);
-            % save data at ONE ANGLE in SlsData
-            if abs(point(index_1).scatt_angle - angles(index)) < angle_tolerance
-                SlsData(index).add(point(index_1));
-            end
-        end
+    datetime_bool = ~all(isnan(datetime));
+    if ~datetime_bool
+        warning('datetime format not found, please register it with Instruments.datetime_formats(''add'', format)')
     end
     %--------------------------------------------------------------------------
-    % calc Kc over R
+    % group the counts by angle and calc Kc over R (one native pass)
+    %--------------------------------------------------------------------------
+    count_rate      = cr0 + cr1;
+    angle_tolerance = 1e-3;
+    red = SLS.reduce_angles(angle, count_rate, I_mon, T, standard, solvent, ...
+        protein_conc, dn_over_dc, self, angle_tolerance);
+    %--------------------------------------------------------------------------
+    % reject outlying count rates (dust) and reduce the kept counts again
     %--------------------------------------------------------------------------
-    for i = 1 : length(SlsData)
-        SlsData(i).calc_kc_over_r(standard, solvent, protein_conc, dn_over_dc,self);
-        %SlsData(i).show_cr();
+    keep  = SLS.reject_outliers(count_rate, red.Group, options.Outliers, ...
+        options.OutlierThreshold, options.OutlierWindow);
+    group = red.Group;
+    if ~all(keep)
+        warning('ALVBASE:read_static:rejected', ['%d of %d counts rejected as outliers (%s), ' ...
+            'listed in RawData.Rejected'], sum(~keep), n_counts, options.Outliers);
+        red = SLS.reduce_angles(angle(keep), count_rate(keep), I_mon(keep), T(keep), ...
+            standard, solvent, protein_conc, dn_over_dc, self, angle_tolerance);
     end
+    point = struct('scatt_angle', num2cell(angle), ...
+        'count_rate'       , num2cell(count_rate), ...
+        'monitor_intensity', num2cell(I_mon), ...
+        'error_count_rate' , num2cell(sqrt(cr0 * 1000) + sqrt(cr1 * 1000)), ...
+        'file_index'       , num2cell(file_index, 2), ...
+        'temperature'      , num2cell(T), ...
+        'datetime_raw'     , datetime_raw, ...
+        'datetime'         , num2cell(datetime));
     %--------------------------------------------------------------------------
-    % Save into SLS.Point array
+    % Save into AngleData and SLS.Point arrays
     %--------------------------------------------------------------------------
-    %disp(SlsData(1).KcR)
-    for i = 1 : length(SlsData)
+    kept    = point(keep);
+    SlsData = SLS.AngleData.empty(length(red.Angle),0);
+    for i = 1 : length(red.Angle)
+        SlsData(i) = SLS.AngleData(red.Angle(i));
+        SlsData(i).set_reduction(kept(red.Group == i), red, i);
+        SlsData(i).rejected = point(~keep & group == i);
+
         sls_point(i)              = SLS.Point;
         sls_point(i).Instrument   = self;
         sls_point(i).T            = SlsData(i).mean_temperature;
@@ -112,4 +148,8 @@ function [sls_point RawData] = read_static(self,path_standard, path_solvent, pat
     RawData.SlsData  = SlsData;
     RawData.solvent  = solvent;
     RawData.standard = standard;
+    RawData.Rejected = file_index(~keep,:);
+    % streaming statistics of the counts, e.g. to merge with further runs
+    RawData.Accumulator = SLS.Accumulator(angle_tolerance);
+    RawData.Accumulator.add(angle(keep), count_rate(keep), I_mon(keep), T(keep));
 end
@@ -1,5 +1,11 @@
 function point = read_static_file (self, path )
 % read SLS data from files for the ALV CGS3 goniometer at ILL, Grenoble
+% (binary .sta status files are decoded by read_sta_file)
+ [ tmp tmp ext ] = fileparts( path );
+ if strcmpi( ext, '.sta' )
+  point = self.read_sta_file( path );
+  return
+ end
  i = 0;
  point     = SLS.Point;
  min_error = 1e-4;                              % smallest accepted relative error
@@ -0,0 +1,72 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  read_tol_file_fast.c
+ *
+ *    Description:  read standard / solvent .tol files of the ALV instrument: matlab
+ *                  interface of tol_cached (libls/alv_static.c), which parses a file
+ *                  once and keeps it while it does not change on disk.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* check if calling from matlab and include necessary mex.h*/
+#ifdef MATLAB_MEX_FILE
+#include "mex.h"
+#include "../../libls/ls_mex.h"
+#endif
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  mexFunction
+ *  Description:  comunicate between matlab and c program
+ *
+ *  [data n] = read_tol_file_fast(path)
+ *  read_tol_file_fast()            : empty the cache (no path: any string is a file)
+ *
+ *  data : (rows x 12) columns of the file (scatt_angle, q2_scatt, count_rate, ...)
+ *  n    : refraction index (third line)
+ * =====================================================================================
+ */
+#ifdef MATLAB_MEX_FILE
+void mexFunction(int nlhs,
+        mxArray *plhs[],
+        int nrhs,
+        const mxArray *prhs[])
+{
+    const tol_file *tol;
+    char *path;
+    double t0;
+
+    LS_SPAN_BEGIN(t0);
+    ls_mex_init();
+    if (nrhs == 0)
+    {
+        tol_clear_cache();
+        return;
+    }
+    if (!mxIsChar(prhs[0]))
+        mexErrMsgTxt("usage: [data n] = read_tol_file_fast(path), read_tol_file_fast() empties the cache");
+    path = mxArrayToString(prhs[0]);
+    tol = tol_cached(path);
+    if (!tol)
+    {
+        mxFree(path);
+        mexErrMsgTxt("read_tol_file_fast: cannot read the .tol file");
+    }
+    plhs[0] = mxCreateDoubleMatrix(tol->rows, TOL_COLUMNS, mxREAL);
+    memcpy(mxGetPr(plhs[0]), tol->data, tol->rows * TOL_COLUMNS * sizeof(double));
+    plhs[1] = mxCreateDoubleScalar(tol->refraction_index);
+    LS_SPAN_END(t0, LS_MEX, "read_tol_file_fast", path);
+    mxFree(path);
+}				/* ----------  end of function mexFunction  ---------- */
+#endif
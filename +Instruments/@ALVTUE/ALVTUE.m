@@ -1,9 +1,5 @@
 classdef ALVTUE < Instruments.ALVBASE
 % This class describes the features of the ALV light scattering instrument at IAP Tübingen
-properties
-    attenuator;
-end
-
 
  properties ( Constant )
   Goniometer	= 'ALV-CGS3';
@@ -14,14 +10,19 @@ end
                 'Max',	150	);
   T		= struct(	'Min',	-Constants.T0,	...	% Minimal T = 0°C
                 'Max',	-Constants.T0+45	);	% Maximal T = 45°C
-%attenuators values	
+  % attenuators, sorted by the nominal monitor intensity (attenuator_fast, SLS.attenuator_correction):
+  % transmission [%] and correction of the intensity (product of the factors of this and of
+  % the attenuators with higher transmission; 1 without attenuator).
+  % Monitor: 100%, 33% and 10% measured on the example data (2010_03_27_FZ, 2010_03_28_FZ),
+  % the lower ones scaled from the 10% one by the ratios of the former table (3.15e5 at 10%).
+  % A point matches an attenuator only within the factor Tolerance of its monitor
+  % intensity (neighbours are at least 2.6 apart), otherwise its Kc/R is NaN.
+  Attenuator	= struct(	'Monitor',	[ 886	2660	14550	56270	146900	452200	1632000	],	...
+                'Transmission',	[ 0.1	0.3	1	3	10	33	100	],	...
+                'Correction',	fliplr(cumprod(fliplr([ 1.06	1.8	1.169	1.0713	1.039	1.06	1	]))),	...
+                'Tolerance',	1.5 );
  end
 
-%  methods
-% function self = ALVTUE ( self )
-% 	self.attenuator = self.get_attenuator_corrections();
-%  end
-%  end
  methods ( Static )
 
      % read static from table
@@ -37,34 +38,11 @@ end
   [ s e nc] = find_start_end ( path )
   fname = generate_filename(path_file, angle_index, count_index)
     function [att] = get_attenuator_corrections()
-        att(7).monitor_intensity = 2960000;
-        att(7).intensity_correction = 1;
-        att(7).percent_transmission = 100;
-        
-        att(6).monitor_intensity = 870000;
-        att(6).intensity_correction = 1.06   * att(7).intensity_correction;
-        att(6).percent_transmission = 33;
-
-        att(5).monitor_intensity = 315000;
-        att(5).intensity_correction = 1.039   * att(6).intensity_correction;
-        att(5).percent_transmission = 10;
-
-        att(4).monitor_intensity = 120657;
-        att(4).intensity_correction = 1.0713 * att(5).intensity_correction;
-        att(4).percent_transmission = 3;
-
-        att(3).monitor_intensity = 31200;
-        att(3).intensity_correction = 1.169    * att(4).intensity_correction;
-        att(3).percent_transmission = 1;
-
-        att(2).monitor_intensity = 5700;
-        att(2).intensity_correction = 1.8      * att(3).intensity_correction;
-        att(2).percent_transmission = 0.3;
-
-        att(1).monitor_intensity = 1;
-        att(1).intensity_correction = 1.06   * att(2).intensity_correction;
-        att(1).percent_transmission = 0.1;
-
+    % struct array of the table Attenuator, one entry per attenuator
+        t   = Instruments.ALVTUE.Attenuator;
+        att = struct('monitor_intensity', num2cell(t.Monitor), ...
+            'intensity_correction', num2cell(t.Correction), ...
+            'percent_transmission', num2cell(t.Transmission));
     end
 end
 
@@ -0,0 +1,30 @@
+classdef Malvern
+% This class describes the features of the Malvern Zetasizer Nano (non invasive backscattering)
+
+ properties ( Constant )
+
+  Goniometer	= 'Zetasizer Nano';
+  Correlator	= 'Zetasizer Nano';
+  Lambda	= 6328;
+  Unit_Lambda	= 'A';
+  Angles	= struct(	'Min',	173,	...
+				'Max',	173	);
+  T		= struct(	'Min',	-Constants.T0,	...	% Minimal T = 0°C
+				'Max',	-Constants.T0+90	);	% Maximal T = 90°C
+
+ end
+
+ methods
+
+  Point	= read_dynamic_table	( self, path );
+  s	= read_static_log	( self, path );
+
+ end
+
+ methods ( Static )
+
+  [tau G T angle name datetime] = read_malvern_fast( path );
+
+ end
+
+end
@@ -0,0 +1,43 @@
+function point = read_dynamic_table ( self, path )
+    % read all correlograms of a Zetasizer export table at once with
+    % read_malvern_fast (written in c): lag times in ms as the ALV files, decimal
+    % commas of localized exports are accepted.
+    % The Zetasizer has no channels below 0.5 mus, so G is normalized by its
+    % mean below 10 mus (instead of 10-100 ns as DLS.Point.correct_G), then
+    % cropped as correct_G. The export has no errors: dG_raw is 1.
+    %--------------------------------------------------------------------------
+    % change home directory to full path, since fopen does not recognize
+    %it in C
+    %--------------------------------------------------------------------------
+    if ~ispc
+        path = regexprep(path, '^~', getenv('HOME'));
+    end
+    [tau G T angle name datetime] = self.read_malvern_fast( path );
+    if isempty(G)
+        error(['No correlation data in ' path]);
+    end
+    point(size(G, 2)) = DLS.Point;
+    for i = 1 : size(G, 2)
+        ok   = ~isnan(tau(:,i)) & ~isnan(G(:,i));
+        t    = tau(ok,i);
+        g    = G(ok,i);
+        norm = abs(mean( g( t < 1e-2 ) ));
+        crop = ( t > 1e-3 ) & ( t < 1e2 );
+        if isnan(angle(i))
+            angle(i) = self.Angles.Max;
+        end
+
+        point(i)              = DLS.Point;
+        point(i).Instrument   = self;
+        point(i).T            = T(i);
+        point(i).Angle        = angle(i);
+        point(i).Tau_raw      = t;
+        point(i).G_raw        = g;
+        point(i).dG_raw       = ones(size(g));
+        point(i).Tau          = t(crop);
+        point(i).G            = g(crop) / norm;
+        point(i).dG           = ones(sum(crop), 1) / norm;
+        point(i).norm_raw     = norm;
+        point(i).datetime_raw = datetime{i};
+    end
+end
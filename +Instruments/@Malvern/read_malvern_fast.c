@@ -0,0 +1,95 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  read_malvern_fast.c
+ *
+ *    Description:  read the tab separated export tables of the Malvern Zetasizer
+ *                  software: matlab interface of mv_read (libls/malvern.c, one
+ *                  streaming pass, columns found by name, decimal commas).
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/* check if calling from matlab and include necessary mex.h*/
+#ifdef MATLAB_MEX_FILE
+#include "mex.h"
+#include "../../libls/ls_mex.h"
+#endif
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  mexFunction
+ *  Description:  comunicate between matlab and c program
+ *
+ *  [tau G T angle name datetime] = read_malvern_fast(path)
+ *
+ *  tau, G   : (n_channels x n_records) lag times [ms] and raw correlation functions,
+ *             NaN padded if the records have different numbers of channels
+ *  T, angle : (1 x n_records) temperature [K] and angle [deg], NaN if not exported
+ *  name, datetime : (1 x n_records) cell arrays of strings
+ * =====================================================================================
+ */
+#ifdef MATLAB_MEX_FILE
+void mexFunction(int nlhs,
+        mxArray *plhs[],
+        int nrhs,
+        const mxArray *prhs[])
+{
+    mv_records rec;
+    char *path;
+    double *tau, *g, *T, *angle;
+    int i, j, m = 0, ok;
+    double t0;
+
+    LS_SPAN_BEGIN(t0);
+    if (nrhs < 1 || !mxIsChar(prhs[0]))
+        mexErrMsgTxt("usage: [tau G T angle name datetime] = read_malvern_fast(path)");
+    path = mxArrayToString(prhs[0]);
+    ok = mv_read(path, &rec);
+    if (!ok)
+    {
+        mxFree(path);
+        mv_free(&rec);
+        mexErrMsgTxt("read_malvern_fast: cannot read the file");
+    }
+    for (i = 0; i < rec.n; i++)
+        if (rec.r[i].n_channels > m)
+            m = rec.r[i].n_channels;
+
+    plhs[0] = mxCreateDoubleMatrix(m, rec.n, mxREAL);
+    plhs[1] = mxCreateDoubleMatrix(m, rec.n, mxREAL);
+    plhs[2] = mxCreateDoubleMatrix(1, rec.n, mxREAL);
+    plhs[3] = mxCreateDoubleMatrix(1, rec.n, mxREAL);
+    plhs[4] = mxCreateCellMatrix(1, rec.n);
+    plhs[5] = mxCreateCellMatrix(1, rec.n);
+    tau   = mxGetPr(plhs[0]);
+    g     = mxGetPr(plhs[1]);
+    T     = mxGetPr(plhs[2]);
+    angle = mxGetPr(plhs[3]);
+    for (i = 0; i < rec.n; i++)
+    {
+        for (j = 0; j < m; j++)
+        {
+            tau[i * m + j] = j < rec.r[i].n_channels ? rec.r[i].tau[j] : NAN;
+            g[i * m + j]   = j < rec.r[i].n_channels ? rec.r[i].g[j] : NAN;
+        }
+        T[i]     = rec.r[i].T;
+        angle[i] = rec.r[i].angle;
+        mxSetCell(plhs[4], i, mxCreateString(rec.r[i].name));
+        mxSetCell(plhs[5], i, mxCreateString(rec.r[i].datetime));
+    }
+    mv_free(&rec);
+    LS_SPAN_END(t0, LS_MEX, "read_malvern_fast", path);
+    mxFree(path);
+}				/* ----------  end of function mexFunction  ---------- */
+#endif
@@ -0,0 +1,61 @@
+function s = read_static_log ( self, path )
+    % read the log of a Zetasizer static (Debye) measurement:
+    %   s.T_set    : temperature set [K]
+    %   s.Dark     : dark count rate [kcps]
+    %   s.Standard : count rates of the scattering standard [kcps]
+    %   s.Solvent  : count rates of the solvent [kcps]
+    %   s.Sample   : struct array, C [g/ml] and CR [kcps] of every sample
+    % Counts followed by 'Repeating measurement' (failed checks of the
+    % software) are dropped. Decimal commas are accepted.
+    txt = strrep(fileread(path), ',', '.');
+    % sections: title between two dashed lines, then the body
+    parts = regexp(txt, '\r?\n-{10,}\r?\n', 'split');
+    s.T_set    = NaN;
+    s.Dark     = NaN;
+    s.Standard = [];
+    s.Solvent  = [];
+    s.Sample   = struct('C', {}, 'CR', {});
+    for i = 2 : 2 : length(parts) - 1
+        title = strtrim(parts{i});
+        body  = parts{i + 1};
+        cr    = counts(body);
+        switch title
+        case 'Initialisation'
+            tok = regexp(body, 'temperature to ([\d.]+)', 'tokens', 'once');
+            if ~isempty(tok)
+                s.T_set = str2double(tok{1}) - Constants.T0;
+            end
+        case 'Dark count measurement'
+            tok = regexp(body, 'Dark count: ([\d.]+) kcps', 'tokens', 'once');
+            if ~isempty(tok)
+                s.Dark = str2double(tok{1});
+            end
+        case 'Scattering standard measurement'
+            s.Standard = [ s.Standard cr ];
+        case 'Solvent only measurement'
+            s.Solvent  = [ s.Solvent cr ];
+        case 'Sample measurement'
+            if isempty(cr)                  % interrupted measurement
+                continue
+            end
+            tok = regexp(body, 'Sample concentration: ([\d.eE+-]+) g/mL', 'tokens', 'once');
+            k = length(s.Sample) + 1;
+            s.Sample(k).C  = NaN;
+            if ~isempty(tok)
+                s.Sample(k).C = str2double(tok{1});
+            end
+            s.Sample(k).CR = cr;
+        end
+    end
+end
+
+% accepted count rates of a section body
+function cr = counts ( body )
+    tok = regexp(body, 'count: ([\d.]+) kcps(\r?\nRaw Std Dev[^\n]*)?(\r?\nRepeating)?', 'tokens');
+    cr  = [];
+    for i = 1 : length(tok)
+        if length(tok{i}) < 3 || isempty(tok{i}{3})
+            cr(end + 1) = str2double(tok{i}{1});
+        end
+    end
+end
@@ -0,0 +1,93 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  attenuator_fast.c
+ *
+ *    Description:  MEX shim of the attenuator classification and Kc/R correction of
+ *                  libls (at_correct, libls/attenuator.c): all points of all samples
+ *                  in one call.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/* check if calling from matlab and include necessary mex.h*/
+#ifdef MATLAB_MEX_FILE
+#include "mex.h"
+#include "../libls/ls_mex.h"
+#endif
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  mexFunction
+ *  Description:  comunicate between matlab and c program
+ *
+ *  [KcR_corr dKcR_corr index] = attenuator_fast(monitor, factor, Imon, KcR, dKcR, tol)
+ *
+ *  monitor, factor : table of the instrument: nominal monitor intensity of every
+ *                    attenuator (sorted ascending) and its intensity correction
+ *  Imon, KcR, dKcR : one entry per point (dKcR may be [])
+ *  tol             : accepted ratio of Imon to the nominal intensity (optional,
+ *                    default 1.5: Imon within monitor / 1.5 ... monitor * 1.5)
+ *  KcR_corr ...    : KcR and dKcR times the correction, NaN (with a warning) if Imon
+ *                    matches no attenuator
+ *  index           : attenuator of every point (1-based), 0 if not classified
+ * =====================================================================================
+ */
+#ifdef MATLAB_MEX_FILE
+void mexFunction(int nlhs,
+        mxArray *plhs[],
+        int nrhs,
+        const mxArray *prhs[])
+{
+    const double *dkcr = NULL;
+    double *kcr_corr, *dkcr_corr, *out;
+    int k, n, n_att, m, *index;
+    double t0, tol = AT_TOLERANCE;
+
+    LS_SPAN_BEGIN(t0);
+    if (nrhs < 4)
+        mexErrMsgTxt("usage: [KcR_corr dKcR_corr index] = attenuator_fast(monitor, factor, Imon, KcR, dKcR, tol)");
+    n_att = (int) mxGetNumberOfElements(prhs[0]);
+    n     = (int) mxGetNumberOfElements(prhs[2]);
+    if ((int) mxGetNumberOfElements(prhs[1]) != n_att)
+        mexErrMsgTxt("attenuator_fast: monitor and factor must have the same length");
+    if ((int) mxGetNumberOfElements(prhs[3]) != n
+            || (nrhs > 4 && !mxIsEmpty(prhs[4]) && (int) mxGetNumberOfElements(prhs[4]) != n))
+        mexErrMsgTxt("attenuator_fast: Imon, KcR and dKcR must have the same length");
+    if (nrhs > 4 && !mxIsEmpty(prhs[4]))
+        dkcr = mxGetPr(prhs[4]);
+    if (nrhs > 5 && !mxIsEmpty(prhs[5]))
+        tol = mxGetScalar(prhs[5]);
+
+    plhs[0]   = mxCreateDoubleMatrix(1, n, mxREAL);
+    plhs[1]   = mxCreateDoubleMatrix(1, n, mxREAL);
+    kcr_corr  = mxGetPr(plhs[0]);
+    dkcr_corr = mxGetPr(plhs[1]);
+    index     = mxMalloc((n > 0 ? n : 1) * sizeof(int));
+    m = at_correct(mxGetPr(prhs[0]), mxGetPr(prhs[1]), n_att, tol, mxGetPr(prhs[2]),
+            mxGetPr(prhs[3]), dkcr, n, kcr_corr, dkcr_corr, index);
+    if (m < 0)
+        mexErrMsgTxt("attenuator_fast: monitor intensities of the table must be positive and sorted ascending, tol > 1");
+    if (m < n)
+        mexWarnMsgTxt("attenuator_fast: monitor intensity of some points matches no attenuator of the table (NaN)");
+    if (nlhs > 2)
+    {
+        plhs[2] = mxCreateDoubleMatrix(1, n, mxREAL);
+        out     = mxGetPr(plhs[2]);
+        for (k = 0; k < n; k++)
+            out[k] = index[k] + 1;
+    }
+    mxFree(index);
+    LS_SPAN_END(t0, LS_MEX, "attenuator_fast", NULL);
+}				/* ----------  end of function mexFunction  ---------- */
+#endif
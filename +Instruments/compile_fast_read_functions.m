@@ -1,2 +1,18 @@
-mex -outdir ./@ALVBASE ./@ALVBASE/read_dynamic_file_fast.c;
-mex -outdir ./@ALVBASE ./@ALVBASE/read_static_from_autosave_fast.c;
+% the readers are part of libls (../libls): build the shared library, the MEX files are thin shims linked to it
+libls = fullfile(fileparts(fileparts(mfilename('fullpath'))), 'libls');
+system(['make -C ' libls ' lib']);
+link  = {fullfile(libls, 'ls_mex.c'), ['-I' libls], ['-L' libls], '-lls', ['LDFLAGS=$LDFLAGS -Wl,-rpath,' libls]};
+mex('-outdir', './@ALVBASE', './@ALVBASE/read_dynamic_file_fast.c', link{:});
+mex('-outdir', './@ALVBASE', './@ALVBASE/read_static_from_autosave_fast.c', link{:});
+mex('CFLAGS=$CFLAGS -O3', '-outdir', './@ALVBASE', './@ALVBASE/read_dynamic_series_fast.c', link{:});
+mex('-outdir', './@ALVBASE', './@ALVBASE/read_dynamic_header_fast.c', link{:});
+mex('-outdir', './@ALVBASE', './@ALVBASE/read_autosave_series_fast.c', link{:});
+% the engines of these readers are in the MEX files; linked for the counters and spans
+mex('-outdir', './@ALVBASE', './@ALVBASE/read_tol_file_fast.c', link{:});
+mex('-outdir', './@ALVBASE', './@ALVBASE/read_sta_file_fast.c', link{:});
+mex('-outdir', './@Malvern', './@Malvern/read_malvern_fast.c', link{:});
+mex('-outdir', '.', './parse_datetime_fast.c', link{:});
+mex('-outdir', '.', './attenuator_fast.c', link{:});
+mex('-outdir', '.', './watch_directory_fast.c', link{:});
+% counters and spans of libls (ls_profile), in the root of the toolbox
+mex('-outdir', '..', '../ls_profile.c', link{:});
@@ -0,0 +1,29 @@
+function formats = datetime_formats ( cmd, fmt )
+    % registry of user date formats (datenum symbols), tried before the builtin
+    % ones of parse_datetime_fast:
+    %   Instruments.datetime_formats()              : user formats
+    %   Instruments.datetime_formats('add', fmt)    : register fmt (string or cell)
+    %   Instruments.datetime_formats('clear')       : remove all user formats
+    %   Instruments.datetime_formats('all')         : user then builtin formats
+    persistent user
+    if isempty(user)
+        user = {};
+    end
+    if nargin > 0
+        switch cmd
+            case 'add'
+                if ischar(fmt)
+                    fmt = {fmt};
+                end
+                user = [user(:)' setdiff(fmt(:)', user, 'stable')];
+            case 'clear'
+                user = {};
+            case 'all'
+                formats = [user Instruments.parse_datetime_fast()];
+                return
+            otherwise
+                error('Instruments:datetime_formats', 'unknown command %s', cmd);
+        end
+    end
+    formats = user;
+end
@@ -0,0 +1,13 @@
+function [ serial fmt ] = parse_datetime ( str )
+    % serial date numbers (as datenum) of a date / time string or cell array of
+    % strings, parsed natively by parse_datetime_fast with the user formats of
+    % Instruments.datetime_formats and the builtin ones.
+    % NaN and '' where no format matches; fmt is the format of each string.
+    if ischar(str)
+        str = {str};
+    end
+    formats = [Instruments.datetime_formats() Instruments.parse_datetime_fast()];
+    [serial index] = Instruments.parse_datetime_fast(str, Instruments.datetime_formats());
+    fmt = repmat({''}, size(serial));
+    fmt(index > 0) = formats(index(index > 0));
+end
@@ -0,0 +1,80 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  parse_datetime_fast.c
+ *
+ *    Description:  convert date / time strings of the instrument files into serial
+ *                  date numbers in one call (libls/datetime_parse.c), instead of finding
+ *                  the format with datenum inside try / catch and calling datenum
+ *                  for every point.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/* check if calling from matlab and include necessary mex.h*/
+#ifdef MATLAB_MEX_FILE
+#include "mex.h"
+#include "../libls/ls_mex.h"
+#endif
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  mexFunction
+ *  Description:  comunicate between matlab and c program
+ *
+ *  [serial format] = parse_datetime_fast(strings, formats)
+ *  builtin = parse_datetime_fast()
+ *
+ *  strings : string or cell array of strings
+ *  formats : cell array of user formats (datenum symbols), tried before the builtin
+ *  serial  : serial date numbers (as datenum), NaN if no format matches
+ *  format  : 1-based index of the matching format in [formats builtin], 0 if none
+ *  builtin : cell array of the builtin formats
+ * =====================================================================================
+ */
+#ifdef MATLAB_MEX_FILE
+void mexFunction(int nlhs,
+        mxArray *plhs[],
+        int nrhs,
+        const mxArray *prhs[])
+{
+    char **formats, *str;
+    double *serial, *index;
+    int i, n, n_formats, hint = -1;
+
+    if (nrhs == 0)
+    {
+        plhs[0] = mxCreateCellMatrix(1, DT_N_BUILTIN);
+        for (i = 0; i < DT_N_BUILTIN; i++)
+            mxSetCell(plhs[0], i, mxCreateString(dt_builtin_formats[i]));
+        return;
+    }
+    if (!mxIsChar(prhs[0]) && !mxIsCell(prhs[0]))
+        mexErrMsgTxt("usage: [serial format] = parse_datetime_fast(strings, formats)");
+    n_formats = dt_formats_from_matlab(nrhs > 1 ? prhs[1] : NULL, &formats);
+    n = mxIsChar(prhs[0]) ? 1 : (int) mxGetNumberOfElements(prhs[0]);
+    plhs[0] = mxCreateDoubleMatrix(n, 1, mxREAL);
+    plhs[1] = mxCreateDoubleMatrix(n, 1, mxREAL);
+    serial = mxGetPr(plhs[0]);
+    index  = mxGetPr(plhs[1]);
+    for (i = 0; i < n; i++)
+    {
+        str = mxArrayToString(mxIsChar(prhs[0]) ? prhs[0] : mxGetCell(prhs[0], i));
+        serial[i] = NAN;
+        index[i]  = str && dt_parse(str, (const char *const *) formats, n_formats, &hint,
+                &serial[i]) ? hint + 1 : 0;
+        mxFree(str);
+    }
+    dt_free_formats(formats, n_formats);
+}				/* ----------  end of function mexFunction  ---------- */
+#endif
@@ -0,0 +1,116 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  watch_directory_fast.c
+ *
+ *    Description:  report files of a directory once they are completely written, to
+ *                  ingest the autosave files of a running measurement incrementally:
+ *                  matlab interface of wd_open / wd_poll / wd_done / wd_close
+ *                  (libls/watch.c, inotify on linux, scanning elsewhere). The watches
+ *                  of the matlab session are numbered by this MEX file.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* check if calling from matlab and include necessary mex.h*/
+#ifdef MATLAB_MEX_FILE
+#include "mex.h"
+#include "../libls/ls_mex.h"
+#endif
+
+#define WD_MAX_WATCHES   16
+
+#ifdef MATLAB_MEX_FILE
+static wd_watch watches[WD_MAX_WATCHES];
+
+static void wd_close_all(void)
+{
+    int i;
+    for (i = 0; i < WD_MAX_WATCHES; i++)
+        if (watches[i].used)
+            wd_close(&watches[i]);
+}
+
+/*  watch of the id argument (1-based) */
+static wd_watch *wd_get(const mxArray *id)
+{
+    int i = (int) mxGetScalar(id) - 1;
+    if (i < 0 || i >= WD_MAX_WATCHES || !watches[i].used)
+        mexErrMsgTxt("watch_directory_fast: no such watch");
+    return &watches[i];
+}
+#endif
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  mexFunction
+ *  Description:  comunicate between matlab and c program
+ *
+ *  id    = watch_directory_fast('open', dir, suffix)   suffix default '.ASC'
+ *  files = watch_directory_fast('poll', id, timeout)   timeout [s], default 0
+ *  watch_directory_fast('done', id, n)                 remove the first n files
+ *  watch_directory_fast('close', id)
+ *
+ *  files : cell column of the names (without dir) of the finished files not yet
+ *          removed with 'done', in the order they were finished
+ * =====================================================================================
+ */
+#ifdef MATLAB_MEX_FILE
+void mexFunction(int nlhs,
+        mxArray *plhs[],
+        int nrhs,
+        const mxArray *prhs[])
+{
+    char cmd[8], *dir, suffix[WD_SUFFIX_LENGTH] = ".ASC";
+    wd_watch *w;
+    int i, ok;
+    double t0;
+
+    LS_SPAN_BEGIN(t0);
+    mexAtExit(wd_close_all);
+    if (nrhs < 2 || mxGetString(prhs[0], cmd, sizeof(cmd)) != 0)
+        mexErrMsgTxt("usage: watch_directory_fast('open', dir, suffix), ('poll', id, timeout), ('done', id, n), ('close', id)");
+    if (strcmp(cmd, "open") == 0)
+    {
+        for (i = 0; i < WD_MAX_WATCHES && watches[i].used; i++);
+        if (i == WD_MAX_WATCHES)
+            mexErrMsgTxt("watch_directory_fast: too many open watches");
+        if (nrhs > 2)
+            mxGetString(prhs[2], suffix, sizeof(suffix));
+        dir = mxArrayToString(prhs[1]);
+        ok  = dir && wd_open(&watches[i], dir, suffix);
+        mxFree(dir);
+        if (!ok)
+            mexErrMsgTxt("watch_directory_fast: cannot read the directory");
+        plhs[0] = mxCreateDoubleScalar(i + 1);
+    }
+    else if (strcmp(cmd, "poll") == 0)
+    {
+        w = wd_get(prhs[1]);
+        if (!wd_poll(w, nrhs > 2 ? (int) (1000 * mxGetScalar(prhs[2])) : 0))
+            mexErrMsgTxt("watch_directory_fast: cannot read the directory");
+        plhs[0] = mxCreateCellMatrix(w->n_queue, 1);
+        for (i = 0; i < w->n_queue; i++)
+            mxSetCell(plhs[0], i, mxCreateString(w->queue[i]));
+    }
+    else if (strcmp(cmd, "done") == 0)
+    {
+        w = wd_get(prhs[1]);
+        wd_done(w, nrhs > 2 ? (int) mxGetScalar(prhs[2]) : w->n_queue);
+    }
+    else if (strcmp(cmd, "close") == 0)
+        wd_close(wd_get(prhs[1]));
+    else
+        mexErrMsgTxt("watch_directory_fast: unknown command");
+    LS_SPAN_END(t0, LS_MEX, "watch_directory_fast", cmd);
+}				/* ----------  end of function mexFunction  ---------- */
+#endif
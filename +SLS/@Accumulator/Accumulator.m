@@ -0,0 +1,45 @@
+%==============================================================================
+% streaming statistics of static counts, angle by angle
+%==============================================================================
+classdef Accumulator < handle
+% per-angle Welford accumulators of count rate, monitor intensity and
+% temperature (welford_fast): counts are added while the files are read,
+% the memory does not grow with the number of counts, accumulators of
+% separately read shards can be merged.
+    properties
+        tolerance = 1e-3;   % counts within tolerance [deg] share an angle
+    end
+    properties ( SetAccess = private )
+        % (8 x n_angles) [angle; n; mean_cr; M2_cr; mean_imon; M2_imon; mean_T; M2_T]
+        state = zeros(8, 0);
+    end
+    methods
+        function self = Accumulator(tolerance)
+            if nargin > 0
+                self.tolerance = tolerance;
+            end
+        end
+        % add counts (scalars or vectors)
+        function add(self, angle, cr, imon, T)
+            self.state = SLS.welford_fast('add', self.state, angle, cr, imon, T, self.tolerance);
+        end
+        % add the counts of another accumulator (e.g. of another shard)
+        function merge(self, other)
+            for i = 1 : length(other)
+                self.state = SLS.welford_fast('merge', self.state, other(i).state, self.tolerance);
+            end
+        end
+        % statistics: struct of row vectors, one entry per angle (ascending)
+        function s = stats(self)
+            res     = SLS.welford_fast('stats', self.state);
+            s.Angle = res(1,:);
+            s.N     = res(2,:);
+            s.CR    = res(3,:);
+            s.dCR   = res(4,:);
+            s.Imon  = res(5,:);
+            s.dImon = res(6,:);
+            s.T     = res(7,:);
+            s.dT    = res(8,:);
+        end
+    end
+end
@@ -10,6 +10,8 @@ classdef AngleData < dynamicprops
         scatt_angle;
         % allocate count to 0x0 array of struct
         count = struct([]);
+        % counts rejected as outliers (check_cr, read_static)
+        rejected = struct([]);
         mean_count_rate;
         error_mean_count_rate;
         mean_monitor_intensity;
@@ -18,6 +20,13 @@ classdef AngleData < dynamicprops
         KcR;
         dKcR;
     end
+    properties ( Hidden )
+        % running Welford state of the first n_accumulated counts
+        % (SLS.welford_fast), so that calc_mean does not loop over count;
+        % the counts added since are added in one call by calc_mean
+        accumulator = [];
+        n_accumulated = 0;
+    end
     methods
         %----------------------------------------------------------------------
         % constructor : set angle
@@ -42,6 +51,22 @@ classdef AngleData < dynamicprops
             end
         end
 
+        %----------------------------------------------------------------------
+        % set counts and results of SLS.reduce_angles (entry i) at once,
+        % instead of add, calc_mean and calc_kc_over_r
+        %----------------------------------------------------------------------
+        function set_reduction(self, counts, red, i)
+            self.count = counts;
+            self.accumulator = [];
+            self.n_accumulated = 0;
+            self.mean_count_rate = red.CR(i);
+            self.error_mean_count_rate = red.dCR(i);
+            self.mean_monitor_intensity = red.Imon(i);
+            self.error_mean_monitor_intensity = red.dImon(i);
+            self.mean_temperature = red.T(i);
+            self.KcR = red.KcR(i);
+            self.dKcR = red.dKcR(i);
+        end
         
         function e = calc_error(self)
             e = 0;
@@ -52,40 +77,35 @@ classdef AngleData < dynamicprops
             
         end
         % calculate mean count rate and monitor intensity with errors (std_dev)
+        % from the running Welford state (the counts not yet in it are added
+        % in one call)
         function calc_mean(self)
             %self.check_cr();
             if ~isempty(self.count)
-                len = length(self.count);
-                % set values to zero
-                mean_cr = 0;
-                mean_i_mon = 0;
-                error_mean_cr = 0;
-                error_mean_i_mon = 0;
-                % calculate mean values
-                for i = 1 : len
-                    mean_cr = mean_cr + self.count(i).count_rate;
-                    mean_i_mon = mean_i_mon + self.count(i).monitor_intensity;
+                n = length(self.count);
+                if self.n_accumulated < n
+                    new = self.count(self.n_accumulated + 1 : n);
+                    self.accumulator = SLS.welford_fast('add', self.accumulator, ...
+                        repmat(self.scatt_angle, 1, length(new)), ...
+                        [new.count_rate], [new.monitor_intensity], ...
+                        [new.temperature], Inf);
+                    self.n_accumulated = n;
                 end
-                mean_cr = mean_cr / len;
-                mean_i_mon = mean_i_mon / len;
                 %--------------------------------------------------------------
-                % calculate errors (standard deviation)
+                % rows: angle, n, mean / std of count rate, monitor intensity
+                % and temperature
                 % TODO: check errors, since they do not match ALV ones!!!
                 %--------------------------------------------------------------
-                for i = 1 : len
-                    dev_cr = self.count(i).count_rate - mean_cr;
-                    error_mean_cr = error_mean_cr + dev_cr * dev_cr;
-                    dev_i_mon = self.count(i).monitor_intensity - mean_i_mon;
-                    error_mean_i_mon = error_mean_i_mon + dev_i_mon * dev_i_mon;
-                end
+                s = SLS.welford_fast('stats', self.accumulator);
+                mean_i_mon = s(5);
                 if mean_i_mon < 0
                     mean_i_mon = 1;
                 end
                 self.mean_monitor_intensity = mean_i_mon;
-                self.mean_count_rate = mean_cr;
-                self.error_mean_count_rate = sqrt(error_mean_cr / (len -1));
-                self.error_mean_monitor_intensity = sqrt(error_mean_i_mon / (len - 1));
-                self.mean_temperature = mean([self.count.temperature]);
+                self.mean_count_rate = s(3);
+                self.error_mean_count_rate = s(4);
+                self.error_mean_monitor_intensity = s(6);
+                self.mean_temperature = s(7);
             else
                 disp(['no data at angle' self.scatt_angle])
                 self.mean_count_rate = 0;
@@ -173,24 +193,37 @@ classdef AngleData < dynamicprops
             disp(str);
         end
         %----------------------------------------------------------------------
-        % check that count_rate does not have strange scattering (e.g.dust)
-        % TODO: rewrite for new save technique. !!! not explicitly needed
+        % check that count_rate does not have strange scattering (e.g.dust):
+        % move outlying counts to rejected and recalculate the mean values
+        % policy 'mad' (default), 'sigma', 'hampel' (see SLS.reject_outliers)
         %----------------------------------------------------------------------
-        function check_cr(self)
-            cr_tolerance_limit = 0.05;
-            cr = self.count_rates;
-            mean_cr = mean(cr);
-            for i = 1 : length(cr)
-                if abs(cr(i) - mean_cr)/mean_cr > cr_tolerance_limit
-                    cr_tmp = cr(:);
-                    cr_tmp(i) = [];
-                    if mean(cr_tmp) < mean_cr
-                        disp(['Ignored Data at ' num2str((self.scatt_angle)) ...
-                            ': CR=' num2str(cr(i),'%.2f') ' mean=' num2str(mean_cr,'%.2f')...
-                            ' mean_new=' num2str(cr_tmp, '%.2f')])
-                        self.ignore = [self.ignore ; i];
-                    end
+        function check_cr(self, policy, k)
+            if nargin < 2
+                policy = 'mad';
+            end
+            if nargin < 3
+                k = 3;
+            end
+            if isempty(self.count)
+                return
+            end
+            cr = [self.count.count_rate];
+            keep = SLS.reject_outliers(cr, ones(size(cr)), policy, k);
+            for i = find(~keep)
+                disp(['Ignored Data at ' num2str((self.scatt_angle)) ...
+                    ': CR=' num2str(cr(i),'%.2f') ' mean=' num2str(mean(cr),'%.2f')...
+                    ' mean_new=' num2str(mean(cr(keep)), '%.2f')])
+            end
+            if ~all(keep)
+                if isempty(self.rejected)
+                    self.rejected = self.count(~keep);
+                else
+                    self.rejected = [self.rejected self.count(~keep)];
                 end
+                self.count = self.count(keep);
+                self.accumulator = [];
+                self.n_accumulated = 0;
+                self.calc_mean();
             end
         end
     end
@@ -36,6 +36,12 @@ classdef Experiment < dynamicprops
 
  end	% public properties
 
+ properties ( Hidden )
+
+  Derived									% DerivedCache of Q, Phi ... of the points
+
+ end
+
  %============================================================================
  % DEPENDENT PROPERTIES
  %============================================================================
@@ -85,6 +91,7 @@ classdef Experiment < dynamicprops
    self.Unit_X_T	= point(1).Unit_X_T;
 
    self.Point		= point;						% import the point classes as props
+   self.Derived		= DerivedCache;
 
   end	% constructor
 
@@ -95,12 +102,28 @@ classdef Experiment < dynamicprops
   %============================================================================
   % GET METHODS FOR DEPENDENT PROPERTIES
   %============================================================================
+  function d = derived ( self )
+  % Q, Phi, KcR, dKcR, X_T, dX_T of all points (vectors, see DerivedCache), evaluated
+  % again only if n, Angle, C, dndc, T or the instrument of a point changed
+   if isempty(self.Derived)
+    self.Derived	= DerivedCache;
+   end
+   d	= self.Derived.update( self.Point );
+  end
+
+  function set.Point ( self, point )
+  % another point array: a new cache
+   self.Point	= point;
+   self.Derived	= DerivedCache;
+  end
+
   function C = get.C ( self )
    C	= unique( [ self.Point.C ] );
   end
 
   function Phi = get.Phi ( self )
-   Phi	= unique( [ self.Point.Phi ] );
+   d	= self.derived();
+   Phi	= unique( d.Phi );
   end
 
   function Cs = get.Cs ( self )
@@ -112,7 +135,8 @@ classdef Experiment < dynamicprops
   end
 
   function Q = get.Q ( self )
-   Q	= unique( [ self.Point.Q ] );
+   d	= self.derived();
+   Q	= unique( d.Q );
   end
 
   function T = get.T ( self )
@@ -135,46 +159,45 @@ classdef Experiment < dynamicprops
   %
   %		Kc/R = 1/M + 2 * B2 * c
   %
+  % The fit (SLS.virial: M, B2, errors, covariance) is stored as Fit_KcR.
 
    if nargin < 2
     N	= min(4,length(self.C));
    end
 
-   index	= ( [ self.Point.C ] <= self.C(N) );
-   point	= self.Point( index );
-
-   C	= [ point.C	]';
-   KcR	= [ point.KcR	]';
-   dKcR	= [ point.dKcR	]';
-
-   fitfun	= '1 ./ M + 2 .* B2 .* C';					% fit function
-   coefficients	= {'Mi'	'B2'};						% coefficients
-   fitexpr	= {'1'	'2*C'};
-
-   weights	= 1 ./ ( dKcR ) .^2;
+   res	= SLS.virial( self, N );					% native weighted regression
+   M	= res.M;							% mass
+   dM	= res.dM;
+   B2	= res.B2;							% second virial coefficient
+   dB2	= res.dB2;
 
-   fit_options	= fitoptions(	'Method',	'LinearLeastSquares',	...
-				'Weights',	weights			);	% fit options
+   try	self.addprop('Fit_KcR');	end
+   self.Fit_KcR	= res;
 
-   fit_type	= fittype(	fitexpr, 				...
-				'independent',	'C',			...
-				'dependent',	'KcR',			...
-				'coefficients',	coefficients,		...
-				'options',	fit_options		);	% fit type
+  end
 
-   [ cf gof ] = fit( C, KcR, fit_type );					% perform numerical fit
-   confidence = confint(cf,0.95);
+  %============================================================================
+  % DOUBLE EXTRAPOLATION OF ALL ANGLES AND CONCENTRATIONS
+  %============================================================================
+  function res = fit_zimm ( self, model, mask )
+  % M, Rg and B2 from Kc/R of all angles and concentrations at once (SLS.zimm),
+  % stored as Fit_Zimm.
+  %
+  % Optional arguments are the following:
+  % - model:		'Zimm' (default), 'Berry' or 'Guinier'
+  % - mask:		logical, one entry per Point, false excludes the point: refitting
+  %			with another mask is cheap (no data are copied into the fit)
 
-   % get fit result
-   cout = coeffvalues (cf); 
-   dcout =  0.5*(confidence(2,:)-confidence(1,:));  
-   M	= 1/ cout(1);							% mass
-   dM	= dcout(1) / cout(1)^2 ;
-   B2	= cout(2);							% second virial coefficient
-   dB2	= dcout(2);
+   if nargin < 2
+    model	= 'Zimm';
+   end
+   if nargin < 3
+    mask	= [];
+   end
+   res	= SLS.zimm( self, model, mask );
 
-   try	self.addprop('Fit_KcR');	end
-   self.Fit_KcR	= cf;
+   try	self.addprop('Fit_Zimm');	end
+   self.Fit_Zimm	= res;
 
   end
 
@@ -56,19 +56,13 @@ methods
         Phi = self.C * v0;
     end
 
+    % single points; Sample and Experiment use the vectors of DerivedCache
     function Q = get.Q ( self )
-        Qexp = '4 * pi * n * sind( 0.5 * theta ) / lambda';
-        Qf   = inline(Qexp,'n','theta','lambda');
-        Q    = Qf( self.n, self.Angle, self.Instrument.Lambda );
+        Q    = DerivedCache.q( self.n, self.Angle, self.Instrument.Lambda );
     end
 
     function KcR = get.KcR ( self )
-        KcRexpr	= 'old * ( c / c_set ) * ( dndc / dndc_set )^2 * ( n / n_set )^2';
-        KcRf = inline(KcRexpr,'old',        ...
-                    'c'   , 'c_set'       , ...
-                    'dndc', 'dndc_set'    , ...
-                    'n'   , 'n_set'     );
-        KcR  = KcRf( self.KcR_raw,           ...
+        KcR  = DerivedCache.kcr( self.KcR_raw, self.dKcR_raw, ...
                     self.C   , self.C_set    , ...
                     self.dndc, self.dndc_set , ...
                     self.n   , self.n_set  );
@@ -99,4 +93,57 @@ methods
 
 end
 
+methods
+
+    % inputs of the vectors of DerivedCache: count every change
+    function self = set.n ( self, n )
+        self.n = n;
+        DerivedCache.changed();
+    end
+    function self = set.Angle ( self, Angle )
+        self.Angle = Angle;
+        DerivedCache.changed();
+    end
+    function self = set.C ( self, C )
+        self.C = C;
+        DerivedCache.changed();
+    end
+    function self = set.dndc ( self, dndc )
+        self.dndc = dndc;
+        DerivedCache.changed();
+    end
+    function self = set.T ( self, T )
+        self.T = T;
+        DerivedCache.changed();
+    end
+    function self = set.Protein ( self, Protein )
+        self.Protein = Protein;
+        DerivedCache.changed();
+    end
+    function self = set.Instrument ( self, Instrument )
+        self.Instrument = Instrument;
+        DerivedCache.changed();
+    end
+    function self = set.KcR_raw ( self, KcR_raw )
+        self.KcR_raw = KcR_raw;
+        DerivedCache.changed();
+    end
+    function self = set.dKcR_raw ( self, dKcR_raw )
+        self.dKcR_raw = dKcR_raw;
+        DerivedCache.changed();
+    end
+    function self = set.C_set ( self, C_set )
+        self.C_set = C_set;
+        DerivedCache.changed();
+    end
+    function self = set.dndc_set ( self, dndc_set )
+        self.dndc_set = dndc_set;
+        DerivedCache.changed();
+    end
+    function self = set.n_set ( self, n_set )
+        self.n_set = n_set;
+        DerivedCache.changed();
+    end
+
+end
 end
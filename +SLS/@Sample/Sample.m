@@ -32,10 +32,14 @@ properties ( Hidden)
     date_experiment
     RawData
     KcR_corr
+    dKcR_corr
+    Attenuation         % cache of KcR_corr, dKcR_corr: Key ([Imon; KcR; dKcR]), KcR, dKcR, Index
+    Derived             % DerivedCache of Q, KcR, X_T ... of the points
 end
 methods
     function self = Sample( varargin )
     a = Args(varargin{:}); % get the args
+    self.Derived = DerivedCache;
     try self.Instrument = Instruments.(a.Instrument); % get the instrument
     catch err; error('Instrument not found!');
     end
@@ -67,22 +71,32 @@ methods
            error('Error loading the static file!');
        end
     else
-        [s_array, e_array, nc_array] = self.Instrument.find_start_end( a.Path );
-        start_index = s_array(filegroup_index);
-        end_index = e_array(filegroup_index);
-        nc = nc_array(filegroup_index);
         if any(strcmp('start_index', properties(a))) && any(strcmp('end_index', properties(a))) && any(strcmp('number_of_counts', properties(a)));
             start_index = a.start_index;
             end_index = a.end_index;
             nc = a.number_of_counts;
+        else
+            [s_array, e_array, nc_array] = self.Instrument.find_start_end( a.Path );
+            start_index = s_array(filegroup_index);
+            end_index = e_array(filegroup_index);
+            nc = nc_array(filegroup_index);
         end
 
         disp(['Load SLS:' a.Path '[' num2str(start_index,'%4.4u') ':' num2str(end_index,'%4.4u') ']' ])
 
         path_standard = a.path_standard;
         path_solvent  = a.path_solvent;
+        % outlier rejection options of read_static, data of a shared parse
+        % ('Autosave', see load_autosave)
+        opts = {};
+        optnames = {'Outliers', 'OutlierThreshold', 'OutlierWindow', 'Autosave'};
+        for i = 1 : length(optnames)
+            if any(strcmp(optnames{i}, properties(a)))
+                opts = [opts optnames(i) {a.(optnames{i})}];
+            end
+        end
         [self.Point self.RawData] = self.Instrument.read_static(path_standard, path_solvent, ...
-            a.Path, self.C, self.dndc, start_index, end_index, nc);
+            a.Path, self.C, self.dndc, start_index, end_index, nc, opts{:});
     end
     self.raw_data_path = a.Path;
     pointprops = {   'Protein', 'Salt', ...
@@ -94,56 +108,58 @@ methods
         [ self.Point.(pointprops{i}) ]	= deal(a.(pointprops{i}));			% the deal function rocks!
     end
     end
-    function [KcR_corr] = get.KcR_corr( self )
-        point = self.Point;
-            try
-                point = self.RawData.SlsData;
-                simon = 'mean_monitor_intensity';
-            catch
-                point = self.Point;
-                simon = 'Imon';
-            end
-        for i_angle = 1 : length(point)
-            attenuator = self.Instrument.get_attenuator_corrections();
-            for i_att = 1 : length(attenuator)
-                if ( round(point(i_angle).(simon) / attenuator(i_att).monitor_intensity) == 1)
-                    correction_factor = attenuator(i_att).intensity_correction;
-                    KcR_corr(i_angle) = point(i_angle).KcR * correction_factor;
-                    dKcR_corr(i_angle) = point(i_angle).dKcR* correction_factor;
-                    break
-                end
-            end
+    function KcR_corr = get.KcR_corr ( self )
+    % Kc/R of every angle corrected for the attenuator (SLS.attenuator_correction,
+    % cached in Attenuation)
+        KcR_corr = SLS.attenuator_correction(self);
+    end
+    function dKcR_corr = get.dKcR_corr ( self )
+        [ KcR_corr dKcR_corr ] = SLS.attenuator_correction(self);
+    end
+    function d = derived ( self )
+    % Q, KcR, dKcR, X_T, dX_T of all points (vectors), evaluated again only if
+    % n, Angle, C, dndc, T or the instrument of a point changed
+        if isempty(self.Derived)
+            self.Derived = DerivedCache;        % saved before the cache existed
         end
+        d = self.Derived.update(self.Point);
+    end
+    function set.Point ( self, point )
+    % another point array (also s.Point(i) = ... of the value points): a new cache
+        self.Point   = point;
+        self.Derived = DerivedCache;
     end
     function KcR = get.KcR ( self )
-        y   = [ self.Point.KcR ];
-        w   = 1./ [ self.Point.dKcR ].^2;
-        KcR = sum( y .* w ) / sum( w );
+        d   = self.derived();
+        w   = 1./ d.dKcR.^2;
+        KcR = sum( d.KcR .* w ) / sum( w );
     end 
     function [y dy] = KcRv ( self )
-        y   = [ self.Point.KcR ];
-        dy  = [ self.Point.dKcR ];
+        d   = self.derived();
+        y   = d.KcR;
+        dy  = d.dKcR;
     end
     function dKcR = get.dKcR ( self )
-        y    = [ self.Point.dKcR ];
-        w    = 1./ [ self.Point.dKcR ].^2;
-        dKcR = sum( y .* w ) / sum( w );
+        d    = self.derived();
+        w    = 1./ d.dKcR.^2;
+        dKcR = sum( d.dKcR .* w ) / sum( w );
     end
     function X_T = get.X_T ( self )
-        y   = [ self.Point.X_T ];
-        w   = 1./ [ self.Point.dX_T ].^2;
-        X_T = sum( y .* w ) / sum( w );
+        d   = self.derived();
+        w   = 1./ d.dX_T.^2;
+        X_T = sum( d.X_T .* w ) / sum( w );
     end
     function dX_T = get.dX_T ( self )
-        y    = [ self.Point.dX_T ];
-        w    = 1./ [ self.Point.dX_T ].^2;
-        dX_T = sum( y .* w ) / sum( w );
+        d    = self.derived();
+        w    = 1./ d.dX_T.^2;
+        dX_T = sum( d.dX_T .* w ) / sum( w );
     end
     function Angle = get.Angle ( self )
         Angle = unique([self.Point.Angle]);
     end
     function Q = get.Q ( self )
-        Q = unique([self.Point.Q]);
+        d = self.derived();
+        Q = unique(d.Q);
     end
  end
 methods(Access = private, Static)
@@ -14,7 +14,7 @@ function [ X_T f ] = X_Tf( T, C, KcR )
  Na  = Constants.Na;
  kb  = Constants.kb;
 
- f   = inline(    '1 ./ ( Na .* kb .* T .* C .* KcR )', 'Na','kb','T','C','KcR');
+ f   = @( Na, kb, T, C, KcR ) 1 ./ ( Na .* kb .* T .* C .* KcR );
 
  X_T = f(Na,kb,T,C,KcR);
 
@@ -0,0 +1,53 @@
+function [ KcR dKcR ] = attenuator_correction ( sample )
+% Kc/R and dKcR of all angles of the SLS.Samples (array) corrected for the
+% attenuator in the beam, which is recognized from the monitor intensity
+% (nearest entry of the table Attenuator of the instrument within its Tolerance,
+% attenuator_fast).
+% The points come from RawData.SlsData if the sample was read from the
+% autosave files, from Point otherwise.
+% The result is cached on every sample (KcR_corr, dKcR_corr) and evaluated again
+% only if the monitor intensities or Kc/R change; the samples to evaluate are
+% corrected in one native call per instrument.
+% output: row vectors of all samples, concatenated (NaN: attenuator unknown)
+ m	= length(sample);
+ in	= cell(1,m);
+ stale	= false(1,m);
+ for i = 1 : m
+  in{i}		= corr_input( sample(i) );
+  stale(i)	= isempty(sample(i).Attenuation) || ~isequal( sample(i).Attenuation.Key, in{i} );
+ end
+
+ inst	= arrayfun( @(s) class(s.Instrument), sample, 'UniformOutput', false );
+ names	= unique( inst(stale) );
+ for i = 1 : length(names)
+  j	= find( stale & strcmp(inst, names{i}) );
+  try
+   att	= sample(j(1)).Instrument.Attenuator;
+  catch
+   error('SLS:attenuator', 'no attenuator table for the instrument %s', names{i});
+  end
+  x	= [ in{j} ];
+  [ y dy index ]	= Instruments.attenuator_fast( att.Monitor, att.Correction, x(1,:), x(2,:), x(3,:), att.Tolerance );
+  last	= cumsum( cellfun( @(v) size(v,2), in(j) ) );
+  first	= [ 1 last(1:end-1)+1 ];
+  for k = 1 : length(j)
+   r	= first(k) : last(k);
+   sample(j(k)).Attenuation	= struct( 'Key', in{j(k)}, 'KcR', y(r), 'dKcR', dy(r), 'Index', index(r) );
+  end
+ end
+
+ c	= [ sample.Attenuation ];
+ KcR	= [ c.KcR ];
+ dKcR	= [ c.dKcR ];
+end
+
+function x = corr_input ( sample )
+% [Imon; KcR; dKcR] of the points of the sample, one column per angle
+ try
+  p	= sample.RawData.SlsData;
+  x	= reshape( [ [ p.mean_monitor_intensity ]; [ p.KcR ]; [ p.dKcR ] ], 3, [] );
+ catch
+  d	= sample.derived();
+  x	= reshape( [ [ sample.Point.Imon ]; d.KcR; d.dKcR ], 3, [] );
+ end
+end
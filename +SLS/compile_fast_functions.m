@@ -0,0 +1,14 @@
+% the MEX files are shims of libls (../libls): build the shared library and link to it
+libls = fullfile(fileparts(fileparts(mfilename('fullpath'))), 'libls');
+system(['make -C ' libls ' lib']);
+mex('./reduce_angles_fast.c', fullfile(libls, 'ls_mex.c'), ['-I' libls], ['-L' libls], '-lls', ...
+    ['LDFLAGS=$LDFLAGS -Wl,-rpath,' libls]);
+mex('./zimm_fast.c', fullfile(libls, 'ls_mex.c'), ['-I' libls], ['-L' libls], '-lls', ...
+    ['LDFLAGS=$LDFLAGS -Wl,-rpath,' libls]);
+% batched weighted regression (linreg, SLS.virial, DLS.diffusion), in the root of the toolbox
+mex('-outdir', '..', '../linreg_fast.c', fullfile(libls, 'ls_mex.c'), ['-I' libls], ['-L' libls], '-lls', ...
+    ['LDFLAGS=$LDFLAGS -Wl,-rpath,' libls]);
+mex('./welford_fast.c', fullfile(libls, 'ls_mex.c'), ['-I' libls], ['-L' libls], '-lls', ...
+    ['LDFLAGS=$LDFLAGS -Wl,-rpath,' libls]);
+mex('./robust_fast.c', fullfile(libls, 'ls_mex.c'), ['-I' libls], ['-L' libls], '-lls', ...
+    ['LDFLAGS=$LDFLAGS -Wl,-rpath,' libls]);
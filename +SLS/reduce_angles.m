@@ -0,0 +1,32 @@
+function red = reduce_angles ( angle, cr, imon, T, standard, solvent, protein_conc, dn_over_dc, instrument, tolerance )
+% reduce the static counts of a sample (vectors angle, cr = CR0 + CR1, imon, T)
+% to one entry per angle in one native pass (reduce_angles_fast): mean and
+% standard deviation of count rate and monitor intensity, mean temperature,
+% ratio R and Kc/R with error as SLS.AngleData.calc_kc_over_r.
+% input : standard, solvent as returned by read_tol_file, protein_conc in mg/ml,
+%         dn_over_dc in ml/g, instrument (for Lambda), tolerance in degrees
+%         (default 1e-3, as read_static)
+% output: struct of row vectors (one entry per angle) and Group, the angle
+%         index of every count
+ if nargin < 10
+  tolerance	= 1e-3;
+ end
+ wavelength	= instrument.Lambda * 1e-8;	% A to cm
+ K		= (2 * pi * dn_over_dc * standard.refraction_index )^2 / ...
+		  (wavelength^4 * Constants.Na);
+ tab		= @(s) [ s.scatt_angle(:) s.ratio(:) s.error_ratio(:) s.rayleigh_ratio(:) ];
+ [ res group ]	= SLS.reduce_angles_fast( angle, cr, imon, T, tab(standard), tab(solvent), ...
+		  K, protein_conc * 1e-3, tolerance );
+ red.Angle	= res(1,:);
+ red.N		= res(2,:);
+ red.CR		= res(3,:);
+ red.dCR	= res(4,:);
+ red.Imon	= res(5,:);
+ red.dImon	= res(6,:);
+ red.T		= res(7,:);
+ red.R		= res(8,:);
+ red.dR		= res(9,:);
+ red.KcR	= res(10,:);
+ red.dKcR	= res(11,:);
+ red.Group	= group;
+end
@@ -0,0 +1,115 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  reduce_angles_fast.c
+ *
+ *    Description:  MEX shim of the reduction of the static light scattering counts of
+ *                  a sample (sr_reduce, libls/reduce_angles.c).
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/* check if calling from matlab and include necessary mex.h*/
+#ifdef MATLAB_MEX_FILE
+#include "mex.h"
+#endif
+
+#include "../libls/ls.h"
+
+/* table from a matlab (rows x 4) matrix [scatt_angle ratio error_ratio rayleigh_ratio] */
+#ifdef MATLAB_MEX_FILE
+static void sr_table_from_matrix(const mxArray *a, sr_table *tab)
+{
+    int n = (int) mxGetM(a);
+    const double *p = mxGetPr(a);
+    if (mxGetN(a) != 4)
+        mexErrMsgTxt("reduce_angles_fast: tables must be [scatt_angle ratio error_ratio rayleigh_ratio]");
+    tab->n              = n;
+    tab->angle          = p;
+    tab->ratio          = p + n;
+    tab->error_ratio    = p + 2 * n;
+    tab->rayleigh_ratio = p + 3 * n;
+}
+#endif
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  mexFunction
+ *  Description:  comunicate between matlab and c program
+ *
+ *  [res group] = reduce_angles_fast(angle, cr, imon, T, standard, solvent, K, conc, tolerance)
+ *
+ *  angle, cr, imon, T : one entry per count (cr = CR0 + CR1)
+ *  standard, solvent  : tables (rows x 4) [scatt_angle ratio error_ratio rayleigh_ratio]
+ *  K, conc            : optical constant [mol cm^2 g^-2], concentration [g/ml]
+ *  tolerance          : counts within tolerance [deg] belong to the same angle
+ *  res   : (11 x n_angles) rows angle, n, cr, dcr, imon, dimon, T, R, dR_solution,
+ *          KcR, dKcR
+ *  group : 1-based angle of every count
+ * =====================================================================================
+ */
+#ifdef MATLAB_MEX_FILE
+void mexFunction(int nlhs,
+        mxArray *plhs[],
+        int nrhs,
+        const mxArray *prhs[])
+{
+    sr_table standard, solvent;
+    sr_angle *out;
+    int *group, n, i, n_angles;
+    double *res, *grp;
+    double t0;
+
+    LS_SPAN_BEGIN(t0);
+    if (nrhs < 9)
+        mexErrMsgTxt("usage: [res group] = reduce_angles_fast(angle, cr, imon, T, standard, solvent, K, conc, tolerance)");
+    n = (int) mxGetNumberOfElements(prhs[0]);
+    for (i = 1; i < 4; i++)
+        if ((int) mxGetNumberOfElements(prhs[i]) != n)
+            mexErrMsgTxt("reduce_angles_fast: angle, cr, imon and T must have the same length");
+    sr_table_from_matrix(prhs[4], &standard);
+    sr_table_from_matrix(prhs[5], &solvent);
+
+    out   = mxMalloc((n > 0 ? n : 1) * sizeof(sr_angle));
+    group = mxMalloc((n > 0 ? n : 1) * sizeof(int));
+    n_angles = sr_reduce(n, mxGetPr(prhs[0]), mxGetPr(prhs[1]), mxGetPr(prhs[2]),
+            mxGetPr(prhs[3]), &standard, &solvent, mxGetScalar(prhs[6]),
+            mxGetScalar(prhs[7]), mxGetScalar(prhs[8]), out, group);
+    if (n_angles < 0)
+        mexErrMsgTxt("reduce_angles_fast: out of memory");
+
+    plhs[0] = mxCreateDoubleMatrix(11, n_angles, mxREAL);
+    plhs[1] = mxCreateDoubleMatrix(n, 1, mxREAL);
+    res = mxGetPr(plhs[0]);
+    grp = mxGetPr(plhs[1]);
+    for (i = 0; i < n_angles; i++, res += 11)
+    {
+        res[0]  = out[i].angle;
+        res[1]  = out[i].n;
+        res[2]  = out[i].cr;
+        res[3]  = out[i].dcr;
+        res[4]  = out[i].imon;
+        res[5]  = out[i].dimon;
+        res[6]  = out[i].T;
+        res[7]  = out[i].R;
+        res[8]  = out[i].dR_solution;
+        res[9]  = out[i].KcR;
+        res[10] = out[i].dKcR;
+    }
+    for (i = 0; i < n; i++)
+        grp[i] = group[i] + 1;
+    mxFree(out);
+    mxFree(group);
+    LS_SPAN_END(t0, LS_MEX, "reduce_angles_fast", NULL);
+}				/* ----------  end of function mexFunction  ---------- */
+#endif
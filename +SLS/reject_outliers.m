@@ -0,0 +1,27 @@
+function [ keep center scale ] = reject_outliers ( cr, group, policy, k, window )
+% robust rejection of outlying count rates (e.g. dust), angle by angle, in
+% linear time (robust_fast).
+% input : cr     count rates, group the angle index of every count (e.g.
+%                Group of SLS.reduce_angles)
+%         policy 'mad' (default) : |cr - median| > k * 1.4826 * MAD
+%                'sigma'         : iterative sigma clipping around the mean
+%                'hampel'        : moving median / MAD over window counts on
+%                                  either side (acquisition order)
+%                'none'          : keep everything
+%         k      threshold in standard deviations (default 3)
+%         window half width of the hampel window (default 3)
+% No count is rejected at angles (hampel: windows) of fewer than 7 counts, and
+% the scale is at least 1 % of the center: the MAD of a few counts is too noisy.
+% output: keep (logical, one entry per count), center and scale of every angle
+ if nargin < 3 || isempty(policy)
+  policy	= 'mad';
+ end
+ if nargin < 4 || isempty(k)
+  k		= 3;
+ end
+ if nargin < 5 || isempty(window)
+  window	= 3;
+ end
+ [ reject center scale ]	= SLS.robust_fast( cr, group, lower(policy), k, window );
+ keep		= ~reject;
+end
@@ -0,0 +1,94 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  robust_fast.c
+ *
+ *    Description:  outlier rejection of the static counts of a sample, angle by angle:
+ *                  matlab interface of ro_reject (libls/robust.c, policies mad, sigma,
+ *                  hampel and none).
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/* check if calling from matlab and include necessary mex.h*/
+#ifdef MATLAB_MEX_FILE
+#include "mex.h"
+#include "../libls/ls_mex.h"
+#endif
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  mexFunction
+ *  Description:  comunicate between matlab and c program
+ *
+ *  [reject center scale] = robust_fast(x, group, policy, k, window)
+ *
+ *  x      : count rates
+ *  group  : 1-based angle of every count (e.g. Group of SLS.reduce_angles)
+ *  policy : 'mad' (default), 'sigma', 'hampel' or 'none'; no count is rejected at
+ *           angles (windows) of fewer than 7 counts, the scale is at least 1 % of
+ *           the center
+ *  k      : threshold in standard deviations (default 3)
+ *  window : half width of the hampel window in counts (default 3)
+ *  reject : logical, true for the rejected counts
+ *  center, scale : location and spread of every angle
+ * =====================================================================================
+ */
+#ifdef MATLAB_MEX_FILE
+void mexFunction(int nlhs,
+        mxArray *plhs[],
+        int nrhs,
+        const mxArray *prhs[])
+{
+    char name[16] = "mad";
+    const double *x, *grp;
+    int *group, n, i, n_groups = 0, policy, window = 3, ok;
+    double k = 3, t0;
+
+    LS_SPAN_BEGIN(t0);
+    if (nrhs < 2)
+        mexErrMsgTxt("usage: [reject center scale] = robust_fast(x, group, policy, k, window)");
+    n = (int) mxGetNumberOfElements(prhs[0]);
+    if ((int) mxGetNumberOfElements(prhs[1]) != n)
+        mexErrMsgTxt("robust_fast: x and group must have the same length");
+    if (nrhs > 2 && mxGetString(prhs[2], name, sizeof(name)) != 0)
+        mexErrMsgTxt("robust_fast: policy must be a string");
+    if (nrhs > 3)
+        k = mxGetScalar(prhs[3]);
+    if (nrhs > 4)
+        window = (int) mxGetScalar(prhs[4]);
+    if ((policy = ro_policy_from_name(name)) < 0)
+        mexErrMsgTxt("robust_fast: policy must be 'mad', 'sigma', 'hampel' or 'none'");
+
+    x   = mxGetPr(prhs[0]);
+    grp = mxGetPr(prhs[1]);
+    group = mxMalloc((n > 0 ? n : 1) * sizeof(int));
+    for (i = 0; i < n; i++)
+    {
+        group[i] = (int) grp[i] - 1;
+        if (group[i] < 0)
+            mexErrMsgTxt("robust_fast: group must be positive");
+        if (group[i] + 1 > n_groups)
+            n_groups = group[i] + 1;
+    }
+    plhs[0] = mxCreateLogicalMatrix(n, 1);
+    plhs[1] = mxCreateDoubleMatrix(1, n_groups, mxREAL);
+    plhs[2] = mxCreateDoubleMatrix(1, n_groups, mxREAL);
+    ok = ro_reject(x, group, n, n_groups, policy, k, window,
+            (unsigned char *) mxGetLogicals(plhs[0]), mxGetPr(plhs[1]), mxGetPr(plhs[2]));
+    mxFree(group);
+    if (!ok)
+        mexErrMsgTxt("robust_fast: out of memory");
+    LS_SPAN_END(t0, LS_MEX, "robust_fast", name);
+}				/* ----------  end of function mexFunction  ---------- */
+#endif
@@ -0,0 +1,47 @@
+function res = virial ( experiment, N )
+% molar mass and second virial coefficient of every SLS.Experiment (array) from
+%
+%		Kc/R = 1/M + 2 * B2 * c
+%
+% weighted by 1 ./ dKcR.^2, all experiments in one native regression (linreg).
+% optional N: the points of the first N concentrations are used (default:
+% min(4,all), as fit_KcR)
+% output: struct, one value per experiment in every field: M, dM, B2, dB2 (half widths of
+%         the 95% confidence intervals), Cov (covariance of [1/M B2]), N, Chi2
+ x	= [];
+ y	= [];
+ dy	= [];
+ group	= [];
+ for i = 1 : length(experiment)
+  e	= experiment(i);
+  C	= e.C;
+  if nargin < 2
+   n	= min(4,length(C));
+  else
+   n	= min(N,length(C));
+  end
+  if n < 1
+   continue
+  end
+  d	= e.derived();
+  index	= ( [ e.Point.C ] <= C(n) );
+  x	= [ x		[ e.Point(index).C ]		];
+  y	= [ y		d.KcR(index)			];
+  dy	= [ dy		d.dKcR(index)			];
+  group	= [ group	repmat(i, 1, nnz(index))	];
+ end
+
+ r	= linreg( x, y, dy, group, 1, false );
+
+ m	= length(experiment);
+ res	= struct( 'M', NaN(1,m), 'dM', NaN(1,m), 'B2', NaN(1,m), 'dB2', NaN(1,m), ...
+		'Cov', NaN(2,2,m), 'N', zeros(1,m), 'Chi2', NaN(1,m) );
+ i	= r.Group;
+ res.M(i)	= 1 ./ r.Coeff(1,:);					% mass
+ res.dM(i)	= r.Error(1,:) ./ r.Coeff(1,:).^2;
+ res.B2(i)	= 0.5 * r.Coeff(2,:);					% second virial coefficient
+ res.dB2(i)	= 0.5 * r.Error(2,:);
+ res.Cov(:,:,i)	= r.Cov .* repmat( [ 1 0.5; 0.5 0.25 ], [ 1 1 length(i) ] );
+ res.N(i)	= r.N;
+ res.Chi2(i)	= r.Chi2;
+end
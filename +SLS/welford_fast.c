@@ -0,0 +1,148 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  welford_fast.c
+ *
+ *    Description:  streaming per-angle accumulators of count rate, monitor intensity
+ *                  and temperature: matlab interface of wa_add / wa_merge
+ *                  (libls/welford.c). The state of all angles is a matlab
+ *                  matrix (8 x n_angles), one column per angle:
+ *                      [angle; n; mean_cr; M2_cr; mean_imon; M2_imon; mean_T; M2_T]
+ *                  so counts can be added while files are being read and the states
+ *                  of shards read separately can be merged.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/* check if calling from matlab and include necessary mex.h*/
+#ifdef MATLAB_MEX_FILE
+#include "mex.h"
+#include "../libls/ls_mex.h"
+#endif
+
+#define WA_ROWS 8               /* rows of the state matrix */
+
+#ifdef MATLAB_MEX_FILE
+/* state matrix -> buckets (sorted by angle) */
+static void wa_from_matrix(const mxArray *m, wa_angles *a)
+{
+    const double *p;
+    int i, j;
+    memset(a, 0, sizeof(wa_angles));
+    if (mxIsEmpty(m))
+        return;
+    if (mxGetM(m) != WA_ROWS)
+        mexErrMsgTxt("welford_fast: the state must have 8 rows");
+    p = mxGetPr(m);
+    if (!wa_reserve(a, (int) mxGetN(m)))
+        mexErrMsgTxt("welford_fast: out of memory");
+    a->n = (int) mxGetN(m);
+    for (i = 0; i < a->n; i++, p += WA_ROWS)
+    {
+        a->b[i].angle = p[0];
+        a->b[i].s.n   = p[1];
+        for (j = 0; j < WF_N; j++)
+        {
+            a->b[i].s.mean[j] = p[2 + 2 * j];
+            a->b[i].s.m2[j]   = p[3 + 2 * j];
+        }
+    }
+    wa_sort(a);
+}
+
+/* buckets (sorted by angle) -> state matrix, or statistics if stats != 0 */
+static mxArray *wa_to_matrix(const wa_angles *a, int stats)
+{
+    mxArray *m = mxCreateDoubleMatrix(WA_ROWS, a->n, mxREAL);
+    double *p = mxGetPr(m);
+    int i, j;
+    for (i = 0; i < a->n; i++, p += WA_ROWS)
+    {
+        p[0] = a->b[i].angle;
+        p[1] = a->b[i].s.n;
+        for (j = 0; j < WF_N; j++)
+        {
+            p[2 + 2 * j] = a->b[i].s.mean[j];
+            p[3 + 2 * j] = stats ? wf_std(&a->b[i].s, j) : a->b[i].s.m2[j];
+        }
+    }
+    return m;
+}
+#endif
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  mexFunction
+ *  Description:  comunicate between matlab and c program
+ *
+ *  state = welford_fast('add', state, angle, cr, imon, T, tolerance)
+ *  state = welford_fast('merge', state_a, state_b, tolerance)
+ *  stats = welford_fast('stats', state)
+ *
+ *  state : (8 x n_angles) [angle; n; mean_cr; M2_cr; mean_imon; M2_imon; mean_T; M2_T],
+ *          [] for an empty state; columns sorted by angle
+ *  stats : (8 x n_angles) [angle; n; mean_cr; std_cr; mean_imon; std_imon; mean_T; std_T]
+ *  tolerance : counts within tolerance [deg] belong to the same angle (default 1e-3)
+ * =====================================================================================
+ */
+#ifdef MATLAB_MEX_FILE
+void mexFunction(int nlhs,
+        mxArray *plhs[],
+        int nrhs,
+        const mxArray *prhs[])
+{
+    char cmd[16];
+    wa_angles a, b;
+    double tolerance = 1e-3, t0;
+    int n, i, ok = 1;
+
+    LS_SPAN_BEGIN(t0);
+    if (nrhs < 2 || mxGetString(prhs[0], cmd, sizeof(cmd)) != 0)
+        mexErrMsgTxt("usage: state = welford_fast('add', state, angle, cr, imon, T, tolerance), "
+                "welford_fast('merge', state_a, state_b, tolerance), welford_fast('stats', state)");
+    wa_from_matrix(prhs[1], &a);
+    if (strcmp(cmd, "add") == 0)
+    {
+        if (nrhs < 6)
+            mexErrMsgTxt("welford_fast: add needs state, angle, cr, imon, T");
+        n = (int) mxGetNumberOfElements(prhs[2]);
+        for (i = 3; i < 6; i++)
+            if ((int) mxGetNumberOfElements(prhs[i]) != n)
+                mexErrMsgTxt("welford_fast: angle, cr, imon and T must have the same length");
+        if (nrhs > 6)
+            tolerance = mxGetScalar(prhs[6]);
+        ok = wa_add(&a, mxGetPr(prhs[2]), mxGetPr(prhs[3]), mxGetPr(prhs[4]),
+                mxGetPr(prhs[5]), n, tolerance);
+        plhs[0] = wa_to_matrix(&a, 0);
+    }
+    else if (strcmp(cmd, "merge") == 0)
+    {
+        if (nrhs < 3)
+            mexErrMsgTxt("welford_fast: merge needs two states");
+        if (nrhs > 3)
+            tolerance = mxGetScalar(prhs[3]);
+        wa_from_matrix(prhs[2], &b);
+        ok = wa_merge(&a, &b, tolerance);
+        wa_free(&b);
+        plhs[0] = wa_to_matrix(&a, 0);
+    }
+    else if (strcmp(cmd, "stats") == 0)
+        plhs[0] = wa_to_matrix(&a, 1);
+    else
+        mexErrMsgTxt("welford_fast: unknown command (add, merge, stats)");
+    wa_free(&a);
+    if (!ok)
+        mexErrMsgTxt("welford_fast: out of memory");
+    LS_SPAN_END(t0, LS_MEX, "welford_fast", cmd);
+}				/* ----------  end of function mexFunction  ---------- */
+#endif
@@ -0,0 +1,43 @@
+function res = zimm ( experiment, model, mask )
+% double extrapolation of Kc/R of all angles and concentrations of an
+% SLS.Experiment in one weighted fit (native, zimm_fast):
+%
+%	Zimm	Kc/R       = 1/M ( 1 + Rg^2 q^2 / 3 ) + 2 B2 c
+%	Berry	sqrt(Kc/R) = 1/sqrt(M) ( 1 + Rg^2 q^2 / 6 ) + B2 sqrt(M) c
+%	Guinier	log(Kc/R)  = -log(M) + Rg^2 q^2 / 3 + 2 B2 M c
+%
+% input : model ('Zimm' (default), 'Berry' or 'Guinier'), mask (logical, one
+%         entry per Point of the experiment; false: excluded, default all)
+% output: struct with M, Rg [A], B2, their errors dM, dRg, dB2 (half widths of
+%         the 95% confidence intervals), Cov (covariance of [M Rg B2]), Coeff
+%         (of 1, q^2, c), N, Dof, Chi2, Model, Mask
+ if nargin < 2 || isempty(model)
+  model	= 'Zimm';
+ end
+ if nargin < 3
+  mask	= [];
+ end
+ models	= { 'Zimm', 'Berry', 'Guinier' };
+ m	= find( strcmpi( model, models ) );
+ if isempty(m)
+  error('SLS:zimm', 'unknown model %s (Zimm, Berry or Guinier)', model);
+ end
+
+ d	= experiment.derived();
+ c	= [ experiment.Point.C ];
+ [ p dp cov coeff stats ]	= SLS.zimm_fast( d.Q.^2, c, d.KcR, d.dKcR, m - 1, mask );
+
+ res.Model	= models{m};
+ res.M		= p(1);
+ res.Rg		= p(2);
+ res.B2		= p(3);
+ res.dM		= dp(1);
+ res.dRg	= dp(2);
+ res.dB2	= dp(3);
+ res.Cov	= cov;
+ res.Coeff	= coeff;
+ res.N		= stats(1);
+ res.Dof	= stats(2);
+ res.Chi2	= stats(3);
+ res.Mask	= mask;
+end
@@ -0,0 +1,110 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  zimm_fast.c
+ *
+ *    Description:  MEX shim of the Zimm / Berry / Guinier double extrapolation of
+ *                  all angles and concentrations (zb_fit, libls/zimm.c).
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/* check if calling from matlab and include necessary mex.h*/
+#ifdef MATLAB_MEX_FILE
+#include "mex.h"
+#endif
+
+#include "../libls/ls.h"
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  mexFunction
+ *  Description:  comunicate between matlab and c program
+ *
+ *  [p dp cov coeff stats] = zimm_fast(q2, c, KcR, dKcR, model, mask)
+ *
+ *  q2, c, KcR, dKcR : one entry per point (angle and concentration)
+ *  model            : 0 Zimm (default), 1 Berry, 2 Guinier
+ *  mask             : logical, false: point excluded (optional)
+ *  p, dp            : [M Rg B2] and the half widths of the 95% confidence intervals
+ *  cov              : 3 x 3 covariance of [M Rg B2]
+ *  coeff            : coefficients of 1, q^2, c of the linear model
+ *  stats            : [n dof chi2]
+ * =====================================================================================
+ */
+#ifdef MATLAB_MEX_FILE
+void mexFunction(int nlhs,
+        mxArray *plhs[],
+        int nrhs,
+        const mxArray *prhs[])
+{
+    const double *q2, *c, *kcr, *dkcr;
+    double *out;
+    unsigned char *mask = NULL;
+    int i, j, n, model = ZB_ZIMM;
+    zb_result res;
+    double t0;
+
+    LS_SPAN_BEGIN(t0);
+    if (nrhs < 4)
+        mexErrMsgTxt("usage: [p dp cov coeff stats] = zimm_fast(q2, c, KcR, dKcR, model, mask)");
+    n = (int) mxGetNumberOfElements(prhs[0]);
+    for (i = 1; i < 4; i++)
+        if ((int) mxGetNumberOfElements(prhs[i]) != n || !mxIsDouble(prhs[i]))
+            mexErrMsgTxt("zimm_fast: q2, c, KcR and dKcR must be double vectors of the same length");
+    if (nrhs > 4)
+        model = (int) mxGetScalar(prhs[4]);
+    if (model < ZB_ZIMM || model > ZB_GUINIER)
+        mexErrMsgTxt("zimm_fast: model must be 0 (Zimm), 1 (Berry) or 2 (Guinier)");
+    if (nrhs > 5 && !mxIsEmpty(prhs[5]))
+    {
+        if ((int) mxGetNumberOfElements(prhs[5]) != n)
+            mexErrMsgTxt("zimm_fast: mask must have one entry per point");
+        mask = mxMalloc((n > 0 ? n : 1) * sizeof(unsigned char));
+        if (mxIsLogical(prhs[5]))
+            for (i = 0; i < n; i++)
+                mask[i] = mxGetLogicals(prhs[5])[i] != 0;
+        else if (mxIsDouble(prhs[5]))
+            for (i = 0; i < n; i++)
+                mask[i] = mxGetPr(prhs[5])[i] != 0;
+        else
+            mexErrMsgTxt("zimm_fast: mask must be logical or double");
+    }
+    q2   = mxGetPr(prhs[0]);
+    c    = mxGetPr(prhs[1]);
+    kcr  = mxGetPr(prhs[2]);
+    dkcr = mxGetPr(prhs[3]);
+
+    zb_fit(q2, c, kcr, dkcr, mask, n, model, &res);
+
+    plhs[0] = mxCreateDoubleMatrix(1, ZB_N_PAR, mxREAL);
+    plhs[1] = mxCreateDoubleMatrix(1, ZB_N_PAR, mxREAL);
+    plhs[2] = mxCreateDoubleMatrix(ZB_N_PAR, ZB_N_PAR, mxREAL);
+    plhs[3] = mxCreateDoubleMatrix(1, ZB_N_PAR, mxREAL);
+    plhs[4] = mxCreateDoubleMatrix(1, 3, mxREAL);
+    memcpy(mxGetPr(plhs[0]), res.p, ZB_N_PAR * sizeof(double));
+    memcpy(mxGetPr(plhs[1]), res.error, ZB_N_PAR * sizeof(double));
+    out = mxGetPr(plhs[2]);
+    for (i = 0; i < ZB_N_PAR; i++)
+        for (j = 0; j < ZB_N_PAR; j++)
+            out[j * ZB_N_PAR + i] = res.cov[i * ZB_N_PAR + j];
+    memcpy(mxGetPr(plhs[3]), res.coeff, ZB_N_PAR * sizeof(double));
+    out = mxGetPr(plhs[4]);
+    out[0] = res.n;
+    out[1] = res.dof;
+    out[2] = res.chi2;
+    if (mask)
+        mxFree(mask);
+    LS_SPAN_END(t0, LS_MEX, "zimm_fast", NULL);
+}				/* ----------  end of function mexFunction  ---------- */
+#endif
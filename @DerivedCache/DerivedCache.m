@@ -0,0 +1,149 @@
+classdef DerivedCache < handle
+% This class caches the quantities derived from the points of a Sample or an
+% Experiment (DLS or SLS): Q, Phi and, for SLS points, KcR, dKcR, X_T, dX_T, as
+% vectors (1 x number of points) computed at once. They are evaluated again only
+% after an input of a point changed: n, Angle, C, dndc, T, Protein, the instrument
+% or the raw values KcR_raw, dKcR_raw, C_set, dndc_set, n_set. The set methods of
+% these properties (SLS.Point, DLS.Point) count the changes (DerivedCache.changed),
+% so a cache still up to date is found without reading the points; the Samples
+% and Experiments start a new cache when their Point array is replaced.
+% The formulas are also used by the Point classes for single points. An empty
+% input of a point (e.g. no C) gives NaN for the quantities of that point.
+%
+% Syntax: d = DerivedCache();
+%         d.update(points);     % then d.Q, d.KcR, ...
+
+properties ( SetAccess = private )
+
+    Q    = []
+    Phi  = []
+    KcR  = []
+    dKcR = []
+    X_T  = []
+    dX_T = []
+
+end
+
+properties ( Access = private )
+
+    version = -1        % DerivedCache.changes() at the last evaluation
+    count   = 0         % number of points of the last evaluation
+
+end
+
+methods
+
+    function self = update ( self, point )
+    % evaluate the quantities of the points if any input has changed
+        version = DerivedCache.changes();
+        if version == self.version && numel(point) == self.count
+            return
+        end
+
+        n        = DerivedCache.values(point, 'n');
+        C        = DerivedCache.values(point, 'C');
+        self.Q   = DerivedCache.q(n, DerivedCache.values(point, 'Angle'), ...
+            DerivedCache.instrument_lambda(point));
+        self.Phi = DerivedCache.phi(C, {point.Protein});
+        if isa(point, 'SLS.Point')
+            [ self.KcR self.dKcR ] = DerivedCache.kcr(DerivedCache.values(point, 'KcR_raw'), ...
+                DerivedCache.values(point, 'dKcR_raw'), C, DerivedCache.values(point, 'C_set'), ...
+                DerivedCache.values(point, 'dndc'), DerivedCache.values(point, 'dndc_set'), ...
+                n, DerivedCache.values(point, 'n_set'));
+            self.X_T  = SLS.X_Tf(DerivedCache.values(point, 'T'), C, self.KcR);
+            % T and C are set values without error: X_T ~ 1 / KcR has the
+            % relative error of KcR
+            self.dX_T = self.X_T .* self.dKcR ./ self.KcR;
+        else
+            self.KcR  = [];
+            self.dKcR = [];
+            self.X_T  = [];
+            self.dX_T = [];
+        end
+        self.version = version;
+        self.count   = numel(point);
+    end
+
+    function clear ( self )
+    % forget the last evaluation
+        self.version = -1;
+    end
+
+end
+
+methods ( Static )
+
+    function Q = q ( n, theta, lambda )
+    % scattering vector [A^-1], lambda in A, theta in degrees
+        Q = 4 * pi * n .* sind( 0.5 * theta ) ./ lambda;
+    end
+
+    function Phi = phi ( C, protein )
+    % volume fraction, protein: name (LIT) or cell array with one name per C.
+    % NaN for proteins without specific volume in LIT
+        if ischar(protein)
+            protein = repmat({protein}, size(C));
+        end
+        protein(~cellfun(@ischar, protein)) = {''};
+        [ names tmp j ] = unique(protein);
+        v0  = NaN(1, length(names));
+        for i = 1 : length(names)
+            try v0(i) = LIT.(names{i}).v0;  end
+        end
+        Phi = C .* reshape(v0(j), size(C));
+    end
+
+    function [ KcR dKcR ] = kcr ( KcR_raw, dKcR_raw, c, c_set, dndc, dndc_set, n, n_set )
+    % Kc/R of the actual c, dn/dc and n from the one measured with the set values
+        KcR  = KcR_raw .* ( c ./ c_set ) .* ( dndc ./ dndc_set ).^2 .* ( n ./ n_set ).^2;
+        dKcR = KcR ./ KcR_raw .* dKcR_raw;
+    end
+
+    function v = values ( point, name )
+    % one value of the field per point (1 x number of points), NaN where it is empty
+        v = [point.(name)];
+        if numel(v) ~= numel(point)
+            v = NaN(1, numel(point));
+            for i = 1 : numel(point)
+                if ~isempty(point(i).(name))
+                    v(i) = point(i).(name)(1);
+                end
+            end
+        end
+    end
+
+    function v = changes ( bump )
+    % number of changes of the inputs of any point so far (bump: count one more)
+        persistent n_changes
+        if isempty(n_changes)
+            n_changes = 0;
+        end
+        if nargin > 0 && bump
+            n_changes = n_changes + 1;
+        end
+        v = n_changes;
+    end
+
+    function changed ()
+    % called by the set methods of the inputs of the Point classes
+        DerivedCache.changes(true);
+    end
+
+    function lambda = instrument_lambda ( point )
+    % wavelength of the instrument of every point (Lambda is a constant of the
+    % instrument class: one lookup if all points share the class)
+        try
+            inst   = [point.Instrument];
+            lambda = repmat(inst(1).Lambda, 1, numel(point));
+            ok     = numel(inst) == numel(point);
+        catch
+            ok     = false;
+        end
+        if ~ok
+            lambda = arrayfun(@(p) p.Instrument.Lambda, point);
+        end
+    end
+
+end
+
+end
@@ -1,3 +1,11 @@
 %change -I_folder to include folders in which have been installed ool and
 %gsl
-mex -I/usr/local/include -lool -lgsl -lgslcblas -lm contin.c
+%-fopenmp: the bootstrap replicates of contin run in parallel
+%the engine is the library libls_contin (../libls, make contin), linked to libls:
+%libls itself is not rebuilt, the other MEX files keep the same library
+%the MEX file is the static method DLS.Point.contin: written to ../+DLS/@Point
+libls = fullfile(fileparts(fileparts(mfilename('fullpath'))), 'libls');
+system(['make -C ' libls ' lib contin']);
+mex('-outdir', fullfile('..', '+DLS', '@Point'), '-I/usr/local/include', ['-I' libls], 'CFLAGS=$CFLAGS -fopenmp', ...
+    ['LDFLAGS=$LDFLAGS -fopenmp -Wl,-rpath,' libls], 'contin.c', fullfile(libls, 'ls_mex.c'), ...
+    ['-L' libls], '-lls_contin', '-lls', '-lool', '-lgsl', '-lgslcblas', '-lm');
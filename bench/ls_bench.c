@@ -0,0 +1,628 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  ls_bench.c
+ *
+ *    Description:  end-to-end benchmark of the native engines without matlab:
+ *                  a synthetic ALV series (synth.c) is written, then every stage is
+ *                  timed over all files:
+ *                    parse      read_dynamic_series_fast  (rs_read_file)
+ *                    channels   read_dynamic_series_fast, 'weighted' (rs_read_file
+ *                                                         of all channels, rs_combine)
+ *                    normalize  read_dynamic_series_fast  (rs_windows, rs_normalize)
+ *                    cumulants  cumulants_fast            (cu_cumulants, CU_DEFAULT_ORDER)
+ *                    fit        fit_global_fast           (gf_fit, DoubleBKG, every point alone)
+ *                    rebin      rebin_fast                (rb_batch, 12 points per decade)
+ *                    contin     contin                    (make CONTIN=1, needs gsl / ool)
+ *                    sls        read_static_from_autosave_fast, reduce_angles_fast
+ *                                                         (st_read_file, sr_reduce)
+ *                    combined   read_autosave_series_fast (as_read_file: correlation
+ *                                                         and static header in one pass
+ *                                                         per file, replaces parse + sls)
+ *                  The engines are those of the MEX files (libls). Results are
+ *                  written as JSON (with the counters of libls) or CSV, the spans of
+ *                  libls as Chrome trace (--trace); see usage().
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <errno.h>
+#include <sys/stat.h>
+
+#include "synth.h"
+/*  the engines of the MEX files (libls) */
+#include "ls.h"
+
+#define BENCH_MAX_STAGES 11
+#define BENCH_MAX_REPEAT 64
+
+typedef struct
+{
+    const char *name, *unit;
+    int    items;
+    double t[BENCH_MAX_REPEAT];     /* [s] of every repetition */
+    double bytes;                   /* per repetition, 0 if not meaningful */
+} bench_stage;
+
+typedef struct
+{
+    synth_config synth;
+    int    n_samples, repeat, keep, csv;
+    char  *dir, *out, *trace;
+} bench_options;
+
+/*  per file data shared by the stages */
+typedef struct
+{
+    int     n_files, n_lags, n_crop;
+    char  **paths;
+    double *t, *g, *dg;             /* raw data, n_lags x n_files */
+    double *tau, *G, *dG;           /* normalized, cropped: n_crop x n_files */
+    double *angle, *q2, *norm;
+    double *D_cumulants, *D_fit;
+    double  bytes;
+} bench_data;
+
+static double bench_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+static int bench_compare(const void *a, const void *b)
+{
+    double x = *(const double *) a, y = *(const double *) b;
+    return x < y ? -1 : x > y;
+}
+
+static double bench_median(const double *x, int n)
+{
+    double s[BENCH_MAX_REPEAT];
+    memcpy(s, x, n * sizeof(double));
+    qsort(s, n, sizeof(double), bench_compare);
+    return n % 2 ? s[n / 2] : 0.5 * (s[n / 2 - 1] + s[n / 2]);
+}
+
+static double bench_min(const double *x, int n)
+{
+    double m = x[0];
+    int i;
+    for (i = 1; i < n; i++)
+        if (x[i] < m)
+            m = x[i];
+    return m;
+}
+
+/*  median of the finite values, NaN if none */
+static double bench_median_finite(const double *x, int n)
+{
+    double *s = malloc((n > 0 ? n : 1) * sizeof(double)), m = NAN;
+    int i, k = 0;
+    for (i = 0; i < n; i++)
+        if (isfinite(x[i]))
+            s[k++] = x[i];
+    qsort(s, k, sizeof(double), bench_compare);
+    if (k > 0)
+        m = k % 2 ? s[k / 2] : 0.5 * (s[k / 2 - 1] + s[k / 2]);
+    free(s);
+    return m;
+}
+
+/*  create a directory and its parents (as mkdir -p), 0 on error */
+static int bench_mkdir_p(const char *path)
+{
+    char *p, *s = malloc(strlen(path) + 1);
+    int ok = 1;
+    if (!s)
+        return 0;
+    strcpy(s, path);
+    for (p = s + 1; ok && *p; p++)
+        if (*p == '/')
+        {
+            *p = '\0';
+            ok = mkdir(s, 0777) == 0 || errno == EEXIST;
+            *p = '/';
+        }
+    if (ok)
+        ok = mkdir(s, 0777) == 0 || errno == EEXIST;
+    free(s);
+    return ok;
+}
+
+static void usage(void)
+{
+    fprintf(stderr,
+        "usage: ls_bench [options]\n"
+        "  --samples N     samples (default 1)\n"
+        "  --angles N      angles per sample (default 13)\n"
+        "  --counts N      counts per angle (default 3)\n"
+        "  --repeat N      repetitions of every stage, min and median reported (default 3)\n"
+        "  --noise X       noise of g2 - 1 at the first lag (default 0.02)\n"
+        "  --dust X        probability of a dust burst per count (default 0.05)\n"
+        "  --modes N       modes of the size distribution, 1-2 (default 2)\n"
+        "  --seed N        seed of the generator (default 1)\n"
+        "  --dir PATH      directory of the generated files (default: temporary)\n"
+        "  --keep          keep the generated files\n"
+        "  --csv           CSV instead of JSON\n"
+        "  --out FILE      write the results to FILE (default: stdout)\n"
+        "  --trace FILE    record the spans of libls, written to FILE as Chrome trace\n");
+}
+
+static int bench_parse_options(int argc, char *argv[], bench_options *o)
+{
+    int i;
+    memset(o, 0, sizeof(bench_options));
+    synth_defaults(&o->synth);
+    o->n_samples = 1;
+    o->repeat    = 3;
+    for (i = 1; i < argc; i++)
+    {
+        const char *a = argv[i], *v = i + 1 < argc ? argv[i + 1] : NULL;
+        if (strcmp(a, "--keep") == 0)
+            o->keep = 1;
+        else if (strcmp(a, "--csv") == 0)
+            o->csv = 1;
+        else if (!v)
+            return 0;
+        else if (strcmp(a, "--samples") == 0)
+            o->n_samples = atoi(v), i++;
+        else if (strcmp(a, "--angles") == 0)
+            o->synth.n_angles = atoi(v), i++;
+        else if (strcmp(a, "--counts") == 0)
+            o->synth.n_counts = atoi(v), i++;
+        else if (strcmp(a, "--repeat") == 0)
+            o->repeat = atoi(v), i++;
+        else if (strcmp(a, "--noise") == 0)
+            o->synth.noise = atof(v), i++;
+        else if (strcmp(a, "--dust") == 0)
+            o->synth.dust = atof(v), i++;
+        else if (strcmp(a, "--modes") == 0)
+            o->synth.n_modes = atoi(v), i++;
+        else if (strcmp(a, "--seed") == 0)
+            o->synth.seed = strtoull(v, NULL, 10), i++;
+        else if (strcmp(a, "--dir") == 0)
+            o->dir = argv[++i];
+        else if (strcmp(a, "--out") == 0)
+            o->out = argv[++i];
+        else if (strcmp(a, "--trace") == 0)
+            o->trace = argv[++i];
+        else
+            return 0;
+    }
+    if (o->synth.n_modes == 1)
+        o->synth.weight[0] = 1;
+    return o->n_samples > 0 && o->synth.n_angles > 0 && o->synth.n_counts > 0
+        && o->repeat > 0 && o->repeat <= BENCH_MAX_REPEAT
+        && o->synth.n_modes >= 1 && o->synth.n_modes <= 2;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  stage_parse
+ *  Description:  read all files; the raw data of the last repetition are kept
+ * =====================================================================================
+ */
+static int stage_parse(bench_data *d)
+{
+    rs_file f;
+    int i, n;
+    memset(&f, 0, sizeof(rs_file));
+    for (i = 0; i < d->n_files; i++)
+    {
+        if (!(n = rs_read_file(d->paths[i], &f)))
+            return 0;
+        if (!d->t)
+        {
+            d->n_lags = n;
+            d->t  = malloc((size_t) n * d->n_files * sizeof(double));
+            d->g  = malloc((size_t) n * d->n_files * sizeof(double));
+            d->dg = malloc((size_t) n * d->n_files * sizeof(double));
+            if (!d->t || !d->g || !d->dg)
+                return 0;
+        }
+        if (n != d->n_lags)
+            return 0;
+        memcpy(d->t  + (size_t) i * n, f.t,  n * sizeof(double));
+        memcpy(d->g  + (size_t) i * n, f.g,  n * sizeof(double));
+        memcpy(d->dg + (size_t) i * n, f.dg, n * sizeof(double));
+        d->angle[i] = f.angle;
+    }
+    rs_free(&f);
+    return 1;
+}
+
+/*  all channels, the pseudo cross pair combined: every lag must have a value
+ *  (the -1 placeholders of the auto correlations are skipped) */
+static int stage_channels(bench_data *d)
+{
+    rs_file f;
+    int i, k, ok = 1;
+    memset(&f, 0, sizeof(rs_file));
+    f.channels = 1;
+    for (i = 0; ok && i < d->n_files; i++)
+    {
+        ok = rs_read_file(d->paths[i], &f) == d->n_lags && rs_combine(&f, RS_CH_WEIGHTED, NULL) == 2;
+        for (k = 0; ok && k < f.n; k++)
+            ok = f.g[k] > RS_NO_VALUE && isfinite(f.dg[k]);
+    }
+    rs_free(&f);
+    return ok;
+}
+
+static int stage_normalize(bench_data *d)
+{
+    double limits[4] = { RS_NORM_MIN, RS_NORM_MAX, RS_CROP_MIN, RS_CROP_MAX };
+    rs_window w;
+    rs_file f;
+    int i;
+    if (!rs_windows(d->t, d->n_lags, limits, &w) || w.n1 == w.n0)
+        return 0;
+    if (!d->G)
+    {
+        d->n_crop = w.c1 - w.c0;
+        d->tau = malloc(d->n_crop * sizeof(double));
+        d->G   = malloc((size_t) d->n_crop * d->n_files * sizeof(double));
+        d->dG  = malloc((size_t) d->n_crop * d->n_files * sizeof(double));
+        if (!d->tau || !d->G || !d->dG)
+            return 0;
+        memcpy(d->tau, d->t + w.c0, d->n_crop * sizeof(double));
+    }
+    for (i = 0; i < d->n_files; i++)
+    {
+        f.t  = d->t  + (size_t) i * d->n_lags;
+        f.g  = d->g  + (size_t) i * d->n_lags;
+        f.dg = d->dg + (size_t) i * d->n_lags;
+        f.n  = d->n_lags;
+        d->norm[i] = rs_normalize(&f, &w, d->G + (size_t) i * d->n_crop,
+                d->dG + (size_t) i * d->n_crop);
+    }
+    return 1;
+}
+
+static int stage_cumulants(bench_data *d)
+{
+    cu_result r;
+    int i;
+    for (i = 0; i < d->n_files; i++)
+    {
+        cu_cumulants(d->tau, d->G + (size_t) i * d->n_crop, d->dG + (size_t) i * d->n_crop,
+                d->n_crop, CU_DEFAULT_ORDER, 0.15, &r);
+        d->D_cumulants[i] = r.coeff[1] / (GF_D_TO_GAMMA * d->q2[i]);
+    }
+    return 1;
+}
+
+/*  every point alone with the bounds and start of DLS.global_model('DoubleBKG') */
+static int stage_fit(bench_data *d)
+{
+    const double lower[5] = { 0.0, 0, -1e-3, 0.5, 0 };
+    const double upper[5] = { 1, 1, 1e-3, 100, 2.5 };
+    const double start[5] = { 0.9, 0.1, 0, 6, 0.6 };
+    double *w = malloc(d->n_crop * sizeof(double)), xl[3], xg[2], dxl[3], dxg[2];
+    int offset[2] = { 0, d->n_crop }, i, k;
+    gf_problem p;
+    gf_info info;
+
+    if (!w)
+        return 0;
+    for (i = 0; i < d->n_files; i++)
+    {
+        const double *dg = d->dG + (size_t) i * d->n_crop;
+        for (k = 0; k < d->n_crop; k++)
+            w[k] = dg[k] > 0 ? 1 / (dg[k] * dg[k]) : 0;
+        memset(&p, 0, sizeof(p));
+        p.model    = GF_DOUBLE_BKG;
+        p.n_points = 1;
+        gf_model_size(p.model, &p.n_local, &p.n_global);
+        p.t      = d->tau;
+        p.g      = d->G + (size_t) i * d->n_crop;
+        p.w      = w;
+        p.offset = offset;
+        p.q2     = &d->q2[i];
+        p.lower  = lower;
+        p.upper  = upper;
+        memcpy(xl, start, 3 * sizeof(double));
+        memcpy(xg, start + 3, 2 * sizeof(double));
+        gf_fit(&p, xl, xg, dxl, dxg, 200, 1e-8, &info);
+        /*  intensity weighted D of the two modes, comparable to the cumulants */
+        d->D_fit[i] = (xl[0] * xg[0] + xl[1] * xg[1]) / (xl[0] + xl[1]);
+    }
+    free(w);
+    return 1;
+}
+
+/*  all normalized correlograms at once, as DLS.concat_points with Rebin = 12 */
+static int stage_rebin(bench_data *d)
+{
+    size_t n = (size_t) d->n_crop * d->n_files;
+    double *t = malloc(n * sizeof(double)), *tr = malloc(n * sizeof(double));
+    double *gr = malloc(n * sizeof(double)), *dgr = malloc(n * sizeof(double)), pd = 12;
+    int *offset = malloc((d->n_files + 1) * sizeof(int));
+    int *offset_r = malloc((d->n_files + 1) * sizeof(int)), i, ok;
+
+    ok = t && tr && gr && dgr && offset && offset_r;
+    if (ok)
+    {
+        for (i = 0; i <= d->n_files; i++)
+            offset[i] = i * d->n_crop;
+        for (i = 0; i < d->n_files; i++)
+            memcpy(t + (size_t) i * d->n_crop, d->tau, d->n_crop * sizeof(double));
+        ok = rb_batch(t, d->G, d->dG, offset, d->n_files, &pd, 1, tr, gr, dgr, offset_r) > 0;
+    }
+    free(t); free(tr); free(gr); free(dgr); free(offset); free(offset_r);
+    return ok;
+}
+
+#ifdef LS_WITH_CONTIN
+/*  as DLS.Point.invert_laplace: sqrt(g) of the lags rebinned to 12 points per
+ *  decade, m = 100 */
+static int stage_contin(bench_data *d)
+{
+    const int m = 100;
+    gsl_vector *s = gsl_vector_alloc(m), *gs = gsl_vector_alloc(m);
+    double *t = malloc(d->n_crop * sizeof(double)), *g = malloc(d->n_crop * sizeof(double));
+    double *dg = malloc(d->n_crop * sizeof(double)), tr[4096], gr[4096], dgr[4096], b;
+    int i, j, k, l, N;
+
+    for (i = 0; i < d->n_files; i++)
+    {
+        const double *G = d->G + (size_t) i * d->n_crop, *dG = d->dG + (size_t) i * d->n_crop;
+        for (k = 0, l = 0; k < d->n_crop && l < 4096; k++)
+            if (d->tau[k] > 1e-3 && d->tau[k] < 50 && G[k] > 0)
+            {
+                t[l]  = d->tau[k];
+                g[l]  = G[k];
+                dg[l] = dG[k];
+                l++;
+            }
+        N = rb_rebin(t, g, dg, l, 12, tr, gr, dgr);
+        if (N < 2)
+            continue;
+        gsl_vector *tv = gsl_vector_alloc(N), *y = gsl_vector_alloc(N), *v = gsl_vector_alloc(N);
+        for (j = 0; j < N; j++)
+        {
+            gsl_vector_set(tv, j, tr[j]);
+            gsl_vector_set(y, j, sqrt(gr[j]));
+            gsl_vector_set(v, j, 0.5 / sqrt(gr[j]) * dgr[j]);
+        }
+        parameter *p = parameter_alloc(tv, y, v, 0.15, tr[0], tr[N - 1], m, 0);
+        contin(p, s, gs, &b);
+        parameter_free(p);
+        gsl_vector_free(tv); gsl_vector_free(y); gsl_vector_free(v);
+    }
+    gsl_vector_free(s); gsl_vector_free(gs);
+    free(t); free(g); free(dg);
+    return 1;
+}
+#endif
+
+/*  static parse of every file and reduction per sample (toluene / solvent tables
+ *  of constant ratio) */
+static int stage_sls(bench_data *d, int n_per_sample)
+{
+    double *cr = malloc(d->n_files * sizeof(double)), *imon = malloc(d->n_files * sizeof(double));
+    double *T = malloc(d->n_files * sizeof(double)), *angle = malloc(d->n_files * sizeof(double));
+    double ratio[1] = { 1 }, err[1] = { 1 }, rr[1] = { 1.35e-5 }, solv[1] = { 0.3 }, ta[1] = { 90 };
+    sr_table standard = { 1, ta, ratio, err, rr }, solvent = { 1, ta, solv, err, rr };
+    sr_angle *out = malloc(n_per_sample * sizeof(sr_angle));
+    int *group = malloc(n_per_sample * sizeof(int)), i, ok = 1;
+    st_file f;
+
+    if (!cr || !imon || !T || !angle || !out || !group)
+        ok = 0;
+    for (i = 0; ok && i < d->n_files; i++)
+    {
+        ok = st_read_file(d->paths[i], &f);
+        cr[i]    = f.cr0 + f.cr1;
+        imon[i]  = f.imon;
+        T[i]     = f.temperature;
+        angle[i] = f.angle;
+    }
+    for (i = 0; ok && i < d->n_files; i += n_per_sample)
+        ok = sr_reduce(n_per_sample, angle + i, cr + i, imon + i, T + i, &standard, &solvent,
+                4.6e-8, 1e-3, 1e-3, out, group) >= 0;
+    free(cr); free(imon); free(T); free(angle); free(out); free(group);
+    return ok;
+}
+
+/*  dynamic and static data of every file in one pass (to compare with parse + sls),
+ *  without the count rate trace */
+static int stage_combined(bench_data *d)
+{
+    rs_file f;
+    st_file st;
+    int i, ok = 1;
+    memset(&f, 0, sizeof(rs_file));
+    for (i = 0; ok && i < d->n_files; i++)
+        ok = as_read_file(d->paths[i], &f, &st, NULL) == d->n_lags && !isnan(st.imon);
+    rs_free(&f);
+    return ok;
+}
+
+static void bench_write(FILE *fp, const bench_options *o, const bench_data *d,
+        const bench_stage *s, int n_stages, const synth_info *info, double D_true)
+{
+    ls_counter c[LS_N_ENGINES];
+    int i, k;
+    if (o->csv)
+    {
+        fprintf(fp, "stage,unit,items,min_s,median_s,us_per_item,mb_per_s\n");
+        for (i = 0; i < n_stages; i++)
+        {
+            double tmin = bench_min(s[i].t, o->repeat), tmed = bench_median(s[i].t, o->repeat);
+            fprintf(fp, "%s,%s,%d,%.6g,%.6g,%.6g,%.6g\n", s[i].name, s[i].unit, s[i].items,
+                    tmin, tmed, 1e6 * tmin / s[i].items,
+                    s[i].bytes > 0 ? s[i].bytes / tmin / 1048576 : 0);
+        }
+        return;
+    }
+    fprintf(fp, "{\n  \"benchmark\": \"ls_bench\",\n  \"libls\": \"%s\",\n", ls_version());
+    fprintf(fp, "  \"config\": {\"samples\": %d, \"angles\": %d, \"counts\": %d, \"files\": %d, "
+            "\"lags\": %d, \"lags_cropped\": %d, \"repeat\": %d, \"seed\": %llu, \"noise\": %g, "
+            "\"dust\": %g, \"modes\": %d, \"contin\": %s},\n",
+            o->n_samples, o->synth.n_angles, o->synth.n_counts, d->n_files, d->n_lags,
+            d->n_crop, o->repeat, o->synth.seed, o->synth.noise, o->synth.dust,
+            o->synth.n_modes,
+#ifdef LS_WITH_CONTIN
+            "true"
+#else
+            "false"
+#endif
+            );
+    fprintf(fp, "  \"stages\": [\n");
+    for (i = 0; i < n_stages; i++)
+    {
+        double tmin = bench_min(s[i].t, o->repeat), tmed = bench_median(s[i].t, o->repeat);
+        fprintf(fp, "    {\"name\": \"%s\", \"unit\": \"%s\", \"items\": %d, \"min_s\": %.6g, "
+                "\"median_s\": %.6g, \"us_per_item\": %.6g", s[i].name, s[i].unit, s[i].items,
+                tmin, tmed, 1e6 * tmin / s[i].items);
+        if (s[i].bytes > 0)
+            fprintf(fp, ", \"mb_per_s\": %.6g", s[i].bytes / tmin / 1048576);
+        fprintf(fp, "}%s\n", i + 1 < n_stages ? "," : "");
+    }
+    fprintf(fp, "  ],\n");
+    fprintf(fp, "  \"checks\": {\"D_true\": %.6g, \"D_cumulants_median\": %.6g, "
+            "\"D_fit_median\": %.6g, \"dust_counts\": %d, \"bytes\": %ld},\n",
+            D_true, bench_median_finite(d->D_cumulants, d->n_files),
+            bench_median_finite(d->D_fit, d->n_files), info->n_dust, info->bytes);
+    /*  totals of all repetitions */
+    ls_counters(c);
+    fprintf(fp, "  \"counters\": {");
+    for (i = 0, k = 0; i < LS_N_ENGINES; i++)
+        if (c[i].calls > 0)
+            fprintf(fp, "%s\n    \"%s\": {\"calls\": %lld, \"items\": %lld, \"bytes\": %lld}",
+                    k++ ? "," : "", ls_engine_name(i), c[i].calls, c[i].items, c[i].bytes);
+    fprintf(fp, "\n  }\n}\n");
+}
+
+int main(int argc, char *argv[])
+{
+    bench_options o;
+    bench_data d;
+    bench_stage s[BENCH_MAX_STAGES];
+    synth_info info;
+    char tmpdir[] = "/tmp/ls_bench_XXXXXX";
+    double t0, D_true = 0, lambda;
+    int n_stages = 0, n_per_sample, i, r, ok = 1;
+    FILE *fp = stdout;
+
+    if (!bench_parse_options(argc, argv, &o))
+    {
+        usage();
+        return 2;
+    }
+    if (!o.dir && !(o.dir = mkdtemp(tmpdir)))
+    {
+        perror("ls_bench: mkdtemp");
+        return 1;
+    }
+    if (!bench_mkdir_p(o.dir))
+    {
+        fprintf(stderr, "ls_bench: cannot create %s: %s\n", o.dir, strerror(errno));
+        return 1;
+    }
+    memset(&d, 0, sizeof(d));
+    memset(&info, 0, sizeof(info));
+    memset(s, 0, sizeof(s));
+    n_per_sample = o.synth.n_angles * o.synth.n_counts;
+    d.n_files = o.n_samples * n_per_sample;
+    d.paths       = calloc(d.n_files, sizeof(char *));
+    d.angle       = malloc(d.n_files * sizeof(double));
+    d.q2          = malloc(d.n_files * sizeof(double));
+    d.norm        = malloc(d.n_files * sizeof(double));
+    d.D_cumulants = malloc(d.n_files * sizeof(double));
+    d.D_fit       = malloc(d.n_files * sizeof(double));
+    if (!d.paths || !d.angle || !d.q2 || !d.norm || !d.D_cumulants || !d.D_fit)
+        return 1;
+
+    /*  generate (timed once) */
+    s[n_stages].name  = "generate";
+    s[n_stages].unit  = "file";
+    s[n_stages].items = d.n_files;
+    t0 = bench_now();
+    for (i = 0; ok && i < o.n_samples; i++)
+    {
+        ok = synth_series(&o.synth, o.dir, i, d.paths + i * n_per_sample, &info) == n_per_sample;
+        D_true = info.D_true;
+    }
+    for (r = 0; r < o.repeat; r++)
+        s[n_stages].t[r] = bench_now() - t0;
+    s[n_stages++].bytes = info.bytes;
+    if (!ok)
+    {
+        fprintf(stderr, "ls_bench: cannot write the files to %s\n", o.dir);
+        return 1;
+    }
+
+#define BENCH_STAGE(NAME, UNIT, BYTES, CALL)                                \
+    s[n_stages].name  = NAME;                                               \
+    s[n_stages].unit  = UNIT;                                               \
+    s[n_stages].items = d.n_files;                                          \
+    s[n_stages].bytes = BYTES;                                              \
+    for (r = 0; ok && r < o.repeat; r++)                                    \
+    {                                                                       \
+        t0 = bench_now();                                                   \
+        ok = CALL;                                                          \
+        s[n_stages].t[r] = bench_now() - t0;                                \
+    }                                                                       \
+    if (!ok)                                                                \
+        fprintf(stderr, "ls_bench: stage %s failed\n", NAME);               \
+    n_stages++;
+
+    if (o.trace)
+        ls_trace_enable(1);
+    BENCH_STAGE("parse", "file", (double) info.bytes, stage_parse(&d))
+    lambda = 10 * o.synth.lambda;
+    for (i = 0; i < d.n_files; i++)
+        d.q2[i] = pow(4 * M_PI * o.synth.n * sin(0.5 * d.angle[i] * M_PI / 180) / lambda, 2);
+    if (ok) { BENCH_STAGE("channels", "file", (double) info.bytes, stage_channels(&d)) }
+    if (ok) { BENCH_STAGE("normalize", "file", 0, stage_normalize(&d)) }
+    if (ok) { BENCH_STAGE("cumulants", "correlogram", 0, stage_cumulants(&d)) }
+    if (ok) { BENCH_STAGE("fit", "correlogram", 0, stage_fit(&d)) }
+    if (ok) { BENCH_STAGE("rebin", "correlogram", 0, stage_rebin(&d)) }
+#ifdef LS_WITH_CONTIN
+    if (ok) { BENCH_STAGE("contin", "correlogram", 0, stage_contin(&d)) }
+#endif
+    if (ok) { BENCH_STAGE("sls", "file", (double) info.bytes, stage_sls(&d, n_per_sample)) }
+    if (ok) { BENCH_STAGE("combined", "file", (double) info.bytes, stage_combined(&d)) }
+
+    if (ok && o.out && !(fp = fopen(o.out, "w")))
+    {
+        perror("ls_bench: output");
+        ok = 0;
+    }
+    if (ok)
+        bench_write(fp, &o, &d, s, n_stages, &info, D_true);
+    if (fp != stdout && fp)
+        fclose(fp);
+    if (o.trace && (!(fp = fopen(o.trace, "w")) || ls_trace_write_chrome(fp) < 0))
+    {
+        perror("ls_bench: trace");
+        ok = 0;
+    }
+    if (o.trace && fp)
+        fclose(fp);
+    for (i = 0; i < d.n_files; i++)
+    {
+        if (!o.keep && d.paths[i])
+            remove(d.paths[i]);
+        free(d.paths[i]);
+    }
+    if (!o.keep && o.dir == tmpdir)
+        rmdir(tmpdir);
+    free(d.paths); free(d.t); free(d.g); free(d.dg); free(d.tau); free(d.G); free(d.dG);
+    free(d.angle); free(d.q2); free(d.norm); free(d.D_cumulants); free(d.D_fit);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,475 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  ls_check.c
+ *
+ *    Description:  checks of the native engines against known answers (make check):
+ *                    datetime     dt_datenum as matlab's datenum, the ALV header format
+ *                    cumulants    polynomials of order 1 to 3 recovered exactly
+ *                    global fit   DoubleBKG of five correlograms with shared D's
+ *                                 (gf_fit) and fitted separately (gf_fit_each)
+ *                    rebin        means, lags and errors of one point per decade
+ *                    linreg       a fit by hand with its confidence interval, groups
+ *                    zimm         M, Rg, B2 of synthetic Zimm / Berry / Guinier data
+ *                    channels     rs_combine_channels: unused channels (-1 / -2),
+ *                                 mean of equal channels, best / weighted channel
+ *                    attenuator   bands of the table of Instruments.ALVTUE (at_classify):
+ *                                 every nominal intensity, the tolerance at both ends,
+ *                                 the gaps between the attenuators; the monitor
+ *                                 intensities of the example files (st_read_file)
+ *                  The engines are those of the MEX files (libls). Prints one line per
+ *                  failed check and a summary; the exit status is 1 if a check failed.
+ *                  usage: ls_check [directory of the example data, default
+ *                  ../example/example-data/LS]
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <math.h>
+#include <dirent.h>
+
+/*  the engines of the MEX files (libls) */
+#include "ls.h"
+
+#define CHECK_PATH 1024
+
+static int n_checks, n_failed;
+
+/*  count a check, print it if it failed */
+static int check(int ok, int line, const char *fmt, ...)
+{
+    va_list ap;
+
+    n_checks++;
+    if (ok)
+        return 1;
+    n_failed++;
+    fprintf(stderr, "ls_check.c:%d: ", line);
+    va_start(ap, fmt);
+    vfprintf(stderr, fmt, ap);
+    va_end(ap);
+    fputc('\n', stderr);
+    return 0;
+}
+
+#define CHECK(ok, ...) check((ok), __LINE__, __VA_ARGS__)
+
+/*  table of Instruments.ALVTUE.Attenuator (keep in sync with ALVTUE.m) */
+static const double alvtue_monitor[] = { 886, 2660, 14550, 56270, 146900, 452200, 1632000 };
+#define ALVTUE_N_ATT 7
+
+static int classify(double imon)
+{
+    int index;
+    at_classify(alvtue_monitor, ALVTUE_N_ATT, AT_TOLERANCE, &imon, 1, &index);
+    return index;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  check_example_monitor
+ *  Description:  attenuator of every *.ASC file of dir: all expected_1 (n_1 files),
+ *                or, if n_2 > 0, n_1 files at expected_1 and n_2 at expected_2
+ * =====================================================================================
+ */
+static void check_example_monitor(const char *dir, int expected_1, int n_1, int expected_2,
+        int n_2)
+{
+    char path[CHECK_PATH];
+    struct dirent *e;
+    st_file s;
+    DIR *d;
+    size_t len;
+    int index, count_1 = 0, count_2 = 0, other = 0;
+
+    if (!CHECK((d = opendir(dir)) != NULL, "cannot open %s", dir))
+        return;
+    while ((e = readdir(d)))
+    {
+        len = strlen(e->d_name);
+        if (len < 4 || strcmp(e->d_name + len - 4, ".ASC") != 0)
+            continue;
+        snprintf(path, sizeof(path), "%s/%s", dir, e->d_name);
+        if (!CHECK(st_read_file(path, &s), "cannot read %s", path))
+            continue;
+        index = classify(s.imon);
+        if (index == expected_1)
+            count_1++;
+        else if (n_2 > 0 && index == expected_2)
+            count_2++;
+        else
+        {
+            other++;
+            CHECK(0, "%s: Imon %g classified as %d", path, s.imon, index);
+        }
+    }
+    closedir(d);
+    CHECK(count_1 == n_1 && count_2 == n_2 && other == 0,
+            "%s: %d files at attenuator %d (expected %d), %d at %d (expected %d), %d other",
+            dir, count_1, expected_1, n_1, count_2, expected_2, n_2, other);
+}
+
+static void check_attenuator(const char *example)
+{
+    char dir[CHECK_PATH];
+    double gap, bad[] = { 0, -1, NAN, INFINITY };
+    int i;
+
+    for (i = 0; i < ALVTUE_N_ATT; i++)
+    {
+        CHECK(classify(alvtue_monitor[i]) == i, "nominal intensity of attenuator %d", i);
+        CHECK(classify(alvtue_monitor[i] * 1.49) == i, "attenuator %d, 1.49 x nominal", i);
+        CHECK(classify(alvtue_monitor[i] / 1.49) == i, "attenuator %d, nominal / 1.49", i);
+        if (i + 1 < ALVTUE_N_ATT)
+        {
+            /*  the geometric mean of two neighbours is outside both bands */
+            gap = sqrt(alvtue_monitor[i] * alvtue_monitor[i + 1]);
+            CHECK(classify(gap) == -1, "gap between attenuators %d and %d (%g)", i, i + 1, gap);
+        }
+    }
+    CHECK(classify(alvtue_monitor[0] / 1.51) == -1, "below the table");
+    CHECK(classify(alvtue_monitor[ALVTUE_N_ATT - 1] * 1.51) == -1, "above the table");
+    /*  the former boundaries: 0.1% at 1.9e3 was 0.3%, 1.5e6 was 33% */
+    CHECK(classify(1.63e6) == 6 && classify(1.5e6) == 6, "unattenuated example intensity");
+    for (i = 0; i < 4; i++)
+        CHECK(classify(bad[i]) == -1, "invalid Imon %g", bad[i]);
+    i = 0;
+    CHECK(at_classify(alvtue_monitor, ALVTUE_N_ATT, 1.0, alvtue_monitor, 1, &i) == -1,
+            "tolerance 1 rejected");
+
+    /*  2010-03-27: no attenuator; 2010-03-28: 15 files at 33%, 6 at 10% */
+    snprintf(dir, sizeof(dir), "%s/2010_03_27_FZ", example);
+    check_example_monitor(dir, 6, 81, -1, 0);
+    snprintf(dir, sizeof(dir), "%s/2010_03_28_FZ", example);
+    check_example_monitor(dir, 5, 15, 4, 6);
+}
+
+/*  a within the relative tolerance rel of b (b != 0) */
+static int near(double a, double b, double rel)
+{
+    return fabs(a - b) <= rel * fabs(b);
+}
+
+/*  deterministic noise in [-1, 1] (the checks must not depend on a seed) */
+static double wobble(int k)
+{
+    double x = sin(12.9898 * k + 78.233) * 43758.5453;
+    return 2 * (x - floor(x)) - 1;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  check_datetime
+ *  Description:  serial date numbers of matlab's datenum and the builtin formats
+ * =====================================================================================
+ */
+static void check_datetime(void)
+{
+    double serial;
+    int hint = 0;
+
+    CHECK(dt_datenum(2010, 3, 27, 0, 0, 0) == 734224, "datenum(2010, 3, 27)");
+    CHECK(dt_datenum(2000, 1, 1, 0, 0, 0) == 730486, "datenum(2000, 1, 1)");
+    CHECK(dt_datenum(2012, 2, 29, 0, 0, 0) - dt_datenum(2012, 2, 28, 0, 0, 0) == 1, "leap day");
+    CHECK(near(dt_datenum(2010, 3, 27, 18, 0, 0), 734224.75, 1e-12), "datenum(2010, 3, 27, 18, 0, 0)");
+    /*  the ALV header of the example files: "3/27/2010" "10:31:47 AM" */
+    CHECK(dt_parse("\"3/27/2010\"\t\"10:31:47 AM\"", dt_builtin_formats, DT_N_BUILTIN, &hint,
+                &serial) && near(serial, 734224 + (10 * 3600 + 31 * 60 + 47) / 86400.0, 1e-12),
+            "ALV date / time (AM): %.8f", serial);
+    CHECK(dt_parse("\"3/27/2010\"\t\"12:15:00 PM\"", dt_builtin_formats, DT_N_BUILTIN, &hint,
+                &serial) && near(serial, 734224 + (12 * 60 + 15) / 1440.0, 1e-12),
+            "ALV date / time (12 PM): %.8f", serial);
+    CHECK(dt_parse("\"3/27/2010\"\t\"12:15:00 AM\"", dt_builtin_formats, DT_N_BUILTIN, &hint,
+                &serial) && near(serial, 734224 + 15 / 1440.0, 1e-12),
+            "ALV date / time (12 AM): %.8f", serial);
+    CHECK(!dt_parse("27 March 2010", dt_builtin_formats, DT_N_BUILTIN, &hint, &serial)
+            && isnan(serial), "unknown format");
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  check_cumulants
+ *  Description:  g = exp(-2 Gamma t + mu2 t^2 - mu3 / 3 t^3): the polynomial of every
+ *                order is recovered exactly
+ * =====================================================================================
+ */
+static void check_cumulants(void)
+{
+    enum { N = 80 };
+    const double gamma = 2.5, mu2 = 0.8, mu3 = 0.3;    /* ms^-1, ms^-2, ms^-3 */
+    double t[N], g[N], dg[N];
+    cu_result r;
+    int k, order;
+
+    for (order = 1; order <= CU_MAX_ORDER; order++)
+    {
+        for (k = 0; k < N; k++)
+        {
+            t[k]  = 1e-4 * pow(10, k / 25.0);
+            g[k]  = exp(-2 * gamma * t[k] + (order > 1) * mu2 * t[k] * t[k]
+                    - (order > 2) * mu3 / 3 * t[k] * t[k] * t[k]);
+            dg[k] = 1e-3;
+        }
+        CHECK(cu_cumulants(t, g, dg, N, order, 0.15, &r), "cumulants order %d failed", order);
+        CHECK(fabs(r.coeff[0]) < 1e-9, "cumulants order %d: loga %g", order, r.coeff[0]);
+        CHECK(near(r.coeff[1], gamma, 1e-8), "cumulants order %d: Gamma %g", order, r.coeff[1]);
+        if (order > 1)
+            CHECK(near(r.coeff[2], mu2, 1e-6), "cumulants order %d: mu2 %g", order, r.coeff[2]);
+        if (order > 2)
+            CHECK(near(r.coeff[3], mu3, 1e-5), "cumulants order %d: mu3 %g", order, r.coeff[3]);
+        /*  only g > min_g */
+        for (k = 0; k < N && g[k] > 0.15; k++);
+        CHECK(r.n == k, "cumulants order %d: %d points used, expected %d", order, r.n, k);
+    }
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  check_global_fit
+ *  Description:  DoubleBKG of five correlograms sharing D1, D2 (small deterministic
+ *                noise): the shared fit and the separate fits recover D1, D2
+ * =====================================================================================
+ */
+static void check_global_fit(void)
+{
+    enum { N = 5, M = 120, L = 3, G = 2 };
+    const double D1 = 4, D2 = 0.4, A1 = 0.75, A2 = 0.15, b = 2e-4;
+    const double lower[] = { 0, 0, -1e-3, 0.5, 0 }, upper[] = { 1, 1, 1e-3, 100, 2.5 };
+    const double start[] = { 0.9, 0.1, 0, 6, 0.6 };
+    double t[N * M], g[N * M], w[N * M], q2[N], a, q;
+    double xl[L * N], xg[G * N], dxl[L * N], dxg[G * N];
+    int offset[N + 1], i, k, ok;
+    gf_problem p;
+    gf_info info;
+
+    for (i = 0; i < N; i++)
+    {
+        q = 4 * M_PI * 1.332 * sin((30 + 25 * i) * M_PI / 360) / 6328;
+        q2[i] = q * q;
+        offset[i] = i * M;
+        for (k = 0; k < M; k++)
+        {
+            t[i * M + k] = 1e-4 * pow(10, k / 20.0);
+            a = A1 * exp(-GF_D_TO_GAMMA * D1 * q2[i] * t[i * M + k])
+                + A2 * exp(-GF_D_TO_GAMMA * D2 * q2[i] * t[i * M + k]);
+            g[i * M + k] = a * a + b + 1e-4 * wobble(i * M + k);
+            w[i * M + k] = 1e8;
+        }
+    }
+    offset[N] = N * M;
+    p.model    = GF_DOUBLE_BKG;
+    p.n_local  = L;
+    p.n_global = G;
+    p.n_points = N;
+    p.t        = t;
+    p.g        = g;
+    p.w        = w;
+    p.offset   = offset;
+    p.q2       = q2;
+    p.lower    = lower;
+    p.upper    = upper;
+
+    for (i = 0; i < N; i++)
+        for (k = 0; k < L; k++)
+            xl[i * L + k] = start[k];
+    for (k = 0; k < G; k++)
+        xg[k] = start[L + k];
+    ok = gf_fit(&p, xl, xg, dxl, dxg, 1000, 1e-10, &info);
+    CHECK(ok && !info.stalled, "global fit not converged (%d iterations, stalled %d)", info.iterations, info.stalled);
+    CHECK(near(xg[0], D1, 2e-3) && near(xg[1], D2, 1e-2), "global fit: D1 %g, D2 %g", xg[0], xg[1]);
+    CHECK(near(xl[0], A1, 2e-3) && near(xl[1], A2, 2e-2), "global fit: A1 %g, A2 %g", xl[0], xl[1]);
+    CHECK(dxg[0] > 0 && dxg[0] < 0.1 * D1, "global fit: dD1 %g", dxg[0]);
+    CHECK(info.dof == N * M - N * L - G, "global fit: dof %d", info.dof);
+
+    for (i = 0; i < N; i++)
+    {
+        for (k = 0; k < L; k++)
+            xl[i * L + k] = start[k];
+        for (k = 0; k < G; k++)
+            xg[i * G + k] = start[L + k];
+    }
+    ok = gf_fit_each(&p, xl, xg, dxl, dxg, 1000, 1e-10, &info);
+    CHECK(ok && info.converged == N, "separate fits: %d of %d converged", info.converged, N);
+    for (i = 0; i < N; i++)
+        CHECK(near(xg[i * G], D1, 1e-2) && near(xg[i * G + 1], D2, 5e-2),
+                "separate fit %d: D1 %g, D2 %g", i, xg[i * G], xg[i * G + 1]);
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  check_rebin
+ *  Description:  three decades of 10 lags each into 1 point per decade: means,
+ *                geometric mean lags and propagated errors; unusable lags skipped
+ * =====================================================================================
+ */
+static void check_rebin(void)
+{
+    enum { N = 30 };
+    double t[2 * N], g[2 * N], dg[2 * N], tr[2 * N], gr[2 * N], dgr[2 * N];
+    double per_decade[] = { 1, 0 };
+    int offset[] = { 0, N, 2 * N }, offset_out[3], k, m;
+
+    for (k = 0; k < N; k++)
+    {
+        t[k]  = t[N + k] = pow(10, k / 10.0);
+        g[k]  = g[N + k] = 0.5 + (k / 10) * 0.1;
+        dg[k] = dg[N + k] = 0.1;
+    }
+    g[N + 3] = NAN;                 /* skipped when copied */
+    m = rb_rebin(t, g, dg, N, 1, tr, gr, dgr);
+    CHECK(m == 3, "rebin: %d points, expected 3", m);
+    for (k = 0; k < 3 && k < m; k++)
+        CHECK(near(gr[k], 0.5 + 0.1 * k, 1e-12) && near(tr[k], pow(10, k + 0.45), 1e-12)
+                && near(dgr[k], 0.1 / sqrt(10), 1e-12),
+                "rebin decade %d: t %g, g %g, dg %g", k, tr[k], gr[k], dgr[k]);
+    m = rb_batch(t, g, dg, offset, 2, per_decade, 2, tr, gr, dgr, offset_out);
+    CHECK(m == 3 + N - 1 && offset_out[0] == 0 && offset_out[1] == 3 && offset_out[2] == m,
+            "rebin batch: %d points, offsets %d %d %d", m, offset_out[0], offset_out[1], offset_out[2]);
+    CHECK(tr[3] == t[0] && tr[3 + 3] == t[4], "rebin batch: lags copied without per_decade");
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  check_linreg
+ *  Description:  exact lines, a fit by hand with its confidence interval, groups
+ * =====================================================================================
+ */
+static void check_linreg(void)
+{
+    const double x[] = { 0, 1, 2, 0, 1, 2, 3 }, y[] = { 0, 2, 1, 2, 5, 8, 11 };
+    const double dy[] = { 1, 1, 1, 1, 1, 1, 1 };
+    const int offset[] = { 0, 3, 7 };
+    lr_result r[2];
+
+    /*  y = 0.5 + 0.5 x, chi2 = 1.5, var(b1) = chi2 / dof / Sxx = 0.75, t95(1) = 12.7062 */
+    CHECK(lr_fit(x, y, dy, 3, 1, 0, r), "linreg failed");
+    CHECK(near(r[0].coeff[0], 0.5, 1e-12) && near(r[0].coeff[1], 0.5, 1e-12),
+            "linreg: %g + %g x", r[0].coeff[0], r[0].coeff[1]);
+    CHECK(near(r[0].chi2, 1.5, 1e-12) && r[0].dof == 1, "linreg: chi2 %g, dof %d", r[0].chi2, r[0].dof);
+    CHECK(near(r[0].error[1], 12.7062047 * sqrt(0.75), 1e-6), "linreg: slope error %g", r[0].error[1]);
+    /*  y = 2 + 3 x exactly */
+    CHECK(lr_batch(x, y, dy, offset, 2, 1, 0, r) == 2, "linreg batch failed");
+    CHECK(near(r[1].coeff[0], 2, 1e-12) && near(r[1].coeff[1], 3, 1e-12) && r[1].chi2 < 1e-20,
+            "linreg batch: %g + %g x", r[1].coeff[0], r[1].coeff[1]);
+    /*  through the origin: y = 11 / 3 x for x = 3 alone */
+    CHECK(lr_fit(x + 6, y + 6, dy, 1, 1, 1, r) && near(r[0].coeff[0], 11 / 3.0, 1e-12),
+            "linreg through the origin: %g x", r[0].coeff[0]);
+    CHECK(!lr_fit(x, y, dy, 1, 1, 0, r) && isnan(r[0].coeff[0]), "linreg: undetermined");
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  check_zimm
+ *  Description:  Kc/R of 6 angles x 3 concentrations from M, Rg, B2 with the model of
+ *                each extrapolation: zb_fit recovers them
+ * =====================================================================================
+ */
+static void check_zimm(void)
+{
+    enum { N_ANGLES = 6, N_C = 3, N = N_ANGLES * N_C };
+    const double M = 66400, Rg = 30, B2 = 1.2e-4;       /* g/mol, A, mol ml / g^2 */
+    const char *name[] = { "Zimm", "Berry", "Guinier" };
+    double q2[N], c[N], kcr[N], dkcr[N], q, y;
+    zb_result r;
+    int model, i, j, k;
+
+    for (model = ZB_ZIMM; model <= ZB_GUINIER; model++)
+    {
+        for (i = 0; i < N_ANGLES; i++)
+            for (j = 0; j < N_C; j++)
+            {
+                k = i * N_C + j;
+                q = 4 * M_PI * 1.332 * sin((30 + 20 * i) * M_PI / 360) / 6328;
+                q2[k] = q * q;
+                c[k]  = 1e-3 * (1 << j);                 /* g/ml */
+                switch (model)
+                {
+                    case ZB_BERRY:
+                        y      = (1 + Rg * Rg * q2[k] / 6) / sqrt(M) + B2 * sqrt(M) * c[k];
+                        kcr[k] = y * y;
+                        break;
+                    case ZB_GUINIER:
+                        kcr[k] = exp(-log(M) + Rg * Rg * q2[k] / 3 + 2 * B2 * M * c[k]);
+                        break;
+                    default:
+                        kcr[k] = (1 + Rg * Rg * q2[k] / 3) / M + 2 * B2 * c[k];
+                }
+                dkcr[k] = 0.01 * kcr[k];
+            }
+        CHECK(zb_fit(q2, c, kcr, dkcr, NULL, N, model, &r), "%s failed", name[model]);
+        CHECK(near(r.p[0], M, 1e-8) && near(r.p[1], Rg, 1e-6) && near(r.p[2], B2, 1e-8),
+                "%s: M %g, Rg %g, B2 %g", name[model], r.p[0], r.p[1], r.p[2]);
+        CHECK(r.n == N && r.dof == N - ZB_N_PAR, "%s: n %d, dof %d", name[model], r.n, r.dof);
+    }
+    /*  the first angle alone: undetermined */
+    CHECK(!zb_fit(q2, c, kcr, dkcr, NULL, N_C, ZB_ZIMM, &r) && isnan(r.p[0]), "Zimm of a single angle");
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  check_combine_channels
+ *  Description:  4 channels, 3 and 4 unused (-1 and -2 placeholders); channel 2 has
+ *                half the noise of channel 1
+ * =====================================================================================
+ */
+static void check_combine_channels(void)
+{
+    enum { N = 200, CH = RS_MAX_CHANNELS };
+    double gc[N * CH], g0[N], g[N], dg[N], weight[RS_MAX_CHANNELS], e, mean;
+    int k, used;
+
+    for (k = 0; k < N; k++)
+    {
+        g0[k] = 0.8 * exp(-1e-2 * k);
+        e     = 1e-3 * wobble(k);
+        gc[k * CH]     = g0[k] + e;
+        gc[k * CH + 1] = g0[k] - e;
+        gc[k * CH + 2] = -1;
+        gc[k * CH + 3] = -2;
+    }
+    /*  equal noise: the mean is the true correlation function, up to the local
+     *  estimates of the noise */
+    used = rs_combine_channels(gc, N, CH, CH, 1, NULL, RS_CH_ALL, g, dg, weight);
+    CHECK(used == 2, "combine all: %d channels used", used);
+    for (k = 0, e = 0; k < N; k++)
+        e = fmax(e, fabs(g[k] - g0[k]));
+    CHECK(e < 2e-4, "combine all: largest deviation %g", e);
+    CHECK(weight[2] == 0 && weight[3] == 0, "combine all: unused channels weighted");
+    used = rs_combine_channels(gc, N, CH, CH, 1, NULL, 1, g, dg, weight);
+    CHECK(used == 1 && g[10] == gc[10 * CH], "channel 1 as it is");
+
+    /*  channel 2 with half the noise: best, and 4 times the weight of channel 1 */
+    for (k = 0; k < N; k++)
+        gc[k * CH + 1] = g0[k] - 0.5e-3 * wobble(k + N);
+    rs_combine_channels(gc, N, CH, CH, 1, NULL, RS_CH_BEST, g, dg, weight);
+    CHECK(weight[1] == 1 && weight[0] == 0, "best channel: weights %g %g", weight[0], weight[1]);
+    rs_combine_channels(gc, N, CH, CH, 1, NULL, RS_CH_WEIGHTED, g, dg, weight);
+    mean = weight[1] / (weight[0] + weight[1]);
+    CHECK(mean > 0.7 && mean < 0.9, "weighted channels: relative weight of channel 2 %g", mean);
+}
+
+int main(int argc, char **argv)
+{
+    const char *example = argc > 1 ? argv[1] : "../example/example-data/LS";
+
+    check_datetime();
+    check_cumulants();
+    check_global_fit();
+    check_rebin();
+    check_linreg();
+    check_zimm();
+    check_combine_channels();
+    check_attenuator(example);
+
+    printf("ls_check: %d checks, %d failed\n", n_checks, n_failed);
+    return n_failed > 0;
+}
@@ -0,0 +1,281 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  synth.c
+ *
+ *    Description:  write synthetic ALV autosave series (.ASC) with the layout of the
+ *                  ALV-7004 files read by the instrument classes:
+ *                    header (date, time, temperature, angle, mean count rates),
+ *                    "Correlation" (multi-tau lags [ms], g2 - 1 of 4 channels: the
+ *                    pseudo cross pair, then the auto correlations, written as -1 or
+ *                    -2 (either, per file, as in the example files) for the first
+ *                    SYNTH_AUTO_LAG lags with the rounding noise of the ALV),
+ *                    "Count Rate" (trace of the run), Monitor Diode,
+ *                    "StandardDeviation" (lags, error of g2 - 1).
+ *                  g1 is a sum of modes with log-normal spread in D (Gamma = D q^2),
+ *                  g2 - 1 = beta g1^2 plus gaussian noise decreasing with the channel
+ *                  width of the multi-tau grid. Dust bursts add a slow mode and spikes
+ *                  of the count rate. Files are named <dir>/sNN_AAAA_CCCC.ASC
+ *                  (sample, angle, count), as the ALV autosave.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "synth.h"
+
+#define SYNTH_MAX_LAGS     1024
+#define SYNTH_MODE_SAMPLES 7        /* discrete D's per mode */
+#define SYNTH_TRACE        32       /* lines of the count rate trace */
+#define SYNTH_DUST_D       0.02     /* [A^2/ns] diffusion of the dust */
+#define SYNTH_DUST_WEIGHT  0.3      /* share of the dust in g1 during a burst */
+#define SYNTH_DURATION     30       /* [s] of every count */
+#define SYNTH_AUTO_LAG     12       /* first lag of the auto correlations */
+#define SYNTH_AUTO_NOISE   3        /* noise of the auto correlations / cross pair */
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+typedef struct
+{
+    unsigned long long s;
+    int    has_spare;
+    double spare;
+} synth_rng;
+
+/*  splitmix64: fast, reproducible on every platform */
+static double synth_uniform(synth_rng *r)
+{
+    unsigned long long z = (r->s += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    z ^= z >> 31;
+    return ((z >> 11) + 0.5) / 9007199254740992.0;
+}
+
+static double synth_normal(synth_rng *r)
+{
+    double u, v;
+    if (r->has_spare)
+    {
+        r->has_spare = 0;
+        return r->spare;
+    }
+    u = synth_uniform(r);
+    v = synth_uniform(r);
+    r->spare     = sqrt(-2 * log(u)) * sin(2 * M_PI * v);
+    r->has_spare = 1;
+    return sqrt(-2 * log(u)) * cos(2 * M_PI * v);
+}
+
+void synth_defaults(synth_config *c)
+{
+    memset(c, 0, sizeof(synth_config));
+    c->n_angles   = 13;
+    c->n_counts   = 3;
+    c->angle_min  = 30;
+    c->angle_max  = 150;
+    c->lag_min    = 3.125e-6;
+    c->lag_max    = 1.2e4;
+    c->n_linear   = 32;
+    c->n_block    = 8;
+    c->n_modes    = 2;
+    c->D[0]       = 6;              /* monomer of a globular protein */
+    c->D[1]       = 0.6;            /* aggregates */
+    c->weight[0]  = 0.85;
+    c->weight[1]  = 0.15;
+    c->width      = 0.15;
+    c->beta       = 0.63;
+    c->noise      = 2e-2;
+    c->dust       = 0.05;
+    c->count_rate = 125;
+    c->monitor    = 1.63e6;
+    c->T          = 295.8;
+    c->n          = 1.332;
+    c->lambda     = 632.8;
+    c->seed       = 1;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  synth_lags
+ *  Description:  multi-tau lag grid of the ALV correlator: n_linear channels spaced
+ *                by lag_min, then blocks of n_block channels with doubled spacing up
+ *                to lag_max. Returns the number of lags.
+ * =====================================================================================
+ */
+int synth_lags(const synth_config *c, double *tau, int capacity)
+{
+    double t = 0, dt = c->lag_min;
+    int n = 0, k;
+    for (k = 0; k < c->n_linear && n < capacity; k++)
+        tau[n++] = (t += dt);
+    while (n < capacity)
+    {
+        dt *= 2;
+        for (k = 0; k < c->n_block && n < capacity && t + dt <= c->lag_max; k++)
+            tau[n++] = (t += dt);
+        if (t + dt > c->lag_max)
+            break;
+    }
+    return n;
+}
+
+/*  12 hour clock of the english ALV locale */
+static void synth_datetime(long seconds, char *date, char *time)
+{
+    long day = seconds / 86400, s = seconds % 86400;
+    int h = (int) (s / 3600), m = (int) (s / 60 % 60);
+    sprintf(date, "3/%ld/2010", 27 + day % 4);
+    sprintf(time, "%d:%02d:%02d %s", h % 12 == 0 ? 12 : h % 12, m, (int) (s % 60),
+            h < 12 ? "AM" : "PM");
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  synth_file
+ *  Description:  write one count. Returns the bytes written, -1 on error.
+ * =====================================================================================
+ */
+static long synth_file(const synth_config *c, const char *path, double angle, long start,
+        const double *tau, int n_lags, const double *D, const double *w, int n_d,
+        int dust, synth_rng *r)
+{
+    FILE *fp = fopen(path, "w");
+    double q = 4 * M_PI * c->n * sin(0.5 * angle * M_PI / 180) / (10 * c->lambda);
+    double cr = c->count_rate / sin(angle * M_PI / 180);
+    double g1, g, sigma[SYNTH_MAX_LAGS], ch[4], dt;
+    /*  unused lags of the auto correlations: -1 in some files, -2 in others */
+    double none = synth_uniform(r) < 0.5 ? -1 : -2;
+    char date[32], time[32];
+    int i, k, j;
+    long bytes;
+
+    if (!fp)
+        return -1;
+    synth_datetime(start, date, time);
+    if (dust)
+        cr *= 1.5;
+    fprintf(fp, "ALV-7004/FAST Data\n");
+    fprintf(fp, "Date :\t\"%s\"\n", date);
+    fprintf(fp, "Time :\t\"%s\"\n", time);
+    fprintf(fp, "Samplename : \t\"synthetic\"\n");
+    for (i = 0; i < 10; i++)
+        fprintf(fp, "SampMemo(%d) : \t\"\"\n", i);
+    fprintf(fp, "Temperature [K] :\t%14.5f\n", c->T + 0.01 * synth_normal(r));
+    fprintf(fp, "Viscosity [cp]  :\t%14.5f\n", 0.94015);
+    fprintf(fp, "Refractive Index:\t%14.5f\n", c->n);
+    fprintf(fp, "Wavelength [nm] :\t%14.5f\n", c->lambda);
+    fprintf(fp, "Angle [\xb0]       :\t%14.5f\n", angle);
+    fprintf(fp, "Duration [s]    :\t%10d\n", SYNTH_DURATION);
+    fprintf(fp, "Runs            :\t%10d\n", 1);
+    fprintf(fp, "Mode            :\t\"C-CH0/1+1/0\"\n");
+    fprintf(fp, "MeanCR0 [kHz]   :\t%14.5f\n", cr * (1 + 0.01 * synth_normal(r)));
+    fprintf(fp, "MeanCR1 [kHz]   :\t%14.5f\n", 1.15 * cr * (1 + 0.01 * synth_normal(r)));
+    fprintf(fp, "MeanCR2 [kHz]   :\t%14.5f\n", 0.0);
+    fprintf(fp, "MeanCR3 [kHz]   :\t%14.5f\n", 0.0);
+    fprintf(fp, "\n\"Correlation\"\n");
+    for (k = 0; k < n_lags; k++)
+    {
+        g1 = 0;
+        for (j = 0; j < n_d; j++)
+            g1 += w[j] * exp(-1e6 * D[j] * q * q * tau[k]);
+        if (dust)
+            g1 = (1 - SYNTH_DUST_WEIGHT) * g1
+                + SYNTH_DUST_WEIGHT * exp(-1e6 * SYNTH_DUST_D * q * q * tau[k]);
+        /*  noise falls with the channel width (averaging of the multi-tau bins) */
+        dt = k > 0 ? tau[k] - tau[k - 1] : tau[0];
+        sigma[k] = c->noise * sqrt(c->lag_min / dt) + 0.02 * c->noise;
+        g = c->beta * g1 * g1;
+        for (i = 0; i < 4; i++)
+            ch[i] = i < 2 ? g + sigma[k] * synth_normal(r)
+                : k < SYNTH_AUTO_LAG ? none : g + SYNTH_AUTO_NOISE * sigma[k] * synth_normal(r);
+        /*  the ALV writes some placeholders as -0.99974 */
+        if (k == SYNTH_AUTO_LAG - 2)
+            ch[3] = -0.99974;
+        fprintf(fp, "%14.5E\t%14.5E\t%14.5E\t%14.5E\t%14.5E\n", tau[k], ch[0], ch[1], ch[2], ch[3]);
+    }
+    fprintf(fp, "\n\"Count Rate\"\n");
+    for (i = 0; i < SYNTH_TRACE; i++)
+    {
+        double spike = dust && synth_uniform(r) < 0.2 ? 3 : 1;
+        double c0 = spike * cr * (1 + 0.015 * synth_normal(r));
+        double c1 = 1.15 * spike * cr * (1 + 0.015 * synth_normal(r));
+        fprintf(fp, "%14.5f\t%14.5f\t%14.5f\t%14.5f\t%14.5f\n",
+                (i + 1) * (double) SYNTH_DURATION / SYNTH_TRACE, c0, c1, c0, c1);
+    }
+    fprintf(fp, "\nMonitor Diode\t%.2f\n", c->monitor * (1 + 0.002 * synth_normal(r)));
+    fprintf(fp, "\"StandardDeviation\"\n");
+    for (k = 0; k < n_lags; k++)
+        fprintf(fp, "%14.5E\t%14.5E\n", tau[k], sigma[k]);
+    bytes = ftell(fp);
+    if (fclose(fp) != 0)
+        return -1;
+    return bytes;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  synth_series
+ *  Description:  write the n_angles x n_counts files of one sample into dir; paths
+ *                (n_angles * n_counts entries) receive the file names (malloc).
+ *                Returns the number of files, -1 on error.
+ * =====================================================================================
+ */
+int synth_series(const synth_config *c, const char *dir, int sample, char **paths,
+        synth_info *info)
+{
+    double tau[SYNTH_MAX_LAGS], D[SYNTH_MAX_MODES * SYNTH_MODE_SAMPLES];
+    double w[SYNTH_MAX_MODES * SYNTH_MODE_SAMPLES], sum = 0, x, angle;
+    synth_rng r = { 0, 0, 0 };
+    int n_lags, n_d = 0, a, k, j, n = 0, dust;
+    long bytes;
+
+    r.s = c->seed * 1000003ULL + (unsigned long long) sample;
+    n_lags = synth_lags(c, tau, SYNTH_MAX_LAGS);
+    /*  log-normal modes sampled at fixed quantiles (mean weight of g1 preserved) */
+    for (j = 0; j < c->n_modes && j < SYNTH_MAX_MODES; j++)
+        for (k = 0; k < SYNTH_MODE_SAMPLES; k++)
+        {
+            x = (k - (SYNTH_MODE_SAMPLES - 1) / 2.0) / ((SYNTH_MODE_SAMPLES - 1) / 4.0);
+            D[n_d] = c->D[j] * exp(c->width * x);
+            w[n_d] = c->weight[j] * exp(-0.5 * x * x);
+            sum   += w[n_d++];
+        }
+    info->D_true = 0;
+    for (j = 0; j < n_d; j++)
+    {
+        w[j] /= sum;
+        info->D_true += w[j] * D[j];
+    }
+    for (a = 0; a < c->n_angles; a++)
+    {
+        angle = c->n_angles > 1 ? c->angle_min + a * (c->angle_max - c->angle_min)
+            / (c->n_angles - 1) : c->angle_min;
+        for (k = 0; k < c->n_counts; k++, n++)
+        {
+            paths[n] = malloc(strlen(dir) + 32);
+            if (!paths[n])
+                return -1;
+            sprintf(paths[n], "%s/s%02d_%04d_%04d.ASC", dir, sample, a, k + 1);
+            dust = synth_uniform(&r) < c->dust;
+            info->n_dust += dust;
+            bytes = synth_file(c, paths[n], angle, 43200L + SYNTH_DURATION * n, tau, n_lags,
+                    D, w, n_d, dust, &r);
+            if (bytes < 0)
+                return -1;
+            info->bytes += bytes;
+        }
+    }
+    return n;
+}
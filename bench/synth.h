@@ -0,0 +1,56 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  synth.h
+ *
+ *    Description:  synthetic ALV autosave series (.ASC) for the benchmarks, see synth.c
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#ifndef SYNTH_H
+#define SYNTH_H
+
+#define SYNTH_MAX_MODES 4
+
+typedef struct
+{
+    int    n_angles;                /* angles per sample, evenly spaced in [angle_min, angle_max] */
+    int    n_counts;                /* counts per angle */
+    double angle_min, angle_max;    /* [deg] */
+    double lag_min, lag_max;        /* [ms] first lag, last lag of the multi-tau grid */
+    int    n_linear;                /* channels of the first (linear) block */
+    int    n_block;                 /* channels of every following block (lag step doubled) */
+    int    n_modes;                 /* modes of the size distribution */
+    double D[SYNTH_MAX_MODES];      /* [A^2/ns] diffusion coefficient of every mode */
+    double weight[SYNTH_MAX_MODES]; /* amplitude of every mode in g1 */
+    double width;                   /* relative log-normal width of every mode */
+    double beta;                    /* coherence factor: g2 - 1 = beta g1^2 */
+    double noise;                   /* standard deviation of g2 - 1 at the first lag */
+    double dust;                    /* probability of a dust burst per count */
+    double count_rate;              /* [kHz] mean count rate at 90 deg */
+    double monitor;                 /* monitor diode intensity */
+    double T;                       /* [K] */
+    double n;                       /* refraction index */
+    double lambda;                  /* [nm] */
+    unsigned long long seed;
+} synth_config;
+
+typedef struct
+{
+    double D_true;                  /* [A^2/ns] intensity weighted mean D of the modes */
+    int    n_dust;                  /* counts with a dust burst */
+    long   bytes;                   /* written */
+} synth_info;
+
+void synth_defaults(synth_config *c);
+int  synth_lags(const synth_config *c, double *tau, int capacity);
+int  synth_series(const synth_config *c, const char *dir, int sample, char **paths,
+        synth_info *info);
+
+#endif
@@ -0,0 +1,800 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  alv_autosave.c
+ *
+ *    Description:  readers of the ALV autosave files (.ASC), one line based parser
+ *                  for all of them (the fscanf token loops of read_dynamic_file_fast
+ *                  and read_static_from_autosave_fast are gone):
+ *                    rs_read_file    header, first channel of the correlation and
+ *                                    the standard deviation
+ *                    rh_read_header  date, time, temperature, angle only
+ *                    st_read_file    header with the mean count rates and the
+ *                                    monitor diode intensity
+ *                    as_read_file    all of them and the count rate trace in one
+ *                                    pass over the mapped file (combined DLS / SLS)
+ *                  and the normalization / crop of the correlation functions as
+ *                  DLS.Point.correct_G (rs_windows, rs_normalize).
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <unistd.h>
+#else
+#include <io.h>
+#endif
+
+#include "ls.h"
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  rs_reserve
+ *  Description:  grow the scratch buffers of f to hold at least n samples
+ * =====================================================================================
+ */
+static int rs_reserve(rs_file *f, int n)
+{
+    double *t, *g, *dg, *gc = NULL;
+    int capacity;
+    if (n <= f->capacity && (!f->channels || f->gc))
+        return 1;
+    capacity = f->capacity > 0 ? f->capacity : 512;
+    while (capacity < n)
+        capacity *= 2;
+    t  = realloc(f->t,  capacity * sizeof(double));
+    if (t)
+        f->t = t;
+    g  = realloc(f->g,  capacity * sizeof(double));
+    if (g)
+        f->g = g;
+    dg = realloc(f->dg, capacity * sizeof(double));
+    if (dg)
+        f->dg = dg;
+    /*  gc follows the capacity once allocated */
+    if ((f->channels || f->gc) && (gc = realloc(f->gc, (size_t) capacity * RS_MAX_CHANNELS * sizeof(double))))
+        f->gc = gc;
+    if (!t || !g || !dg || ((f->channels || f->gc) && !gc))
+        return 0;
+    f->capacity = capacity;
+    return 1;
+}
+
+void rs_free(rs_file *f)
+{
+    free(f->t);
+    free(f->g);
+    free(f->dg);
+    free(f->gc);
+    f->t = f->g = f->dg = f->gc = NULL;
+    f->n = f->n_dg = f->capacity = 0;
+}
+
+/* quoted value of a header line ('Date :	"3/27/2010"'), empty if not quoted */
+static void alv_quoted(const char *line, char *value, int length)
+{
+    const char *s = strchr(line, '"'), *e;
+    value[0] = '\0';
+    if (!s || !(e = strchr(s + 1, '"')))
+        return;
+    if (e - s - 1 < length)
+    {
+        memcpy(value, s + 1, e - s - 1);
+        value[e - s - 1] = '\0';
+    }
+}
+
+/* number after the ':' of a header line ('Angle [M-0]       :	      70.00000') */
+static double alv_number(const char *line, double missing)
+{
+    const char *s = strchr(line, ':');
+    return s ? atof(s + 1) : missing;
+}
+
+/* all channels of a correlation line into gc (first channel g, the others after end) */
+static void rs_channels(rs_file *f, double g, const char *end)
+{
+    double *gc = f->gc + (size_t) f->n * RS_MAX_CHANNELS;
+    char *next;
+    int j;
+    gc[0] = g;
+    for (j = 1; j < RS_MAX_CHANNELS; j++)
+    {
+        gc[j] = strtod(end, &next);
+        if (next == end)
+            break;
+        end = next;
+    }
+    if (j > f->n_ch)
+        f->n_ch = j;
+    for (; j < RS_MAX_CHANNELS; j++)
+        gc[j] = NAN;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  rs_read_file
+ *  Description:  read header (date, time, temperature, angle), the first channel of
+ *                the correlation and the standard deviation of an ALV autosave file.
+ *                dg is 1 if the file has no standard deviation (as read_data).
+ *                Returns the number of lags, 0 on error.
+ * =====================================================================================
+ */
+int rs_read_file(const char *path, rs_file *f)
+{
+    FILE *fp;
+    char line[RS_LINE_LENGTH], date[RS_DATETIME_LENGTH / 2], time[RS_DATETIME_LENGTH / 2];
+    char *end;
+    double t, g, t0;
+    long bytes;
+    int k, section = 0;            /* 0 header, 1 correlation, 2 skip, 3 standard deviation */
+
+    LS_SPAN_BEGIN(t0);
+    f->n = f->n_dg = f->n_ch = 0;
+    f->angle = f->temperature = 0;
+    f->mode[0] = date[0] = time[0] = '\0';
+    if ((fp = fopen(path, "r")) == NULL)
+        return 0;
+    while (fgets(line, RS_LINE_LENGTH, fp))
+    {
+        switch (section)
+        {
+        case 0:
+            if (strncmp(line, "\"Correlation\"", 13) == 0)
+                section = 1;
+            else if (strncmp(line, "Date", 4) == 0)
+                alv_quoted(line, date, sizeof(date));
+            else if (strncmp(line, "Time", 4) == 0)
+                alv_quoted(line, time, sizeof(time));
+            else if (strncmp(line, "Temperature", 11) == 0)
+                f->temperature = alv_number(line, 0);
+            else if (strncmp(line, "Angle", 5) == 0)
+                f->angle = alv_number(line, 0);
+            else if (strncmp(line, "Mode", 4) == 0)
+                alv_quoted(line, f->mode, sizeof(f->mode));
+            break;
+        case 1:
+            t = strtod(line, &end);
+            if (end == line)
+            {
+                section = 2;
+                break;
+            }
+            g = strtod(end, &end);
+            if (!rs_reserve(f, f->n + 1))
+            {
+                fclose(fp);
+                return 0;
+            }
+            f->t[f->n] = t;
+            f->g[f->n] = g;
+            if (f->channels)
+                rs_channels(f, g, end);
+            f->n++;
+            break;
+        case 2:
+            if (strncmp(line, "\"StandardDeviation\"", 19) == 0)
+                section = 3;
+            break;
+        case 3:
+            strtod(line, &end);
+            if (end == line || f->n_dg >= f->n)
+                break;
+            f->dg[f->n_dg++] = strtod(end, NULL);
+            break;
+        }
+    }
+    bytes = ftell(fp);
+    fclose(fp);
+    ls_count(LS_PARSE, 1, bytes > 0 ? bytes : 0);
+    /*  missing standard deviation: ones (as read_data), short: repeat the last one */
+    for (k = f->n_dg; k < f->n; k++)
+        f->dg[k] = f->n_dg > 0 ? f->dg[f->n_dg - 1] : 1;
+    snprintf(f->datetime, RS_DATETIME_LENGTH, "\"%s\" \"%s\"", date, time);
+    LS_SPAN_END(t0, LS_PARSE, "rs_read_file", path);
+    return f->n;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  rs_windows
+ *  Description:  index windows of the (ascending) lag grid t for the normalization
+ *                (limits[0] < t < limits[1]) and the crop (limits[2] < t < limits[3]).
+ *                Returns 0 if the grid is not ascending.
+ * =====================================================================================
+ */
+int rs_windows(const double *t, int n, const double *limits, rs_window *w)
+{
+    int k;
+    for (k = 1; k < n; k++)
+        if (t[k] < t[k - 1])
+            return 0;
+    for (w->n0 = 0; w->n0 < n && !(t[w->n0] > limits[0]); w->n0++);
+    for (w->n1 = w->n0; w->n1 < n && t[w->n1] < limits[1]; w->n1++);
+    for (w->c0 = 0; w->c0 < n && !(t[w->c0] > limits[2]); w->c0++);
+    for (w->c1 = w->c0; w->c1 < n && t[w->c1] < limits[3]; w->c1++);
+    return 1;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  rs_normalize
+ *  Description:  normalize and crop one correlation function into g, dg
+ *                (c1 - c0 samples). Returns the norm |mean(g over the window)|.
+ * =====================================================================================
+ */
+double rs_normalize(const rs_file *f, const rs_window *w, double *g, double *dg)
+{
+    const double *gs = f->g + w->c0, *dgs = f->dg + w->c0;
+    double norm = 0, inv;
+    int k, n = w->c1 - w->c0;
+
+    for (k = w->n0; k < w->n1; k++)
+        norm += f->g[k];
+    norm = fabs(norm / (w->n1 - w->n0));
+    /*  contiguous, branch free loops: vectorized by the compiler */
+    inv = 1 / norm;
+    for (k = 0; k < n; k++)
+        g[k] = gs[k] * inv;
+    for (k = 0; k < n; k++)
+        dg[k] = dgs[k] * inv;
+    ls_count(LS_NORMALIZE, 1, 0);
+    return norm;
+}
+
+/*  k-th smallest of x[0 ... m - 1] (Hoare's selection, x reordered: the values
+ *  before k are not larger, the ones after not smaller) */
+static double rs_select(double *x, int m, int k)
+{
+    double p, s;
+    int lo = 0, hi = m - 1, i, j;
+    while (lo < hi)
+    {
+        p = x[(lo + hi) / 2];
+        for (i = lo, j = hi; i <= j; )
+        {
+            while (x[i] < p)
+                i++;
+            while (x[j] > p)
+                j--;
+            if (i <= j)
+            {
+                s = x[i]; x[i++] = x[j]; x[j--] = s;
+            }
+        }
+        if (k <= j)
+            hi = j;
+        else if (k >= i)
+            lo = i;
+        else
+            break;
+    }
+    return x[k];
+}
+
+/*  squared second differences of a channel relative to dg, d2[k] for the lags
+ *  k = 1 ... n - 2 (the noise of the lags is independent, the curvature of g is
+ *  small against it where dg is large); NaN where one of the three lags has no
+ *  value (see RS_NO_VALUE) and at the first and the last lag */
+static void rs_second_differences(const double *gc, int n, int lag_stride, const double *dg, double *d2)
+{
+    double x0, x1, x2;
+    int k;
+    for (k = 0; k < n; k++)
+        d2[k] = NAN;
+    for (k = 1; k < n - 1; k++)
+    {
+        x0 = gc[(k - 1) * lag_stride];
+        x1 = gc[k * lag_stride];
+        x2 = gc[(k + 1) * lag_stride];
+        if (!(x0 > RS_NO_VALUE && x1 > RS_NO_VALUE && x2 > RS_NO_VALUE))
+            continue;
+        d2[k] = (x2 - 2 * x1 + x0) / (dg ? dg[k] : 1);
+        d2[k] *= d2[k];
+    }
+}
+
+/*  variance of a channel relative to dg^2 from the squared second differences of
+ *  the lags k0 ... k1 - 1: median of d2 / 6, robust against the lags where the
+ *  curvature dominates; NaN with less than min of them */
+static double rs_noise(const double *d2, int k0, int k1, int min, double *scratch)
+{
+    double median, above;
+    int k, m = 0;
+    for (k = k0; k < k1; k++)
+        if (isfinite(d2[k]))
+            scratch[m++] = d2[k];
+    if (m == 0 || m < min)
+        return NAN;
+    median = rs_select(scratch, m, m / 2);
+    if (m % 2 == 0)
+    {
+        /*  the values before m / 2 are not larger: the lower middle is their maximum */
+        for (above = median, median = scratch[0], k = 1; k < m / 2; k++)
+            if (scratch[k] > median)
+                median = scratch[k];
+        median = 0.5 * (median + above);
+    }
+    /*  var(x1 - 2 x2 + x3) = 6 var(x), the median of chi2(1) is 0.4549 */
+    return median / (6 * 0.4549);
+}
+
+/*  lags of a channel with a value: the ALV software writes -1 for the lags a
+ *  channel does not cover (all of an unused channel, the first lags of the auto
+ *  correlations), with some rounding noise (-0.99974); 0 none, 1 some, 2 all */
+static int rs_valid(const double *gc, int n, int lag_stride)
+{
+    int k, m = 0;
+    for (k = 0; k < n; k++)
+        m += gc[k * lag_stride] > RS_NO_VALUE;
+    return m == 0 ? 0 : m < n ? 1 : 2;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  rs_combine_channels
+ *  Description:  one correlation function from the n_ch channels of gc (lag k of
+ *                channel j at gc[k * lag_stride + j * ch_stride]); dg is the standard
+ *                deviation of the file, taken as the one of the first channel (may be
+ *                NULL: ones). The noise of every channel relative to the first
+ *                complete one (rho_j) is estimated from the second differences of
+ *                the lags: over all lags, and for the means over the RS_NOISE_WINDOW
+ *                lags around every RS_NOISE_STEP lags (a channel is used where at
+ *                least RS_NOISE_MIN of them have a value).
+ *                  select = j (1-based)     channel j as it is, dg scaled by sqrt(rho_j)
+ *                  select = RS_CH_WEIGHTED  inverse-variance mean of the first two
+ *                                           channels (the pseudo cross correlations
+ *                                           of the C-CH0/1+1/0 mode) with the weights
+ *                                           of every lag, dg / sqrt(sum(1 / rho_j))
+ *                                           (NaN at lags without any)
+ *                  select = RS_CH_ALL       as RS_CH_WEIGHTED with all channels (the
+ *                                           auto correlations start at a later lag)
+ *                  select = RS_CH_BEST      the channel of the lowest noise among those
+ *                                           covering all lags
+ *                weight[RS_MAX_CHANNELS] (may be NULL): weights of the channels, mean
+ *                over the lags with a value. Returns the number of channels used, 0
+ *                if none.
+ * =====================================================================================
+ */
+int rs_combine_channels(const double *gc, int n, int n_ch, int lag_stride, int ch_stride,
+        const double *dg, int select, double *g, double *dg_out, double *weight)
+{
+    double rho[RS_MAX_CHANNELS], w[RS_MAX_CHANNELS], r[RS_MAX_CHANNELS], local[RS_MAX_CHANNELS];
+    double sw = 0, ref = NAN, v, s, x, rr;
+    double *d2, *scratch;
+    int valid[RS_MAX_CHANNELS], i, j, k, k0, k1, used = 0, best = -1, first = -1, n_mean;
+
+    if (n_ch > RS_MAX_CHANNELS)
+        n_ch = RS_MAX_CHANNELS;
+    d2      = malloc((size_t) (n > 0 ? n : 1) * (RS_MAX_CHANNELS + 1) * sizeof(double));
+    scratch = d2 ? d2 + (size_t) (n > 0 ? n : 1) * RS_MAX_CHANNELS : NULL;
+    for (j = 0; j < RS_MAX_CHANNELS; j++)
+    {
+        w[j]     = 0;
+        rho[j]   = NAN;
+        valid[j] = j < n_ch ? rs_valid(gc + j * ch_stride, n, lag_stride) : 0;
+        if (valid[j] && d2)
+        {
+            rs_second_differences(gc + j * ch_stride, n, lag_stride, dg, d2 + (size_t) j * n);
+            rho[j] = rs_noise(d2 + (size_t) j * n, 0, n, 1, scratch);
+        }
+        if (valid[j] == 2 && first < 0)
+        {
+            first = j;
+            ref   = rho[j];
+        }
+    }
+    /*  relative to the first complete channel; equal weights without a noise estimate */
+    for (j = 0; j < n_ch; j++)
+    {
+        if (!valid[j])
+            continue;
+        rho[j] = ref > 0 && rho[j] > 0 ? rho[j] / ref : 1;
+        if (valid[j] == 2 && (best < 0 || rho[j] < rho[best]))
+            best = j;
+    }
+
+    if (select > 0 || select == RS_CH_BEST)
+    {
+        j = select > 0 ? select - 1 : best;
+        if (j < 0 || j >= n_ch)
+        {
+            free(d2);
+            return 0;
+        }
+        v = isnan(rho[j]) ? 1 : sqrt(rho[j]);
+        for (k = 0; k < n; k++)
+        {
+            g[k]      = gc[k * lag_stride + j * ch_stride];
+            dg_out[k] = (dg ? dg[k] : 1) * v;
+        }
+        w[j] = sw = 1;
+    }
+    else
+    {
+        n_mean = select == RS_CH_ALL ? n_ch : (n_ch < 2 ? n_ch : 2);
+        for (k = 0; k < n; k++)
+        {
+            /*  for every RS_NOISE_STEP lags: noise of the RS_NOISE_WINDOW lags
+             *  around them relative to the one of the first complete channel there */
+            if (k % RS_NOISE_STEP == 0)
+            {
+                k0 = k + RS_NOISE_STEP / 2 - RS_NOISE_WINDOW / 2;
+                k0 = k0 + RS_NOISE_WINDOW < n ? k0 : n - RS_NOISE_WINDOW;
+                k0 = k0 > 0 ? k0 : 0;
+                k1 = k0 + RS_NOISE_WINDOW < n ? k0 + RS_NOISE_WINDOW : n;
+                rr = first >= 0 && d2 ? rs_noise(d2 + (size_t) first * n, k0, k1, RS_NOISE_MIN, scratch) : NAN;
+                for (j = 0; j < n_mean; j++)
+                    local[j] = valid[j] && rr > 0
+                        ? rs_noise(d2 + (size_t) j * n, k0, k1, RS_NOISE_MIN, scratch) / rr : NAN;
+            }
+            /*  the channels with a value at this lag and a noise estimate around
+             *  it (a channel starting at a later lag is used once it covers most of
+             *  the window); the noise over all lags if there is no estimate */
+            for (i = 0; i < 2; i++)
+            {
+                v = s = 0;
+                for (j = 0; j < n_mean; j++)
+                {
+                    r[j] = 0;
+                    x    = gc[k * lag_stride + j * ch_stride];
+                    if (!valid[j] || !(x > RS_NO_VALUE))
+                        continue;
+                    r[j] = i == 1 ? 1 / rho[j] : local[j] > 0 ? 1 / local[j] : 0;
+                    v   += r[j] * x;
+                    s   += r[j];
+                }
+                if (s > 0)
+                    break;
+            }
+            g[k]      = s > 0 ? v / s : NAN;
+            dg_out[k] = s > 0 ? (dg ? dg[k] : 1) / sqrt(s) : NAN;
+            for (j = 0; s > 0 && j < n_mean; j++)
+                w[j] += r[j] / s;
+        }
+        for (j = 0; j < RS_MAX_CHANNELS; j++)
+            sw += w[j];
+        if (!(sw > 0))
+        {
+            free(d2);
+            return 0;
+        }
+    }
+    free(d2);
+    for (j = 0; j < RS_MAX_CHANNELS; j++)
+    {
+        if (weight)
+            weight[j] = w[j] / sw;
+        used += w[j] > 0;
+    }
+    return used;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  rs_combine
+ *  Description:  replace g, dg of a file read with channels by rs_combine_channels
+ *                of its channels. Returns the number of channels used, 0 if none
+ *                (f unchanged).
+ * =====================================================================================
+ */
+int rs_combine(rs_file *f, int select, double *weight)
+{
+    if (!f->channels || !f->gc || f->n == 0)
+        return 0;
+    return rs_combine_channels(f->gc, f->n, f->n_ch, RS_MAX_CHANNELS, 1, f->dg, select,
+            f->g, f->dg, weight);
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  rh_read_header
+ *  Description:  read the header of the autosave file at path up to the
+ *                "Correlation" line. Angle and temperature are NaN if missing.
+ *                Returns 0 if the file cannot be read.
+ * =====================================================================================
+ */
+int rh_read_header(const char *path, rh_header *h)
+{
+    FILE *fp;
+    char line[RS_LINE_LENGTH], date[RS_DATETIME_LENGTH / 2], time[RS_DATETIME_LENGTH / 2];
+    double t0;
+    long bytes;
+
+    LS_SPAN_BEGIN(t0);
+    h->angle = h->temperature = NAN;
+    date[0] = time[0] = '\0';
+    if ((fp = fopen(path, "r")) == NULL)
+        return 0;
+    while (fgets(line, RS_LINE_LENGTH, fp))
+    {
+        if (strncmp(line, "\"Correlation\"", 13) == 0)
+            break;
+        else if (strncmp(line, "Date", 4) == 0)
+            alv_quoted(line, date, sizeof(date));
+        else if (strncmp(line, "Time", 4) == 0)
+            alv_quoted(line, time, sizeof(time));
+        else if (strncmp(line, "Temperature", 11) == 0)
+            h->temperature = alv_number(line, NAN);
+        else if (strncmp(line, "Angle", 5) == 0)
+            h->angle = alv_number(line, NAN);
+    }
+    bytes = ftell(fp);
+    fclose(fp);
+    ls_count(LS_HEADER, 1, bytes > 0 ? bytes : 0);
+    snprintf(h->datetime, RS_DATETIME_LENGTH, "\"%s\" \"%s\"", date, time);
+    LS_SPAN_END(t0, LS_HEADER, "rh_read_header", path);
+    return 1;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  st_read_file
+ *  Description:  read date, time, temperature, angle, MeanCR0, MeanCR1 and the
+ *                monitor diode intensity ('Monitor Diode	1631576.18', after the
+ *                count rate trace) of the autosave file at path. Missing values are
+ *                NaN. Returns 0 if the file cannot be read.
+ * =====================================================================================
+ */
+int st_read_file(const char *path, st_file *s)
+{
+    FILE *fp;
+    char line[RS_LINE_LENGTH], date[RS_DATETIME_LENGTH / 2], time[RS_DATETIME_LENGTH / 2];
+    double t0;
+    long bytes;
+    int header = 1;
+
+    LS_SPAN_BEGIN(t0);
+    s->cr0 = s->cr1 = s->imon = s->angle = s->temperature = NAN;
+    date[0] = time[0] = '\0';
+    if ((fp = fopen(path, "r")) == NULL)
+        return 0;
+    while (fgets(line, RS_LINE_LENGTH, fp))
+    {
+        if (!header)
+        {
+            if (strncmp(line, "Monitor Diode", 13) == 0)
+            {
+                s->imon = atof(line + 13);
+                break;
+            }
+        }
+        else if (strncmp(line, "\"Correlation\"", 13) == 0)
+            header = 0;
+        else if (strncmp(line, "Date", 4) == 0)
+            alv_quoted(line, date, sizeof(date));
+        else if (strncmp(line, "Time", 4) == 0)
+            alv_quoted(line, time, sizeof(time));
+        else if (strncmp(line, "Temperature", 11) == 0)
+            s->temperature = alv_number(line, NAN);
+        else if (strncmp(line, "Angle", 5) == 0)
+            s->angle = alv_number(line, NAN);
+        else if (strncmp(line, "MeanCR0", 7) == 0)
+            s->cr0 = alv_number(line, NAN);
+        else if (strncmp(line, "MeanCR1", 7) == 0)
+            s->cr1 = alv_number(line, NAN);
+    }
+    bytes = ftell(fp);
+    fclose(fp);
+    ls_count(LS_STATIC, 1, bytes > 0 ? bytes : 0);
+    snprintf(s->datetime, RS_DATETIME_LENGTH, "\"%s\" \"%s\"", date, time);
+    LS_SPAN_END(t0, LS_STATIC, "st_read_file", path);
+    return 1;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  as_reserve
+ *  Description:  grow the scratch buffers of the count rate trace to n samples
+ * =====================================================================================
+ */
+static int as_reserve(as_trace *cr, int n)
+{
+    double *t, *cr0, *cr1;
+    int capacity;
+    if (n <= cr->capacity)
+        return 1;
+    capacity = cr->capacity > 0 ? 2 * cr->capacity : 256;
+    while (capacity < n)
+        capacity *= 2;
+    t   = realloc(cr->t,   capacity * sizeof(double));
+    if (t)
+        cr->t = t;
+    cr0 = realloc(cr->cr0, capacity * sizeof(double));
+    if (cr0)
+        cr->cr0 = cr0;
+    cr1 = realloc(cr->cr1, capacity * sizeof(double));
+    if (cr1)
+        cr->cr1 = cr1;
+    if (!t || !cr0 || !cr1)
+        return 0;
+    cr->capacity = capacity;
+    return 1;
+}
+
+void as_free_trace(as_trace *cr)
+{
+    free(cr->t);
+    free(cr->cr0);
+    free(cr->cr1);
+    cr->t = cr->cr0 = cr->cr1 = NULL;
+    cr->n = cr->capacity = 0;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  as_map
+ *  Description:  contents of the file at path: mapped (read into memory on windows).
+ *                Returns NULL if the file cannot be read; release with as_unmap.
+ * =====================================================================================
+ */
+static char *as_map(const char *path, size_t *size)
+{
+    struct stat st;
+    char *data;
+    int fd;
+
+    if ((fd = open(path, O_RDONLY)) < 0)
+        return NULL;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0)
+    {
+        close(fd);
+        return NULL;
+    }
+    *size = (size_t) st.st_size;
+#ifndef _WIN32
+    data = mmap(NULL, *size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED)
+        data = NULL;
+#else
+    if ((data = malloc(*size)) && read(fd, data, (unsigned) *size) != (int) *size)
+    {
+        free(data);
+        data = NULL;
+    }
+#endif
+    close(fd);
+    return data;
+}
+
+static void as_unmap(char *data, size_t size)
+{
+#ifndef _WIN32
+    munmap(data, size);
+#else
+    free(data);
+#endif
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  as_read_file
+ *  Description:  read everything the DLS and the SLS readers need from the autosave
+ *                file at path in one pass: f as rs_read_file, s as st_read_file and
+ *                the count rate trace (cr may be NULL). The file is mapped and split
+ *                into lines in place, no stdio. Returns the number of lags, 0 on
+ *                error (s is still valid if the file has no correlation).
+ * =====================================================================================
+ */
+int as_read_file(const char *path, rs_file *f, st_file *s, as_trace *cr)
+{
+    char line[RS_LINE_LENGTH], date[RS_DATETIME_LENGTH / 2], time[RS_DATETIME_LENGTH / 2];
+    char *data, *end;
+    const char *p, *eol, *stop;
+    size_t size = 0, length;
+    double t, t0;
+    int k, section = 0;    /* 0 header, 1 correlation, 2 between, 3 standard deviation, 4 count rate */
+
+    LS_SPAN_BEGIN(t0);
+    f->n = f->n_dg = f->n_ch = 0;
+    f->angle = f->temperature = 0;
+    f->mode[0] = '\0';
+    s->cr0 = s->cr1 = s->imon = s->angle = s->temperature = NAN;
+    if (cr)
+        cr->n = 0;
+    date[0] = time[0] = '\0';
+    if (!(data = as_map(path, &size)))
+        return 0;
+    for (p = data, stop = data + size; p < stop; p = eol + 1)
+    {
+        if (!(eol = memchr(p, '\n', stop - p)))
+            eol = stop;
+        length = eol - p < RS_LINE_LENGTH ? (size_t) (eol - p) : RS_LINE_LENGTH - 1;
+        memcpy(line, p, length);
+        line[length] = '\0';
+
+        switch (section)
+        {
+        case 0:
+            if (strncmp(line, "\"Correlation\"", 13) == 0)
+                section = 1;
+            else if (strncmp(line, "Date", 4) == 0)
+                alv_quoted(line, date, sizeof(date));
+            else if (strncmp(line, "Time", 4) == 0)
+                alv_quoted(line, time, sizeof(time));
+            else if (strncmp(line, "Temperature", 11) == 0)
+                s->temperature = alv_number(line, NAN);
+            else if (strncmp(line, "Angle", 5) == 0)
+                s->angle = alv_number(line, NAN);
+            else if (strncmp(line, "MeanCR0", 7) == 0)
+                s->cr0 = alv_number(line, NAN);
+            else if (strncmp(line, "MeanCR1", 7) == 0)
+                s->cr1 = alv_number(line, NAN);
+            else if (strncmp(line, "Mode", 4) == 0)
+                alv_quoted(line, f->mode, sizeof(f->mode));
+            break;
+        case 1:
+        case 4:
+            t = strtod(line, &end);
+            if (end != line)
+            {
+                if (section == 1 && rs_reserve(f, f->n + 1))
+                {
+                    f->t[f->n] = t;
+                    f->g[f->n] = strtod(end, &end);
+                    if (f->channels)
+                        rs_channels(f, f->g[f->n], end);
+                    f->n++;
+                }
+                else if (section == 1)
+                    section = -1;
+                else if (cr && as_reserve(cr, cr->n + 1))
+                {
+                    cr->t[cr->n]   = t;
+                    cr->cr0[cr->n] = strtod(end, &end);
+                    cr->cr1[cr->n] = strtod(end, NULL);
+                    cr->n++;
+                }
+                else if (cr)
+                    section = -1;
+                break;
+            }
+            section = 2;
+            /*  fall through: the line may start the next section */
+        case 2:
+            if (strncmp(line, "\"Count Rate\"", 12) == 0)
+                section = 4;
+            else if (strncmp(line, "Monitor Diode", 13) == 0)
+                s->imon = atof(line + 13);
+            else if (strncmp(line, "\"StandardDeviation\"", 19) == 0)
+                section = 3;
+            break;
+        case 3:
+            strtod(line, &end);
+            if (end == line || f->n_dg >= f->n)
+                break;
+            f->dg[f->n_dg++] = strtod(end, NULL);
+            break;
+        }
+        if (section < 0)
+            break;
+    }
+    as_unmap(data, size);
+    ls_count(LS_PARSE, 1, (long long) size);
+    if (section < 0)
+    {
+        f->n = 0;
+        return 0;
+    }
+    /*  as rs_read_file: missing angle / temperature 0, missing standard deviation 1 */
+    f->angle       = isnan(s->angle) ? 0 : s->angle;
+    f->temperature = isnan(s->temperature) ? 0 : s->temperature;
+    for (k = f->n_dg; k < f->n; k++)
+        f->dg[k] = f->n_dg > 0 ? f->dg[f->n_dg - 1] : 1;
+    snprintf(f->datetime, RS_DATETIME_LENGTH, "\"%s\" \"%s\"", date, time);
+    memcpy(s->datetime, f->datetime, RS_DATETIME_LENGTH);
+    LS_SPAN_END(t0, LS_PARSE, "as_read_file", path);
+    return f->n;
+}
@@ -0,0 +1,105 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  alv_autosave.h
+ *
+ *    Description:  readers of the ALV autosave files (.ASC), see alv_autosave.c.
+ *                  Part of libls, used by the MEX files of +Instruments/@ALVBASE.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#ifndef ALV_AUTOSAVE_H
+#define ALV_AUTOSAVE_H
+
+#define RS_LINE_LENGTH     1024
+#define RS_DATETIME_LENGTH 128
+
+/*  limits of correct_G [ms]: normalization window, crop window */
+#define RS_NORM_MIN 1e-5
+#define RS_NORM_MAX 1e-4
+#define RS_CROP_MIN 1e-3
+#define RS_CROP_MAX 1e2
+
+/*  channels of the correlation: columns after the lag ("C-CH0/1+1/0": the two
+ *  pseudo cross correlations, then the auto correlations). The lags a channel does
+ *  not cover are written as -1 with some rounding noise (-0.99974): values at or
+ *  below RS_NO_VALUE have no value */
+#define RS_MAX_CHANNELS 4
+#define RS_MODE_LENGTH  64
+#define RS_NO_VALUE     (-0.99)
+
+/*  channel selection of rs_combine: a channel (1 ... RS_MAX_CHANNELS) or */
+#define RS_CH_WEIGHTED  (-1)    /* inverse-variance mean of the first two channels */
+#define RS_CH_BEST      (-2)    /* the active channel of the lowest noise */
+#define RS_CH_ALL       (-3)    /* inverse-variance mean of all active channels */
+
+/*  weights of the means, for every RS_NOISE_STEP lags: noise of the RS_NOISE_WINDOW
+ *  lags around them, if at least RS_NOISE_MIN of them have a value */
+#define RS_NOISE_STEP   8
+#define RS_NOISE_WINDOW 32
+#define RS_NOISE_MIN    24
+
+/*  correlation function of one file */
+typedef struct
+{
+    double *t, *g, *dg;         /* raw data (scratch, reused for every file) */
+    double *gc;                 /* all channels, gc[k * RS_MAX_CHANNELS + j] (channels only) */
+    int     n, n_dg, capacity;
+    int     channels;           /* set by the caller: read all channels into gc */
+    int     n_ch;               /* channels found (columns after the lag) */
+    double  angle;
+    double  temperature;
+    char    datetime[RS_DATETIME_LENGTH];   /* "date" "time", as read_dynamic_file */
+    char    mode[RS_MODE_LENGTH];           /* correlator mode, e.g. C-CH0/1+1/0 */
+} rs_file;
+
+typedef struct
+{
+    int n0, n1;                 /* normalization window [n0, n1) */
+    int c0, c1;                 /* crop window [c0, c1) */
+} rs_window;
+
+/*  header only (lazy loading) */
+typedef struct
+{
+    double angle;
+    double temperature;
+    char   datetime[RS_DATETIME_LENGTH];
+} rh_header;
+
+/*  static data of one file (read_static_from_autosave) */
+typedef struct
+{
+    double cr0, cr1;            /* [kHz] mean count rates of the two detectors */
+    double imon;                /* monitor diode intensity */
+    double angle;
+    double temperature;
+    char   datetime[RS_DATETIME_LENGTH];
+} st_file;
+
+/*  count rate trace of one file ("Count Rate": time [s], CR0, CR1 [kHz]) */
+typedef struct
+{
+    double *t, *cr0, *cr1;      /* scratch, reused for every file */
+    int     n, capacity;
+} as_trace;
+
+int    rs_read_file(const char *path, rs_file *f);
+void   rs_free(rs_file *f);
+int    rs_windows(const double *t, int n, const double *limits, rs_window *w);
+double rs_normalize(const rs_file *f, const rs_window *w, double *g, double *dg);
+int    rs_combine_channels(const double *gc, int n, int n_ch, int lag_stride, int ch_stride,
+        const double *dg, int select, double *g, double *dg_out, double *weight);
+int    rs_combine(rs_file *f, int select, double *weight);
+int    rh_read_header(const char *path, rh_header *h);
+int    st_read_file(const char *path, st_file *s);
+int    as_read_file(const char *path, rs_file *f, st_file *s, as_trace *cr);
+void   as_free_trace(as_trace *cr);
+
+#endif
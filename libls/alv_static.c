@@ -0,0 +1,320 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  alv_static.c
+ *
+ *    Description:  the reference and status files of the ALV software (see alv_static.h)
+ *
+ *                  .tol : standard / solvent files: two text lines (date, name), the
+ *                         refraction index, then one row of 12 tab separated numbers
+ *                         per angle. tol_cached keeps the parsed files in a cache of
+ *                         the library, keyed by path, modification time (with
+ *                         nanoseconds where the file system has them) and size, so the
+ *                         same reference files used by many samples are parsed once.
+ *
+ *                  .sta : binary status file written by the ALV software for every
+ *                         static series: fixed records of 198 bytes, record 0 is a
+ *                         header (record counts), then one record per angle:
+ *
+ *                    0 -  39  sample name        (string)
+ *                   40 -  64  solvent name       (string)
+ *                   65 -  89  standard name      (string)
+ *                   90        refraction index of the standard   (float32, little endian)
+ *                   94        refraction index of the solvent
+ *                  102        Rayleigh ratio of the standard [1/cm]
+ *                  106        dn/dc [ml/g]
+ *                  110        wavelength [nm]
+ *                  114        viscosity [cP]
+ *                  118        concentration [g/ml]
+ *                  122        temperature [K]
+ *                  126        scattering angle [deg]
+ *                  134 - 181  up to 6 pairs (value, error) of the single counts
+ *                  182        Kc/R
+ *                  186        error of Kc/R
+ *
+ *                  The file has no count rates or monitor intensities: these are only
+ *                  in the autosave .ASC files.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <sys/stat.h>
+
+#include "ls.h"
+
+#define TOL_HEADER_LINES 3
+#define TOL_LINE_LENGTH  1024
+
+/*  nanoseconds of the modification time: a file rewritten within a second is parsed again */
+#if defined(__APPLE__)
+#define TOL_MTIME_NS(st) ((long) (st).st_mtimespec.tv_nsec)
+#elif defined(_WIN32)
+#define TOL_MTIME_NS(st) 0L
+#else
+#define TOL_MTIME_NS(st) ((long) (st).st_mtim.tv_nsec)
+#endif
+
+/*  offsets in a record of a .sta file */
+#define STA_SAMPLE       0
+#define STA_SOLVENT      40
+#define STA_STANDARD     65
+#define STA_STRING_END   90
+#define STA_COUNTS       134
+#define STA_KCR          182
+#define STA_DKCR         186
+
+typedef struct
+{
+    char    *path;
+    time_t   mtime;
+    long     mtime_ns;
+    off_t    size;
+    tol_file tol;
+} tol_entry;
+
+static tol_entry tol_cache[TOL_CACHE_SIZE];
+static int       tol_cache_next = 0;    /* entry replaced next when the cache is full */
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  tol_read
+ *  Description:  parse the .tol file at path. Missing columns are NaN.
+ *                Returns 0 if the file cannot be read or has no data.
+ * =====================================================================================
+ */
+int tol_read(const char *path, tol_file *tol)
+{
+    FILE *fp = fopen(path, "r");
+    char line[TOL_LINE_LENGTH], *p, *end;
+    double row[TOL_COLUMNS], *data = NULL, *tmp;
+    int n_line = 0, rows = 0, capacity = 0, i, j;
+
+    tol->rows = 0;
+    tol->refraction_index = NAN;
+    tol->data = NULL;
+    if (!fp)
+        return 0;
+    while (fgets(line, sizeof(line), fp))
+    {
+        n_line++;
+        if (n_line == TOL_HEADER_LINES)
+            tol->refraction_index = strtod(line, NULL);
+        if (n_line <= TOL_HEADER_LINES)
+            continue;
+        p = line;
+        for (j = 0; j < TOL_COLUMNS; j++)
+        {
+            row[j] = strtod(p, &end);
+            if (end == p)
+                break;
+            p = end;
+        }
+        if (j == 0)
+            continue;           /* empty or text line */
+        for (; j < TOL_COLUMNS; j++)
+            row[j] = NAN;
+        if (rows == capacity)
+        {
+            capacity = capacity > 0 ? 2 * capacity : 32;
+            tmp = realloc(data, capacity * TOL_COLUMNS * sizeof(double));
+            if (!tmp)
+            {
+                free(data);
+                fclose(fp);
+                return 0;
+            }
+            data = tmp;
+        }
+        memcpy(data + rows * TOL_COLUMNS, row, sizeof(row));
+        rows++;
+    }
+    fclose(fp);
+    if (rows == 0)
+    {
+        free(data);
+        return 0;
+    }
+    /*  row major -> column major */
+    tol->data = malloc(rows * TOL_COLUMNS * sizeof(double));
+    if (!tol->data)
+    {
+        free(data);
+        return 0;
+    }
+    for (i = 0; i < rows; i++)
+        for (j = 0; j < TOL_COLUMNS; j++)
+            tol->data[j * rows + i] = data[i * TOL_COLUMNS + j];
+    free(data);
+    tol->rows = rows;
+    return 1;
+}
+
+static void tol_clear_entry(tol_entry *e)
+{
+    free(e->path);
+    free(e->tol.data);
+    memset(e, 0, sizeof(tol_entry));
+}
+
+/*  empty the cache of the .tol files (ls_release) */
+void tol_clear_cache(void)
+{
+    int i;
+    for (i = 0; i < TOL_CACHE_SIZE; i++)
+        tol_clear_entry(&tol_cache[i]);
+    tol_cache_next = 0;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  tol_cached
+ *  Description:  the .tol file at path, parsed and cached, or from the cache if not
+ *                changed on disk since (path, modification time, size): the same
+ *                reference files are used by many samples. The cache is owned by the
+ *                library (TOL_CACHE_SIZE files, the oldest is replaced). Returns NULL
+ *                if the file cannot be read.
+ * =====================================================================================
+ */
+const tol_file *tol_cached(const char *path)
+{
+    struct stat st;
+    tol_entry *e = NULL;
+    double t0;
+    int i;
+
+    LS_SPAN_BEGIN(t0);
+    if (stat(path, &st) != 0)
+        return NULL;
+    for (i = 0; i < TOL_CACHE_SIZE; i++)
+        if (tol_cache[i].path && strcmp(tol_cache[i].path, path) == 0)
+        {
+            if (tol_cache[i].mtime == st.st_mtime && tol_cache[i].mtime_ns == TOL_MTIME_NS(st)
+                    && tol_cache[i].size == st.st_size)
+            {
+                ls_count(LS_STATIC, tol_cache[i].tol.rows, 0);
+                return &tol_cache[i].tol;
+            }
+            e = &tol_cache[i];      /* changed on disk: parse again */
+            break;
+        }
+    if (!e)
+    {
+        for (i = 0; i < TOL_CACHE_SIZE && tol_cache[i].path; i++);
+        if (i == TOL_CACHE_SIZE)
+        {
+            i = tol_cache_next;
+            tol_cache_next = (tol_cache_next + 1) % TOL_CACHE_SIZE;
+        }
+        e = &tol_cache[i];
+    }
+    tol_clear_entry(e);
+    if (!tol_read(path, &e->tol))
+        return NULL;
+    e->path = malloc(strlen(path) + 1);
+    if (!e->path)
+    {
+        tol_clear_entry(e);
+        return NULL;
+    }
+    strcpy(e->path, path);
+    e->mtime    = st.st_mtime;
+    e->mtime_ns = TOL_MTIME_NS(st);
+    e->size     = st.st_size;
+    ls_count(LS_STATIC, e->tol.rows, (long long) st.st_size);
+    LS_SPAN_END(t0, LS_STATIC, "tol_read", path);
+    return &e->tol;
+}
+
+/*  little endian float32 at p, independent of the byte order of the host */
+static double sta_float(const unsigned char *p)
+{
+    unsigned int u = (unsigned int) p[0] | (unsigned int) p[1] << 8
+        | (unsigned int) p[2] << 16 | (unsigned int) p[3] << 24;
+    float f;
+    memcpy(&f, &u, sizeof(f));
+    return f;
+}
+
+/*  zero terminated string of at most end - start bytes */
+static void sta_string(const unsigned char *p, int start, int end, char *s)
+{
+    int n = end - start < STA_NAME_LENGTH - 1 ? end - start : STA_NAME_LENGTH - 1;
+    memcpy(s, p + start, n);
+    s[n] = '\0';
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  sta_read
+ *  Description:  decode all angle records of the .sta file at path into *records
+ *                (malloc, free by the caller). Returns the number of records, -1 if
+ *                the file cannot be read or is not a sequence of 198 byte records.
+ * =====================================================================================
+ */
+int sta_read(const char *path, sta_record **records)
+{
+    FILE *fp = fopen(path, "rb");
+    unsigned char rec[STA_RECORD];
+    sta_record *r;
+    long size;
+    double t0;
+    int n, i, j;
+
+    LS_SPAN_BEGIN(t0);
+    *records = NULL;
+    if (!fp)
+        return -1;
+    fseek(fp, 0, SEEK_END);
+    size = ftell(fp);
+    if (size < STA_RECORD || size % STA_RECORD != 0 || fseek(fp, STA_RECORD, SEEK_SET) != 0)
+    {
+        fclose(fp);
+        return -1;
+    }
+    n = (int) (size / STA_RECORD) - 1;
+    *records = r = calloc(n > 0 ? n : 1, sizeof(sta_record));
+    if (!r)
+    {
+        fclose(fp);
+        return -1;
+    }
+    for (i = 0; i < n; i++, r++)
+    {
+        if (fread(rec, 1, STA_RECORD, fp) != STA_RECORD)
+        {
+            free(*records);
+            *records = NULL;
+            fclose(fp);
+            return -1;
+        }
+        sta_string(rec, STA_SAMPLE, STA_SOLVENT, r->sample);
+        sta_string(rec, STA_SOLVENT, STA_STANDARD, r->solvent);
+        sta_string(rec, STA_STANDARD, STA_STRING_END, r->standard);
+        r->n_standard     = sta_float(rec + 90);
+        r->n_solvent      = sta_float(rec + 94);
+        r->rayleigh_ratio = sta_float(rec + 102);
+        r->dndc           = sta_float(rec + 106);
+        r->wavelength     = sta_float(rec + 110);
+        r->viscosity      = sta_float(rec + 114);
+        r->conc           = sta_float(rec + 118);
+        r->T              = sta_float(rec + 122);
+        r->angle          = sta_float(rec + 126);
+        for (j = 0; j < 2 * STA_MAX_COUNTS; j++)
+            r->count[j]   = sta_float(rec + STA_COUNTS + 4 * j);
+        r->KcR            = sta_float(rec + STA_KCR);
+        r->dKcR           = sta_float(rec + STA_DKCR);
+    }
+    fclose(fp);
+    ls_count(LS_STATIC, n, (long long) (n + 1) * STA_RECORD);
+    LS_SPAN_END(t0, LS_STATIC, "sta_read", path);
+    return n;
+}
@@ -0,0 +1,49 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  alv_static.h
+ *
+ *    Description:  the reference and status files of the ALV software next to the autosave
+ *                  files, see alv_static.c: .tol files of the standard / solvent (tol_)
+ *                  and the binary .sta files of the static series (sta_). Part of libls,
+ *                  used by read_tol_file_fast and read_sta_file_fast of +Instruments/@ALVBASE.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#ifndef ALV_STATIC_H
+#define ALV_STATIC_H
+
+#define TOL_COLUMNS      12
+#define TOL_CACHE_SIZE   32
+
+#define STA_RECORD       198
+#define STA_NAME_LENGTH  41
+#define STA_MAX_COUNTS   6
+
+typedef struct
+{
+    int     rows;
+    double  refraction_index;
+    double *data;               /* rows x TOL_COLUMNS, column major (as matlab) */
+} tol_file;
+
+typedef struct
+{
+    char   sample[STA_NAME_LENGTH], solvent[STA_NAME_LENGTH], standard[STA_NAME_LENGTH];
+    double angle, T, KcR, dKcR;
+    double conc, dndc, wavelength, viscosity, n_solvent, n_standard, rayleigh_ratio;
+    double count[2 * STA_MAX_COUNTS];   /* value, error of every count (0 if absent) */
+} sta_record;
+
+int  tol_read(const char *path, tol_file *tol);
+const tol_file *tol_cached(const char *path);
+void tol_clear_cache(void);
+int  sta_read(const char *path, sta_record **records);
+
+#endif
@@ -0,0 +1,112 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  attenuator.c
+ *
+ *    Description:  the attenuator in the beam is not recorded by the ALV software:
+ *                  it is recognized from the monitor intensity, which scales with the
+ *                  transmission. The table of an instrument (Instruments.ALVTUE.Attenuator)
+ *                  holds the nominal monitor intensity of every attenuator, sorted
+ *                  ascending; a point takes the attenuator of the nearest intensity on
+ *                  a log scale (the ratio closest to 1), found by bisection, and its
+ *                  Kc/R is multiplied by the intensity correction of that attenuator.
+ *                  The match is accepted only if the ratio is within the tolerance
+ *                  (monitor / tol <= Imon <= monitor * tol): a point between two
+ *                  attenuators, or far above or below the table (other laser power),
+ *                  is not classified.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "ls.h"
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  at_classify
+ *  Description:  index (0-based) of the attenuator of every monitor intensity, -1 if
+ *                imon is not a positive number or not within the factor tol (> 1) of
+ *                the nearest attenuator. monitor: n_att nominal intensities, positive
+ *                and sorted ascending. Returns the number of points classified, -1 if
+ *                the table is not sorted or tol <= 1.
+ * =====================================================================================
+ */
+int at_classify(const double *monitor, int n_att, double tol, const double *imon, int n,
+        int *index)
+{
+    int i, k, lo, hi, mid, m = 0;
+
+    if (!(tol > 1))
+        return -1;
+    for (i = 0; i < n_att; i++)
+        if (!(monitor[i] > 0) || (i > 0 && !(monitor[i] > monitor[i - 1])))
+            return -1;
+    for (k = 0; k < n; k++)
+    {
+        index[k] = -1;
+        if (n_att == 0 || !(imon[k] > 0) || !isfinite(imon[k]))
+            continue;
+        /*  first attenuator with monitor >= imon */
+        lo = 0;
+        hi = n_att;
+        while (lo < hi)
+        {
+            mid = (lo + hi) / 2;
+            if (monitor[mid] < imon[k])
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        if (lo == n_att)
+            lo = n_att - 1;
+        else if (lo > 0 && imon[k] * imon[k] < monitor[lo - 1] * monitor[lo])
+            lo--;   /* below the geometric mean of the two neighbours */
+        if (imon[k] > monitor[lo] * tol || imon[k] * tol < monitor[lo])
+            continue;
+        index[k] = lo;
+        m++;
+    }
+    return m;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  at_correct
+ *  Description:  Kc/R and its error times the correction of the attenuator of every
+ *                point (NaN if not classified); index as at_classify (may be NULL).
+ *                dkcr may be NULL. Returns the number of points corrected, -1 if the
+ *                table is not sorted or tol <= 1.
+ * =====================================================================================
+ */
+int at_correct(const double *monitor, const double *factor, int n_att, double tol,
+        const double *imon, const double *kcr, const double *dkcr, int n, double *kcr_corr,
+        double *dkcr_corr, int *index)
+{
+    int k, m, *att = index ? index : malloc((n > 0 ? n : 1) * sizeof(int));
+    double t0;
+
+    if (!att)
+        return -1;
+    LS_SPAN_BEGIN(t0);
+    ls_count(LS_ATTENUATOR, n, 0);
+    m = at_classify(monitor, n_att, tol, imon, n, att);
+    for (k = 0; k < n; k++)
+    {
+        kcr_corr[k]  = m >= 0 && att[k] >= 0 ? kcr[k] * factor[att[k]] : NAN;
+        if (dkcr_corr)
+            dkcr_corr[k] = m >= 0 && att[k] >= 0 && dkcr ? dkcr[k] * factor[att[k]] : NAN;
+    }
+    if (!index)
+        free(att);
+    LS_SPAN_END(t0, LS_ATTENUATOR, "at_correct", NULL);
+    return m;
+}
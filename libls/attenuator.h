@@ -0,0 +1,31 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  attenuator.h
+ *
+ *    Description:  attenuator of every static point from its monitor intensity and
+ *                  the intensity correction of Kc/R, see attenuator.c. Part of libls,
+ *                  used by ../+Instruments/attenuator_fast.c.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#ifndef ATTENUATOR_H
+#define ATTENUATOR_H
+
+/*  default tolerance: a point matches an attenuator if its monitor intensity is within
+ *  this factor of the nominal one (neighbouring attenuators are at least 2.6 apart) */
+#define AT_TOLERANCE 1.5
+
+int at_classify(const double *monitor, int n_att, double tol, const double *imon, int n,
+        int *index);
+int at_correct(const double *monitor, const double *factor, int n_att, double tol,
+        const double *imon, const double *kcr, const double *dkcr, int n, double *kcr_corr,
+        double *dkcr_corr, int *index);
+
+#endif
@@ -0,0 +1,218 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  bootstrap.c
+ *
+ *    Description:  bootstrap and jackknife errors of the discrete fits (gf_fit, a single
+ *                  point is the special case n_points = 1).
+ *                  bootstrap : residual resampling; the standardized residuals
+ *                              sqrt(w) (g - f) of every correlogram are drawn with
+ *                              replacement and added to the fitted curve.
+ *                  jackknife : delete-a-group jackknife, replicate b drops the b-th
+ *                              of n_rep contiguous blocks of every correlogram.
+ *                  Every replicate is refitted from the estimate. The replicates run
+ *                  in parallel (OpenMP); replicate b draws from its own random stream
+ *                  ls_rng_seed(seed, b) (ls.c), so the result depends on the seed
+ *                  only, not on the number of threads. A replicate whose fit did not
+ *                  converge (stalled or out of iterations) is NaN.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "ls.h"
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  bs_replicate
+ *  Description:  data (g_b) and weights (w_b) of replicate b
+ *                f : fitted curve, e : standardized residuals sqrt(w) (g - f)
+ * =====================================================================================
+ */
+static void bs_replicate(const gf_problem *p, const double *f, const double *e, int mode,
+        int b, int n_rep, ls_rng *rng, double *g_b, double *w_b)
+{
+    int i, k, m, s;
+
+    for (i = 0; i < p->n_points; i++)
+    {
+        s = p->offset[i];
+        m = p->offset[i + 1] - s;
+        for (k = s; k < s + m; k++)
+        {
+            w_b[k] = p->w[k];
+            if (mode == BS_JACKKNIFE)
+            {
+                g_b[k] = p->g[k];
+                if ((long) (k - s) * n_rep / m == b)
+                    w_b[k] = 0;
+            }
+            else if (p->w[k] > 0)
+                g_b[k] = f[k] + e[s + ls_rng_int(rng, m)] / sqrt(p->w[k]);
+            else
+                g_b[k] = p->g[k];
+        }
+    }
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  bs_resample
+ *  Description:  refit n_rep bootstrap / jackknife replicates of the problem p around
+ *                the estimate (x_local, x_global). rep ((N L + G) x n_rep) receives
+ *                the local parameters of all points followed by the global ones,
+ *                NaN for replicates which did not converge. Returns 0 if out of memory.
+ * =====================================================================================
+ */
+int bs_resample(const gf_problem *p, const double *x_local, const double *x_global,
+        int mode, int n_rep, unsigned long long seed, int max_iter, double tol,
+        int n_threads, double *rep, bs_info *info)
+{
+    int L = p->n_local, G = p->n_global, N = p->n_points;
+    int n_par = N * L + G, n_failed = 0, n_data, i, k, b;
+    double *f, *e, t0, span;
+
+    LS_SPAN_BEGIN(span);
+    t0 = ls_now();
+    ls_count(LS_BOOTSTRAP, n_rep, 0);
+    info->n_rep     = n_rep;
+    info->n_failed  = 0;
+    info->n_threads = 1;
+    n_data = p->offset[N];
+    f = malloc(n_data * sizeof(double));
+    e = malloc(n_data * sizeof(double));
+    if (!f || !e)
+    {
+        free(f); free(e);
+        return 0;
+    }
+    for (i = 0; i < N; i++)
+        for (k = p->offset[i]; k < p->offset[i + 1]; k++)
+        {
+            f[k] = gf_eval(p->model, p->t[k], p->q2[i], x_local + i * L, x_global, NULL, NULL);
+            e[k] = p->w[k] > 0 ? sqrt(p->w[k]) * (p->g[k] - f[k]) : 0;
+        }
+#ifdef _OPENMP
+    if (n_threads <= 0)
+        n_threads = omp_get_max_threads();
+    info->n_threads = n_threads;
+#pragma omp parallel for schedule(dynamic) num_threads(n_threads) reduction(+:n_failed)
+#endif
+    for (b = 0; b < n_rep; b++)
+    {
+        gf_problem pb = *p;
+        gf_info    fi;
+        ls_rng     rng;
+        double    *col = rep + (size_t) b * n_par;
+        double    *g_b, *w_b, *dx;
+        int        a;
+
+        g_b = malloc(n_data * sizeof(double));
+        w_b = malloc(n_data * sizeof(double));
+        dx  = malloc(n_par * sizeof(double));
+        memcpy(col, x_local, N * L * sizeof(double));
+        memcpy(col + N * L, x_global, G * sizeof(double));
+        if (g_b && w_b && dx)
+        {
+            ls_rng_seed(&rng, seed, (unsigned long long) b);
+            bs_replicate(p, f, e, mode, b, n_rep, &rng, g_b, w_b);
+            pb.g = g_b;
+            pb.w = w_b;
+            gf_fit(&pb, col, col + N * L, dx, dx + N * L, max_iter, tol, &fi);
+        }
+        else
+            fi.converged = 0;
+        if (!fi.converged)           /*  stalled or out of iterations */
+        {
+            for (a = 0; a < n_par; a++)
+                col[a] = NAN;
+            n_failed++;
+        }
+        free(g_b); free(w_b); free(dx);
+    }
+    info->n_failed = n_failed;
+    info->time_resample = ls_now() - t0;
+
+    free(f); free(e);
+    LS_SPAN_END(span, LS_BOOTSTRAP, mode == BS_JACKKNIFE ? "bs_jackknife" : "bs_bootstrap", NULL);
+    return 1;
+}
+
+static int bs_compare(const void *a, const void *b)
+{
+    double x = *(const double *) a, y = *(const double *) b;
+    return x < y ? -1 : (x > y);
+}
+
+/* percentile (linear interpolation) of the sorted values x (n > 0) */
+static double bs_percentile(const double *x, int n, double q)
+{
+    double h = q * (n - 1);
+    int    i = (int) floor(h);
+    if (i >= n - 1)
+        return x[n - 1];
+    return x[i] + (h - i) * (x[i + 1] - x[i]);
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  bs_summary
+ *  Description:  95% intervals [lo hi] and standard errors of every parameter from the
+ *                replicates (NaN columns are ignored).
+ *                bootstrap : percentile interval, standard deviation of the replicates
+ *                jackknife : est -+ 1.96 se, se^2 = (n - 1) / n sum (x_b - mean)^2
+ * =====================================================================================
+ */
+void bs_summary(const double *rep, int n_par, int n_rep, int mode, const double *est,
+        double *lo, double *hi, double *se)
+{
+    double *x = malloc((n_rep > 0 ? n_rep : 1) * sizeof(double));
+    double mean, ss;
+    int a, b, n;
+
+    for (a = 0; a < n_par; a++)
+    {
+        n = 0;
+        for (b = 0; b < n_rep && x; b++)
+            if (!isnan(rep[(size_t) b * n_par + a]))
+                x[n++] = rep[(size_t) b * n_par + a];
+        if (n < 2)
+        {
+            lo[a] = hi[a] = se[a] = NAN;
+            continue;
+        }
+        mean = 0;
+        for (b = 0; b < n; b++)
+            mean += x[b];
+        mean /= n;
+        ss = 0;
+        for (b = 0; b < n; b++)
+            ss += (x[b] - mean) * (x[b] - mean);
+        if (mode == BS_JACKKNIFE)
+        {
+            se[a] = sqrt((n - 1.0) / n * ss);
+            lo[a] = est[a] - GF_CONF_95 * se[a];
+            hi[a] = est[a] + GF_CONF_95 * se[a];
+        }
+        else
+        {
+            se[a] = sqrt(ss / (n - 1));
+            qsort(x, n, sizeof(double), bs_compare);
+            lo[a] = bs_percentile(x, n, 0.025);
+            hi[a] = bs_percentile(x, n, 0.975);
+        }
+    }
+    free(x);
+}
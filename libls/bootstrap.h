@@ -0,0 +1,43 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  bootstrap.h
+ *
+ *    Description:  bootstrap and jackknife errors of the discrete fits of global_fit.h,
+ *                  see bootstrap.c. Part of libls, used by ../+DLS/bootstrap_fast.c.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#ifndef BOOTSTRAP_H
+#define BOOTSTRAP_H
+
+#include "global_fit.h"
+
+enum bs_mode
+{
+    BS_BOOTSTRAP = 0,
+    BS_JACKKNIFE = 1
+};
+
+typedef struct
+{
+    int    n_rep;
+    int    n_failed;            /* replicates whose fit did not converge (NaN) */
+    int    n_threads;
+    double time_fit;            /* [s] (set by the caller) */
+    double time_resample;       /* [s] */
+} bs_info;
+
+int  bs_resample(const gf_problem *p, const double *x_local, const double *x_global,
+        int mode, int n_rep, unsigned long long seed, int max_iter, double tol,
+        int n_threads, double *rep, bs_info *info);
+void bs_summary(const double *rep, int n_par, int n_rep, int mode, const double *est,
+        double *lo, double *hi, double *se);
+
+#endif
@@ -0,0 +1,795 @@
+/*
+------------------------------------------------------------------------------
+
+ libls: CONTIN engine of Contin/contin.c (see there for the algorithm),
+ shared by the MEX file contin and the command line tools. Built as the
+ library libls_contin with make contin (needs gsl and ool).
+
+------------------------------------------------------------------------------
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <ool/ool_conmin.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_sort.h>
+#include <gsl/gsl_statistics_double.h>
+
+#include "ls.h"
+#include "contin.h"
+
+#ifdef _OPENMP
+	#include <omp.h>
+#endif
+        
+/*
+------------------------------------------------------------------------------
+
+ square function 
+
+------------------------------------------------------------------------------
+*/
+
+static inline
+double sqr(double x)
+{
+	return x * x;
+}
+
+/*
+------------------------------------------------------------------------------
+
+ generates a multi-exponential (t, y) with
+ 
+ y(t) = sum(I(n)*exp(-t/tau(n)), {n,0, N})
+
+------------------------------------------------------------------------------
+*/
+
+void example(gsl_vector* intensity, 
+			 gsl_vector* tau,
+			 gsl_vector* t,
+			 gsl_vector* y,
+			 gsl_vector* var,
+			 int n, 
+			 double t0,
+			 double tend)
+{
+	double dt = (tend - t0) / (n - 1);
+	int i, k;
+	double yi, ti;
+	for (i = 0;  i < n; i++)
+	{
+		ti = t0 + dt * i;
+		
+		yi = 0;
+		for (k = 0; k < tau->size; k++)
+			yi += gsl_vector_get(intensity, k) * exp(- ti / gsl_vector_get(tau, k));
+			
+		gsl_vector_set(t, i, ti);
+		gsl_vector_set(y, i, yi);
+		gsl_vector_set(var, i, 1);
+	}
+}
+
+/*
+------------------------------------------------------------------------------
+
+ parameter struct for optimazation routine 
+
+------------------------------------------------------------------------------
+*/
+
+
+
+/*
+------------------------------------------------------------------------------
+
+ allocate memory for parameter-struct entries and intialize 
+ kernel K, tau, ... etc
+
+------------------------------------------------------------------------------
+*/
+
+parameter* parameter_alloc(gsl_vector* t, 
+						    gsl_vector* y,
+						    gsl_vector* var,
+						    double alpha,
+						    double tau0,
+						    double tau1,
+						    int m,
+							int kernelType)
+{
+	parameter* p = malloc(sizeof(parameter));
+	int n = t->size;
+	
+	p -> K   = gsl_matrix_alloc( n, m );
+	p -> w   = gsl_vector_alloc( n );
+	p -> c   = gsl_vector_alloc( m );
+	p -> y   = gsl_vector_alloc( n );
+	p -> tau = gsl_vector_alloc( m );
+	p -> t = gsl_vector_alloc( n );
+	
+	p -> alpha = alpha;
+	p -> verbose = 1;
+	
+	double dtau = (tau1 - tau0) / (m - 1);
+	int i, j;
+	
+	gsl_vector_memcpy(p->y, y);
+	gsl_vector_memcpy(p->t, t);
+	
+	for (j = 0; j < m; j++)
+		gsl_vector_set(p->tau, j, tau0 + j * dtau);
+	
+	for (i = 0; i < n; i++)
+	{
+		for (j = 0; j < m; j++)
+		{
+			if (kernelType == 0)
+			{
+				// multi-exponential
+				gsl_matrix_set(p->K, i, j, exp(-gsl_vector_get(p->t,i) / gsl_vector_get(p->tau, j)));
+			}
+			else if (kernelType == 1)
+			{
+				// multi-lorentzian
+				gsl_matrix_set(p->K, i, j, M_1_PI *  gsl_vector_get(p->tau, j) / (sqr(gsl_vector_get(p->t, i)) + sqr(gsl_vector_get(p->tau, j))));
+				
+			}
+		}
+		gsl_vector_set(p->w, i, 1.0 / gsl_vector_get(var, i));
+	}		
+	
+	/* 
+	 weights for quadrature of integral, trapezoidal rule 
+	*/
+	for (j = 0; j < m; j++)
+	{
+		if(j == 0 || j == m - 1)
+			gsl_vector_set(p->c, j, 0.5 * dtau);
+		else
+			gsl_vector_set(p->c, j, dtau);
+	}
+	return p;
+}
+
+/*
+------------------------------------------------------------------------------
+
+ release allocated memory for parameter struct
+
+------------------------------------------------------------------------------
+*/
+
+void parameter_free(parameter* p)
+{
+	if ( p->K ) gsl_matrix_free( p->K );
+	if ( p->w ) gsl_vector_free( p->w );
+	if ( p->c ) gsl_vector_free( p->c );
+	if ( p->y ) gsl_vector_free( p->y );
+	if ( p->t ) gsl_vector_free( p->t );
+	if ( p->tau ) gsl_vector_free( p->tau );
+	free(p);
+}
+
+/*
+------------------------------------------------------------------------------
+
+ discrete 2nd derivative of g
+
+------------------------------------------------------------------------------
+*/
+ 
+void diff2(const gsl_vector *x, gsl_vector * ddg)
+{
+	int i;
+	for (i = 1; i < ddg->size - 1; i++)
+		gsl_vector_set(ddg, i, gsl_vector_get(x, i - 1) - 2 * gsl_vector_get(x, i) + gsl_vector_get(x, i + 1));
+		
+	gsl_vector_set(ddg, 0, - 2 * gsl_vector_get(x, 0) + gsl_vector_get(x, 1));
+	gsl_vector_set(ddg,  ddg->size - 1, gsl_vector_get(x, ddg->size - 2) - 2 * gsl_vector_get(x, ddg->size - 1));
+}
+
+/*
+------------------------------------------------------------------------------
+ z = A*g + b 
+ f(g, b) = |y - z|^2 + a^2*|D2g|^2
+ x = (g, b)
+------------------------------------------------------------------------------
+*/
+
+double fun(const gsl_vector* x, void* params)
+{
+	parameter* p = (parameter*) params;
+	
+	int n = p->y->size;
+	int m = x->size - 1;
+		
+	gsl_vector* d2g = gsl_vector_alloc(m);
+	
+	/* x= (g,b), diff2 acts only on the g-part of x*/
+	diff2(x, d2g);
+	
+	/*
+	 integral operation, A is the kernel discretization
+	 and c are the weights of the quadrature formula
+	*/
+	
+	int i, j;
+	double var = 0;
+	double reg = 0;
+	double z;
+	double b = gsl_vector_get(x, m);
+	
+	for (i = 0; i < n; i++)
+	{
+		z = b;
+		for (j = 0; j < m ; j++)
+			z += gsl_vector_get(p->c, j) * gsl_matrix_get(p->K, i, j) * gsl_vector_get(x, j);
+		var += gsl_vector_get(p->w, i) * sqr(gsl_vector_get(p->y, i) - z );
+	}
+	
+	/* regularizer, second derivative of g*/
+	for (i = 0; i < m; i++)
+		reg += sqr(gsl_vector_get(d2g, i));
+	
+	/* 
+	 free memory
+	*/
+	gsl_vector_free( d2g  );
+	
+	return var + p->alpha * p->alpha * reg;
+}
+
+/*
+------------------------------------------------------------------------------
+
+ gradient of f(g, b) = |y - A*g+b|^2 + a^2*|Pg|^2
+ x = (g, b)
+
+------------------------------------------------------------------------------
+*/
+
+void fun_df(const gsl_vector *x, void* params, gsl_vector *grad)
+{
+	parameter* p = (parameter*) params;
+	
+	int n = p->y->size;
+	int m = x->size - 1;
+		
+	gsl_vector* z   = gsl_vector_alloc( n );
+	gsl_vector* d2g = gsl_vector_alloc( m );
+	gsl_vector* d4g = gsl_vector_alloc( m );
+	
+	diff2(x,   d2g);
+	diff2(d2g, d4g);
+	
+	int i, j;
+	double zi;
+	double b = gsl_vector_get(x, m);
+	
+	for (i = 0; i < n; i++)
+	{
+		zi = b;
+		for (j = 0; j < m; j++)
+			zi += gsl_vector_get(p->c, j) * gsl_matrix_get(p->K, i, j) * gsl_vector_get(x, j);
+		gsl_vector_set(z, i, zi);
+	}
+	
+	double gradi;
+	for (i = 0; i < m; i++)
+	{
+		gradi = 0;
+		for (j = 0; j < n; j++)
+			gradi += 2 * gsl_vector_get(p->w, j) * (gsl_vector_get(z, j) - gsl_vector_get(p->y, j)) * gsl_vector_get(p->c, i) * gsl_matrix_get(p->K, j, i);	
+			
+		gsl_vector_set(grad, i, gradi + 2 * p->alpha * p->alpha * gsl_vector_get(d4g, i));
+	}
+	
+	double gradm = 0;
+	for (j = 0; j < n; j++)
+		gradm += 2 * gsl_vector_get(p->w, j) * (gsl_vector_get(z, j) - gsl_vector_get(p->y, j));
+	gsl_vector_set(grad, m, gradm);
+
+	gsl_vector_free( z   );
+	gsl_vector_free( d2g );
+	gsl_vector_free( d4g );
+}
+
+/*
+------------------------------------------------------------------------------
+
+ gradient and function value together 
+
+------------------------------------------------------------------------------
+*/
+
+void fun_fdf(	const gsl_vector *x, void* params,
+				double *f, gsl_vector *grad )
+{
+	parameter* p = (parameter*) params;
+	
+	int n = p->y->size;
+	int m = x->size - 1;
+		
+	gsl_vector* z   = gsl_vector_alloc( n );
+	gsl_vector* d2g = gsl_vector_alloc( m );
+	gsl_vector* d4g = gsl_vector_alloc( m );
+
+	diff2(x,   d2g);
+	diff2(d2g, d4g);
+		
+	/*
+	 integral operation, A is the kernel discretization
+	 and c are the weights of the quadrature formula
+	*/
+	
+	int i, j;
+	double zi;
+	double b = gsl_vector_get(x, m);
+	
+	for (i = 0; i < n; i++)
+	{
+		zi = b;
+		for (j = 0; j < m; j++)
+			zi += gsl_vector_get(p->c, j) * gsl_matrix_get(p->K, i, j) * gsl_vector_get(x, j);
+		gsl_vector_set(z, i, zi);
+	}
+	
+	double var = 0;
+	for (i = 0; i < n; i++)
+		var += gsl_vector_get(p->w, i) * sqr(gsl_vector_get(p->y, i) - gsl_vector_get(z, i));
+	
+	/* determine the second derivative of g */
+	
+	
+	double reg = 0;
+	for (i = 0; i < m; i++)
+		reg += sqr(gsl_vector_get(d2g, i));
+	
+	*f = var + p->alpha * p->alpha * reg;
+	
+	double gradi;
+	for (i = 0; i < m; i++)
+	{
+		gradi = 0;
+		for (j = 0; j < n; j++)
+			gradi += 2 * gsl_vector_get(p->w, j) * (gsl_vector_get(z, j) - gsl_vector_get(p->y, j)) * gsl_vector_get(p->c, i) * gsl_matrix_get(p->K, j, i);	
+			
+		gsl_vector_set(grad, i, gradi + 2 * p->alpha * p->alpha * gsl_vector_get(d4g, i));
+	}
+	
+	double gradm = 0;
+	for (j = 0; j < n; j++)
+		gradm += 2 * gsl_vector_get(p->w, j) * (gsl_vector_get(z, j) - gsl_vector_get(p->y, j));
+	gsl_vector_set(grad, m, gradm);
+
+	/* 
+	 free memory
+	*/
+	
+	gsl_vector_free( z );  
+	gsl_vector_free( d2g  );
+	gsl_vector_free( d4g  );
+}
+
+/*
+------------------------------------------------------------------------------
+
+ product of hessian matrix with arbitrary vector v
+
+------------------------------------------------------------------------------
+*/
+
+void fun_Hv( const gsl_vector *x, void *params,
+			 const gsl_vector *v, gsl_vector *hv )
+{
+	parameter* p = (parameter*) params;
+	
+	int n = p->y->size;
+	int m = x->size - 1;
+	
+	gsl_vector* d2v = gsl_vector_alloc(m);
+	gsl_vector* d4v = gsl_vector_alloc(m);
+	
+	diff2(v,   d2v);
+	diff2(d2v, d4v);
+	
+	double H1ij;
+	double H2i;
+	double H3 = 0;
+	int i, j, k;
+	for (k = 0; k < n; k++)
+		H3 += 2 * gsl_vector_get(p->w, k);
+	
+	double hvi;
+	double hvm = H3 * gsl_vector_get(v, m);
+	for (i = 0; i < m; i++)
+	{
+		H2i = 0;
+		for (k = 0; k < n; k++)
+			H2i += 2 * gsl_vector_get(p->w, k) * gsl_vector_get(p->c, i) * gsl_matrix_get(p->K, k, i);
+		
+		hvm += H2i * gsl_vector_get(v, i);
+		
+		hvi = H2i * gsl_vector_get(v, m);
+		for (j = 0; j < m; j++)
+		{
+			H1ij = 0;
+			for (k = 0; k < n; k++)
+				H1ij += 2*gsl_vector_get(p->w, k) * gsl_vector_get(p->c, i) * gsl_matrix_get(p->K, k, i) * gsl_vector_get(p->c, j) * gsl_matrix_get(p->K, k, j);
+			
+			hvi += H1ij * gsl_vector_get(v, j);
+		}
+		gsl_vector_set(hv, i, hvi + gsl_vector_get(d4v, i));
+	}
+	gsl_vector_set(hv, m, hvm);
+	
+	gsl_vector_free( d2v );
+	gsl_vector_free( d4v );
+}
+
+/*
+------------------------------------------------------------------------------
+
+ displays first two arguements during optimization
+
+------------------------------------------------------------------------------
+*/
+
+void iteration_echo( ool_conmin_minimizer *M )
+{
+	double f = M->f;	size_t ii, nn;
+
+	nn = 2;
+
+	printf( "f( " );
+	for( ii = 0; ii < 3; ii++ )
+		printf( "%+6.3e, ", gsl_vector_get( M->x, ii ) );
+	printf( "... ) = %+6.3e\n", f );
+
+}
+
+/*
+------------------------------------------------------------------------------
+
+ save function to text file
+
+------------------------------------------------------------------------------
+*/
+
+void saveData(gsl_vector* x, gsl_vector* y, char* fileName)
+{
+	FILE* fileID = fopen(fileName, "w");
+	
+	int i;
+	for (i = 0; i < x->size; i++)
+		fprintf(fileID, "%lf\t%lf\n", gsl_vector_get(x, i), 
+									  gsl_vector_get(y, i));
+									  
+	fclose(fileID);
+}
+
+/*
+------------------------------------------------------------------------------
+
+ Contin Algorithm 
+ For given data (t,y) the spectral function (tau, s) is determined such that 
+ y(t) = integral(K(t,s)*g(s) + b, {s, s0, s1})
+ 
+
+------------------------------------------------------------------------------
+*/
+
+int contin( parameter*  p, 
+			gsl_vector* s,
+			gsl_vector* g,
+			double*     b)
+{
+	double t0;
+	LS_SPAN_BEGIN(t0);
+	ls_count(LS_CONTIN, 1, 0);
+
+	/*
+	 start minimization to find spectral function 
+	*/
+	int m = g->size;
+	size_t nn   =  m + 1;
+	size_t nmax = 100000;
+	size_t ii;
+	int status;
+	
+	/*
+	 select which optimization algorithm will be used, the SPG algorithm, 
+	 in this example
+	*/
+	
+	const ool_conmin_minimizer_type *T = ool_conmin_minimizer_spg;
+	ool_conmin_spg_parameters P;
+
+	/*
+	 declare variables to hold the objective function, the constraints, 
+	 the minimizer method, and the initial iterate, respectively
+	*/
+	
+	ool_conmin_function   F;
+	ool_conmin_constraint C;
+	ool_conmin_minimizer *M;
+	gsl_vector *X;
+	
+	/*
+	 the function structure is filled in with the number of variables, 
+	 pointers to routines to evaluate the objective function and its 
+	 derivatives, and a pointer to the function parameters */
+	 
+	F.n   = nn;
+	F.f   = &fun;
+	F.df  = &fun_df;
+	F.fdf = &fun_fdf;
+	F.Hv  = &fun_Hv;
+	F.params = (void *) p;
+	
+	/*
+	 the lower and upper bounds are set to -3 and 3, respectively, 
+	 to all variables.
+	*/
+	
+	C.n = nn;
+	C.L = gsl_vector_alloc( C.n );
+	C.U = gsl_vector_alloc( C.n );
+
+	gsl_vector_set_all( C.L,    0.0 );
+	gsl_vector_set_all( C.U,  100.0 );
+	
+	/* 
+	 these two lines allocate and set the initial iterate 
+	*/
+	
+	X = gsl_vector_alloc( nn );
+	gsl_vector_set_all( X, 1.0 );
+	/* we better set the background parameter to 0 */
+	gsl_vector_set(X, X->size - 1, 0);
+	
+	
+	/*
+	 allocate the necessary memory for an instance of the
+	 optimization algorithm of type T. Initializes its parameters 
+	 to default values. If the you want to tune the method by 
+	 changing the default values to some parameter this should 
+	 be done 
+	*/
+	
+	M = ool_conmin_minimizer_alloc( T, nn );
+	ool_conmin_parameters_default( T, (void*)(&P) );
+	
+	/*
+	 everything is put together. It states that this instance of 
+	 the method M is responsible for minimizing function F, subject 
+	 to constraints C, starting from point X, with parameters P. 
+	*/
+	
+	ool_conmin_minimizer_set( M, &F, &C, X, (void*)(&P) );
+	
+	/*
+	 The iteration counter is initialized and some information
+	 concerning the initial point is displayed. The iteration 
+	 loop is repeated while the maximum number of iterations was not reached
+	 and the status is OOL_CONTINUE. Further conditions could also be 
+	 considered (maximum number of function/gradient evaluation for example).
+	 The iteration counter is incremented and one single iteration of the 
+	 method is performed. Current iterate is checked for optimality. 
+	 Finally some information concerning this iteration is displayed. 
+	*/
+	
+	ii = 0;
+	status = OOL_CONTINUE;
+	
+	/*printf( "%4i : ", ii );
+		iteration_echo ( M );
+	printf( "\n" );			*/
+
+	while( ii < nmax && status == OOL_CONTINUE )
+	{
+		ii++;
+		ool_conmin_minimizer_iterate( M );
+		status = ool_conmin_is_optimal( M );
+
+	/*	if( ii % 100 == 0 )
+		{
+			printf( "%4i ", ii );
+			iteration_echo( M );
+		}					*/
+	}
+	
+	if(p->verbose && status == OOL_SUCCESS)
+		printf("Convergence in %i iterations", ii);
+	else if(p->verbose)
+		printf("Stopped with %i iterations", ii);
+
+/*	printf( "\nvariables................: %6i"
+			"\nfunction evaluations.....: %6i"
+			"\ngradient evaluations.....: %6i"
+			"\nfunction value...........: % .6e"
+			"\nprojected gradient norm..: % .6e\n",
+			nn,
+			ool_conmin_minimizer_fcount( M ),
+			ool_conmin_minimizer_gcount( M ),
+			ool_conmin_minimizer_minimum( M ),
+			ool_conmin_minimizer_size( M ));	*/
+
+	gsl_vector_memcpy(s, p->tau);
+	int i;
+	for (i = 0; i < g->size; i++)
+		gsl_vector_set(g, i, gsl_vector_get(M->x, i));
+	*b =  gsl_vector_get(M->x, m);
+	
+	gsl_vector_free( C.L );
+	gsl_vector_free( C.U );
+	gsl_vector_free( X );
+
+	ool_conmin_minimizer_free( M );
+	LS_SPAN_END(t0, LS_CONTIN, "contin", NULL);
+	
+	return OOL_SUCCESS;
+	
+}
+
+/*
+------------------------------------------------------------------------------
+
+ parameter struct of a bootstrap replicate: shares kernel, quadrature
+ weights and axes with p, owns y and w
+
+------------------------------------------------------------------------------
+*/
+
+parameter* parameter_replicate(const parameter* p)
+{
+	parameter* r = malloc(sizeof(parameter));
+	*r = *p;
+	r -> y = gsl_vector_alloc( p->y->size );
+	r -> w = gsl_vector_alloc( p->w->size );
+	gsl_vector_memcpy(r->y, p->y);
+	gsl_vector_memcpy(r->w, p->w);
+	r -> verbose = 0;
+	return r;
+}
+
+void parameter_replicate_free(parameter* r)
+{
+	gsl_vector_free( r->y );
+	gsl_vector_free( r->w );
+	free(r);
+}
+
+/*
+------------------------------------------------------------------------------
+
+ Bootstrap / jackknife of the Contin solution (g, b) of p
+
+ mode 0, bootstrap: residual resampling, the standardized residuals
+ sqrt(w)*(y - z) are drawn with replacement and added to the fitted z
+ mode 1, jackknife: replicate r drops the r-th of n_rep contiguous blocks
+ of the data (weight 0)
+ 
+ Every replicate is solved again by contin; the replicates run in parallel
+ (OpenMP). G_rep (m x n_rep) and b_rep (n_rep) receive the solutions.
+ Replicate r draws from its own random stream ls_rng_seed(seed, r) (ls.c),
+ so the result does not depend on the number of threads.
+
+------------------------------------------------------------------------------
+*/
+
+void contin_bootstrap( parameter*  p,
+					   gsl_vector* g,
+					   double      b,
+					   int         n_rep,
+					   unsigned long long seed,
+					   int         mode,
+					   gsl_matrix* G_rep,
+					   gsl_vector* b_rep)
+{
+	int n = p->y->size;
+	int m = g->size;
+	int i, j, r;
+	double t0;
+	
+	LS_SPAN_BEGIN(t0);
+	/* fitted curve and standardized residuals */
+	gsl_vector* z = gsl_vector_alloc(n);
+	gsl_vector* e = gsl_vector_alloc(n);
+	double zi;
+	for (i = 0; i < n; i++)
+	{
+		zi = b;
+		for (j = 0; j < m; j++)
+			zi += gsl_vector_get(p->c, j) * gsl_matrix_get(p->K, i, j) * gsl_vector_get(g, j);
+		gsl_vector_set(z, i, zi);
+		gsl_vector_set(e, i, sqrt(gsl_vector_get(p->w, i)) * (gsl_vector_get(p->y, i) - zi));
+	}
+	
+#ifdef _OPENMP
+	#pragma omp parallel for schedule(dynamic)
+#endif
+	for (r = 0; r < n_rep; r++)
+	{
+		parameter* pr = parameter_replicate(p);
+		gsl_vector* sr = gsl_vector_alloc(m);
+		gsl_vector* gr = gsl_vector_alloc(m);
+		ls_rng rng;
+		double br, wi;
+		int k;
+		
+		ls_rng_seed(&rng, seed, r);
+		for (k = 0; k < n; k++)
+		{
+			wi = gsl_vector_get(p->w, k);
+			if (mode == 1)
+			{
+				if ((long) k * n_rep / n == r)
+					gsl_vector_set(pr->w, k, 0);
+			}
+			else if (wi > 0)
+				gsl_vector_set(pr->y, k, gsl_vector_get(z, k) + gsl_vector_get(e, ls_rng_int(&rng, n)) / sqrt(wi));
+		}
+		contin(pr, sr, gr, &br);
+		
+		gsl_vector_view col = gsl_matrix_column(G_rep, r);
+		gsl_vector_memcpy(&col.vector, gr);
+		gsl_vector_set(b_rep, r, br);
+		
+		gsl_vector_free(sr);
+		gsl_vector_free(gr);
+		parameter_replicate_free(pr);
+	}
+	
+	gsl_vector_free(z);
+	gsl_vector_free(e);
+	/* the replicates are spans of their own */
+	if (t0 > 0)
+		ls_trace_phase(LS_CONTIN, "contin_bootstrap", t0, ls_now());
+}
+
+/*
+------------------------------------------------------------------------------
+
+ 95% interval [lo, hi] of every row of the replicates X (rows x n_rep)
+ bootstrap: 2.5% and 97.5% percentiles
+ jackknife: x -+ 1.96 * se, se^2 = (n - 1) / n * sum((x_r - mean)^2)
+
+------------------------------------------------------------------------------
+*/
+
+void replicate_interval( const gsl_matrix* X,
+						 const gsl_vector* x,
+						 int               mode,
+						 gsl_vector*       lo,
+						 gsl_vector*       hi)
+{
+	int n = X->size2;
+	int i;
+	double* row = malloc(n * sizeof(double));
+	double se;
+	
+	for (i = 0; i < X->size1; i++)
+	{
+		gsl_vector_const_view v = gsl_matrix_const_row(X, i);
+		gsl_vector_view rv = gsl_vector_view_array(row, n);
+		gsl_vector_memcpy(&rv.vector, &v.vector);
+		if (mode == 1)
+		{
+			se = sqrt((n - 1.0) / n * (n - 1) * gsl_stats_variance(row, 1, n));
+			gsl_vector_set(lo, i, gsl_vector_get(x, i) - 1.959963984540054 * se);
+			gsl_vector_set(hi, i, gsl_vector_get(x, i) + 1.959963984540054 * se);
+		}
+		else
+		{
+			gsl_sort(row, 1, n);
+			gsl_vector_set(lo, i, gsl_stats_quantile_from_sorted_data(row, 1, n, 0.025));
+			gsl_vector_set(hi, i, gsl_stats_quantile_from_sorted_data(row, 1, n, 0.975));
+		}
+	}
+	free(row);
+}
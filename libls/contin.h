@@ -0,0 +1,56 @@
+/*
+------------------------------------------------------------------------------
+
+ libls: CONTIN inversion (contin.c), needs gsl and ool.
+ 
+ y(t) = integral(K(t,tau)s(tau), {tau, tau0, tau1}) + b
+
+------------------------------------------------------------------------------
+*/
+
+#ifndef CONTIN_H
+#define CONTIN_H
+
+#include <ool/ool_conmin.h>
+#include <gsl/gsl_matrix.h>
+
+/*
+------------------------------------------------------------------------------
+
+ parameter struct for optimazation routine 
+
+------------------------------------------------------------------------------
+*/
+
+typedef struct 
+{
+	gsl_matrix* K;		/* matrix for integration kernel */
+	gsl_vector* y;		/* y-axis of observed data */
+	gsl_vector* t;		/* t-axis of observed data */
+	gsl_vector* tau;	/* tau-axis for time constants */
+	gsl_vector* w;		/* weights for euclidian norm */
+	gsl_vector* c;		/* weights due to numerical intergration */
+	double alpha;		/* strenght of regularizer */
+	int verbose;		/* print the number of iterations */
+	
+} parameter;
+
+parameter* parameter_alloc(gsl_vector* t, gsl_vector* y, gsl_vector* var, double alpha,
+						   double tau0, double tau1, int m, int kernelType);
+void parameter_free(parameter* p);
+
+double fun(const gsl_vector* x, void* params);
+void fun_df(const gsl_vector *x, void* params, gsl_vector *grad);
+
+int contin(parameter* p, gsl_vector* s, gsl_vector* g, double* b);
+void contin_bootstrap(parameter* p, gsl_vector* g, double b, int n_rep,
+					  unsigned long long seed, int mode, gsl_matrix* G_rep, gsl_vector* b_rep);
+void replicate_interval(const gsl_matrix* X, const gsl_vector* x, int mode,
+						gsl_vector* lo, gsl_vector* hi);
+
+/* test data and output of the command line test (Contin/contin.c) */
+void example(gsl_vector* intensity, gsl_vector* tau, gsl_vector* t, gsl_vector* y,
+			 gsl_vector* var, int n, double t0, double tend);
+void saveData(gsl_vector* x, gsl_vector* y, char* fileName);
+
+#endif
@@ -0,0 +1,211 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  cumulants.c
+ *
+ *    Description:  closed-form weighted cumulant analysis of many correlograms.
+ *                  For every correlogram the points with g > min_g are fitted by the
+ *                  weighted polynomial
+ *
+ *                      log( sqrt( g ) ) = loga - Gamma t + mu2 / 2 t^2 - mu3 / 6 t^3
+ *
+ *                  (weights 1 / dy^2, dy = dg / (2 g), as the 'Cumulants' branch of
+ *                  fit_discrete). The moments sum(w t^j), sum(w y t^j) are accumulated
+ *                  in a single pass over the data, the normal equations are solved in
+ *                  closed form. Order 1, 2 or 3.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "ls.h"
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  cu_student_t95
+ *  Description:  0.975 quantile of Student's t distribution (Cornish-Fisher expansion,
+ *                relative error < 1e-4 for dof >= 3)
+ * =====================================================================================
+ */
+double cu_student_t95(int dof)
+{
+    const double z = 1.959963984540054;
+    double z3 = z * z * z, z5 = z3 * z * z, z7 = z5 * z * z, z9 = z7 * z * z;
+    double v = dof;
+    if (dof <= 0)
+        return NAN;
+    if (dof == 1)
+        return 12.706204736174698;
+    if (dof == 2)
+        return 4.302652729749464;
+    return z + (z3 + z) / (4 * v)
+        + (5 * z5 + 16 * z3 + 3 * z) / (96 * v * v)
+        + (3 * z7 + 19 * z5 + 17 * z3 - 15 * z) / (384 * v * v * v)
+        + (79 * z9 + 776 * z7 + 1482 * z5 - 1920 * z3 - 945 * z) / (92160 * v * v * v * v);
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  cu_invert
+ *  Description:  invert the symmetric positive definite matrix a (n x n, n at most
+ *                CU_MAX_PAR) in place (Gauss-Jordan with partial pivoting). Returns 0
+ *                if singular.
+ * =====================================================================================
+ */
+int cu_invert(double *a, int n)
+{
+    int i, j, k, p;
+    double inv[CU_MAX_PAR * CU_MAX_PAR], tmp, f;
+
+    for (i = 0; i < n; i++)
+        for (j = 0; j < n; j++)
+            inv[i * n + j] = (i == j);
+    for (k = 0; k < n; k++)
+    {
+        p = k;
+        for (i = k + 1; i < n; i++)
+            if (fabs(a[i * n + k]) > fabs(a[p * n + k]))
+                p = i;
+        if (a[p * n + k] == 0)
+            return 0;
+        for (j = 0; j < n; j++)
+        {
+            tmp = a[k * n + j]; a[k * n + j] = a[p * n + j]; a[p * n + j] = tmp;
+            tmp = inv[k * n + j]; inv[k * n + j] = inv[p * n + j]; inv[p * n + j] = tmp;
+        }
+        f = a[k * n + k];
+        for (j = 0; j < n; j++)
+        {
+            a[k * n + j] /= f;
+            inv[k * n + j] /= f;
+        }
+        for (i = 0; i < n; i++)
+        {
+            if (i == k)
+                continue;
+            f = a[i * n + k];
+            for (j = 0; j < n; j++)
+            {
+                a[i * n + j] -= f * a[k * n + j];
+                inv[i * n + j] -= f * inv[k * n + j];
+            }
+        }
+    }
+    memcpy(a, inv, n * n * sizeof(double));
+    return 1;
+}
+
+/*  lags above min_g with a usable error (as linreg.c, rebin.c) */
+static int cu_use(const double *t, const double *g, const double *dg, int k, double min_g)
+{
+    return g[k] > min_g && isfinite(t[k]) && isfinite(g[k]) && isfinite(dg[k]) && dg[k] > 0;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  cu_fit
+ *  Description:  cumulants of one correlogram. Returns 0 if there are not enough
+ *                points above min_g (coefficients are then NaN). Lags with a
+ *                non-finite value or dg <= 0 are skipped.
+ * =====================================================================================
+ */
+static int cu_fit(const double *t, const double *g, const double *dg, int n, int order,
+        double min_g, cu_result *res)
+{
+    /*  sign and factorial of the polynomial coefficients: loga, -Gamma, mu2/2, -mu3/6 */
+    const double factor[CU_MAX_PAR] = { 1, -1, 0.5, -1.0 / 6 };
+    double sw[2 * CU_MAX_ORDER + 1], swy[CU_MAX_PAR], swyy = 0;
+    double nm[CU_MAX_PAR * CU_MAX_PAR], b[CU_MAX_PAR];
+    double scale = 0, tp, ts, y, dy, w, chi2, mse, tq, sj;
+    int i, j, k, np = order + 1, m = 0;
+
+    for (j = 0; j < CU_MAX_PAR; j++)
+        res->coeff[j] = res->error[j] = NAN;
+    res->n    = 0;
+    res->chi2 = NAN;
+    if (order < 1 || order > CU_MAX_ORDER)
+        return 0;
+    /*  time scale for a well conditioned moment matrix */
+    for (k = 0; k < n; k++)
+        if (cu_use(t, g, dg, k, min_g) && t[k] > scale)
+            scale = t[k];
+    if (scale <= 0)
+        return 0;
+
+    memset(sw, 0, sizeof(sw));
+    memset(swy, 0, sizeof(swy));
+    /*  single pass accumulation of the moments */
+    for (k = 0; k < n; k++)
+    {
+        if (!cu_use(t, g, dg, k, min_g))
+            continue;
+        y  = log(sqrt(g[k]));
+        dy = dg[k] / (2 * g[k]);
+        w  = 1 / (dy * dy);
+        ts = t[k] / scale;
+        tp = 1;
+        for (j = 0; j <= 2 * order; j++)
+        {
+            sw[j] += w * tp;
+            if (j <= order)
+                swy[j] += w * y * tp;
+            tp *= ts;
+        }
+        swyy += w * y * y;
+        m++;
+    }
+    res->n = m;
+    if (m < np)
+        return 0;
+
+    for (i = 0; i < np; i++)
+        for (j = 0; j < np; j++)
+            nm[i * np + j] = sw[i + j];
+    if (!cu_invert(nm, np))
+        return 0;
+    for (i = 0; i < np; i++)
+    {
+        b[i] = 0;
+        for (j = 0; j < np; j++)
+            b[i] += nm[i * np + j] * swy[j];
+    }
+    /*  chi2 = y'Wy - b'X'Wy  at the solution of the normal equations */
+    chi2 = swyy;
+    for (i = 0; i < np; i++)
+        chi2 -= b[i] * swy[i];
+    chi2 = chi2 > 0 ? chi2 : 0;
+    mse  = m > np ? chi2 / (m - np) : 0;
+    tq   = m > np ? cu_student_t95(m - np) : NAN;
+
+    sj = 1;
+    for (j = 0; j < np; j++)
+    {
+        res->coeff[j] = b[j] / sj / factor[j];
+        res->error[j] = tq * sqrt(fabs(nm[j * np + j]) * mse) / sj / fabs(factor[j]);
+        sj *= scale;
+    }
+    res->chi2 = chi2;
+    return 1;
+}
+
+/*  cu_fit with counter and span */
+int cu_cumulants(const double *t, const double *g, const double *dg, int n, int order,
+        double min_g, cu_result *res)
+{
+    double t0;
+    int ok;
+    LS_SPAN_BEGIN(t0);
+    ls_count(LS_CUMULANTS, 1, 0);
+    ok = cu_fit(t, g, dg, n, order, min_g, res);
+    LS_SPAN_END(t0, LS_CUMULANTS, "cu_cumulants", NULL);
+    return ok;
+}
@@ -0,0 +1,39 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  cumulants.h
+ *
+ *    Description:  closed-form weighted cumulant analysis of correlograms, see
+ *                  cumulants.c. Part of libls, used by +DLS/cumulants_fast.c.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#ifndef CUMULANTS_H
+#define CUMULANTS_H
+
+#define CU_MAX_ORDER 3
+/*  default order of cumulants_fast, DLS.cumulants and DLS.Store.cumulants: up to mu2,
+ *  so the polydispersity is always there */
+#define CU_DEFAULT_ORDER 2
+#define CU_MAX_PAR   (CU_MAX_ORDER + 1)
+
+typedef struct
+{
+    int    n;                   /* points used (g > min_g, dg > 0) */
+    double chi2;
+    double coeff[CU_MAX_PAR];   /* loga, Gamma, mu2, mu3 */
+    double error[CU_MAX_PAR];   /* half width of the 95% confidence interval */
+} cu_result;
+
+int cu_cumulants(const double *t, const double *g, const double *dg, int n, int order,
+        double min_g, cu_result *res);
+double cu_student_t95(int dof);
+int    cu_invert(double *a, int n);
+
+#endif
@@ -0,0 +1,251 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  datetime_parse.c
+ *
+ *    Description:  date / time strings -> matlab serial date numbers.
+ *                  Formats use the symbols of datenum:
+ *                    yyyy, yy     year (yy: pivot year = current year - 50, as datenum)
+ *                    mm           month            mmm, mmmm  month name (en, de)
+ *                    dd           day              ddd, dddd  weekday name (skipped)
+ *                    HH, MM, SS   hour, minute, second (SS may have a fraction)
+ *                    PM           AM / PM
+ *                  Numbers except the year may have one digit less than the symbol
+ *                  ("3/27/2010"). A space matches any run of white space, other
+ *                  characters must match literally.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+#include <math.h>
+
+#include "ls.h"
+
+const char *const dt_builtin_formats[DT_N_BUILTIN] =
+{
+    "\"mm/dd/yyyy\" \"HH:MM:SS PM\"",       /* ALV (english locale) */
+    "\"dd/mm/yy\" \"HH:MM:SS\"",
+    "\"dd.mm.yy\" \"HH:MM:SS\"",
+    "dddd, dd. mmmm yyyy HH:MM:SS"          /* Malvern (german locale) */
+};
+
+/*  first three letters of the month names, english then german */
+static const char *const dt_months[] =
+{
+    "jan", "feb", "mar", "apr", "may", "jun", "jul", "aug", "sep", "oct", "nov", "dec",
+    "jan", "feb", "mrz", "apr", "mai", "jun", "jul", "aug", "sep", "okt", "nov", "dez"
+};
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  dt_datenum
+ *  Description:  serial date number as datenum(year, month, day, hour, minute, second)
+ * =====================================================================================
+ */
+double dt_datenum(int year, int month, int day, int hour, int minute, double second)
+{
+    static const int cumdays[12] = { 0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334 };
+    double y = year, n;
+    int leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+    n = 365 * y + ceil(y / 4) - ceil(y / 100) + ceil(y / 400) + cumdays[month - 1] + day;
+    if (month > 2 && leap)
+        n += 1;
+    return n + (hour + (minute + second / 60) / 60) / 24;
+}
+
+/*  unsigned integer of min_digits to max_digits digits at *s, -1 if none */
+static int dt_number(const char **s, int min_digits, int max_digits)
+{
+    int x = 0, n = 0;
+    while (n < max_digits && isdigit((unsigned char) **s))
+    {
+        x = 10 * x + (**s - '0');
+        (*s)++;
+        n++;
+    }
+    return n >= min_digits ? x : -1;
+}
+
+/*  run of letters (also bytes >= 128 of accented utf-8 / latin-1 letters) */
+static int dt_word(const char **s, char *word, int size)
+{
+    int n = 0;
+    while (isalpha((unsigned char) **s) || (unsigned char) **s >= 128)
+    {
+        if (n < size - 1)
+            word[n++] = (char) tolower((unsigned char) **s);
+        (*s)++;
+    }
+    word[n] = '\0';
+    return n;
+}
+
+/*  month of a name (1-12), 0 if unknown; "mär" / "märz" is march */
+static int dt_month_name(const char *word)
+{
+    int i;
+    if (strncmp(word, "m\xc3\xa4r", 4) == 0 || strncmp(word, "m\xe4r", 3) == 0)
+        return 3;
+    if (strlen(word) < 3)
+        return 0;
+    for (i = 0; i < 24; i++)
+        if (strncmp(word, dt_months[i], 3) == 0)
+            return i % 12 + 1;
+    return 0;
+}
+
+/*  count of the repeated symbol c at f */
+static int dt_run(const char *f, char c)
+{
+    int n = 0;
+    while (f[n] == c)
+        n++;
+    return n;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  dt_parse_format
+ *  Description:  parse str with one format. Returns 1 and the serial date number if
+ *                the whole string matches.
+ * =====================================================================================
+ */
+int dt_parse_format(const char *str, const char *format, double *serial)
+{
+    const char *s = str, *f = format;
+    int year = -1, month = 1, day = 1, hour = 0, minute = 0, pm = -1, n, x;
+    double second = 0;
+    char word[16];
+
+    while (isspace((unsigned char) *s))
+        s++;
+    while (*f)
+    {
+        if (*f == ' ')
+        {
+            if (!isspace((unsigned char) *s))
+                return 0;
+            while (isspace((unsigned char) *s))
+                s++;
+            while (*f == ' ')
+                f++;
+            continue;
+        }
+        if (*f == 'y' || *f == 'm' || *f == 'd' || *f == 'H' || *f == 'M' || *f == 'S')
+        {
+            n = dt_run(f, *f);
+            if ((*f == 'm' || *f == 'd') && n >= 3)
+            {
+                if (!dt_word(&s, word, sizeof(word)))
+                    return 0;
+                if (*f == 'm' && !(month = dt_month_name(word)))
+                    return 0;
+            }
+            else
+            {
+                /*  the year needs all its digits, the others one less */
+                if ((x = dt_number(&s, *f == 'y' ? n : (n > 1 ? n - 1 : 1), n)) < 0)
+                    return 0;
+                switch (*f)
+                {
+                    case 'y':
+                        year = x;
+                        if (n == 2)
+                        {
+                            static int pivot = 0;
+                            if (!pivot)
+                            {
+                                time_t now = time(NULL);
+                                pivot = localtime(&now)->tm_year + 1900 - 50;
+                            }
+                            year = pivot - pivot % 100 + x;
+                            if (year < pivot)
+                                year += 100;
+                        }
+                        break;
+                    case 'm': month  = x; break;
+                    case 'd': day    = x; break;
+                    case 'H': hour   = x; break;
+                    case 'M': minute = x; break;
+                    case 'S':
+                        second = x;
+                        if (*s == '.' && isdigit((unsigned char) s[1]))
+                        {
+                            double scale = 0.1;
+                            for (s++; isdigit((unsigned char) *s); s++, scale /= 10)
+                                second += scale * (*s - '0');
+                        }
+                        break;
+                }
+            }
+            f += n;
+            continue;
+        }
+        if (f[0] == 'P' && f[1] == 'M')
+        {
+            if ((s[0] == 'A' || s[0] == 'a' || s[0] == 'P' || s[0] == 'p')
+                    && (s[1] == 'M' || s[1] == 'm'))
+                pm = s[0] == 'P' || s[0] == 'p';
+            else
+                return 0;
+            s += 2;
+            f += 2;
+            continue;
+        }
+        if (*s != *f)
+            return 0;
+        s++;
+        f++;
+    }
+    while (isspace((unsigned char) *s))
+        s++;
+    if (*s || year < 0 || month < 1 || month > 12 || day < 1 || day > 31
+            || hour > 24 || minute > 59 || second >= 61)
+        return 0;
+    if (pm >= 0)
+    {
+        if (hour < 1 || hour > 12)
+            return 0;
+        hour = hour % 12 + 12 * pm;
+    }
+    *serial = dt_datenum(year, month, day, hour, minute, second);
+    return 1;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  dt_parse
+ *  Description:  parse str with the first matching format (formats[*hint] is tried
+ *                first, *hint is set to the matching format: series of files share
+ *                the format). Returns 0 and NaN if no format matches.
+ * =====================================================================================
+ */
+int dt_parse(const char *str, const char *const *formats, int n_formats, int *hint,
+        double *serial)
+{
+    double t0;
+    int i, ok = 0;
+    LS_SPAN_BEGIN(t0);
+    ls_count(LS_DATETIME, 1, 0);
+    if (*hint >= 0 && *hint < n_formats && dt_parse_format(str, formats[*hint], serial))
+        ok = 1;
+    for (i = 0; !ok && i < n_formats; i++)
+        if (i != *hint && dt_parse_format(str, formats[i], serial))
+        {
+            *hint = i;
+            ok = 1;
+        }
+    if (!ok)
+        *serial = NAN;
+    LS_SPAN_END(t0, LS_DATETIME, "dt_parse", str);
+    return ok;
+}
@@ -0,0 +1,31 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  datetime_parse.h
+ *
+ *    Description:  parse date / time strings of the instrument files into matlab
+ *                  serial date numbers (as datenum) without calling matlab, see
+ *                  datetime_parse.c. Part of libls, used by parse_datetime_fast.c
+ *                  and the native readers of the instruments.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#ifndef DATETIME_PARSE_H
+#define DATETIME_PARSE_H
+
+/*  formats known without registration, most common first */
+#define DT_N_BUILTIN 4
+extern const char *const dt_builtin_formats[DT_N_BUILTIN];
+
+double dt_datenum(int year, int month, int day, int hour, int minute, double second);
+int    dt_parse_format(const char *str, const char *format, double *serial);
+int    dt_parse(const char *str, const char *const *formats, int n_formats, int *hint,
+        double *serial);
+
+#endif
@@ -0,0 +1,565 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  global_fit.c
+ *
+ *    Description:  global (shared-parameter) fit of many correlograms.
+ *                  The diffusion coefficients are global (Gamma = 1e6 * D * q^2), the
+ *                  amplitudes and baselines are local to every correlogram.
+ *                  Levenberg-Marquardt with the block (arrow) structure of the normal
+ *                  equations: every local block is eliminated by a Schur complement,
+ *                  so one iteration costs O(number of data points).
+ *                  gf_fit_each fits many correlograms independently in one call.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "ls.h"
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  gf_model_size
+ *  Description:  number of local and global parameters of a model, 0 if unknown
+ * =====================================================================================
+ */
+int gf_model_size(int model, int *n_local, int *n_global)
+{
+    switch (model)
+    {
+    case GF_SINGLE:     *n_local = 1; *n_global = 1; return 1;
+    case GF_DOUBLE:     *n_local = 2; *n_global = 2; return 1;
+    case GF_DOUBLE_BKG: *n_local = 3; *n_global = 2; return 1;
+    default:            return 0;
+    }
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  gf_eval
+ *  Description:  model value at time t, and (if jl != NULL) the derivatives with
+ *                respect to the local (jl) and global (jg) parameters
+ * =====================================================================================
+ */
+double gf_eval(int model, double t, double q2, const double *xl,
+        const double *xg, double *jl, double *jg)
+{
+    double s = GF_D_TO_GAMMA * q2;
+    double e1, e2, a;
+
+    switch (model)
+    {
+    case GF_SINGLE:
+        e1 = exp(-2 * s * xg[0] * t);
+        if (jl)
+        {
+            jl[0] = e1;
+            jg[0] = -2 * s * t * xl[0] * e1;
+        }
+        return xl[0] * e1;
+    case GF_DOUBLE:
+    case GF_DOUBLE_BKG:
+        e1 = exp(-s * xg[0] * t);
+        e2 = exp(-s * xg[1] * t);
+        a  = xl[0] * e1 + xl[1] * e2;
+        if (jl)
+        {
+            jl[0] = 2 * a * e1;
+            jl[1] = 2 * a * e2;
+            jg[0] = -2 * a * xl[0] * s * t * e1;
+            jg[1] = -2 * a * xl[1] * s * t * e2;
+            if (model == GF_DOUBLE_BKG)
+                jl[2] = 1;
+        }
+        return model == GF_DOUBLE_BKG ? a * a + xl[2] : a * a;
+    }
+    return 0;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  gf_chi2
+ *  Description:  weighted sum of squared residuals
+ * =====================================================================================
+ */
+static double gf_chi2(const gf_problem *p, const double *xl, const double *xg)
+{
+    int i, k;
+    double chi2 = 0, r;
+    for (i = 0; i < p->n_points; i++)
+    {
+        for (k = p->offset[i]; k < p->offset[i + 1]; k++)
+        {
+            r = p->g[k] - gf_eval(p->model, p->t[k], p->q2[i], xl + i * p->n_local, xg, NULL, NULL);
+            chi2 += p->w[k] * r * r;
+        }
+    }
+    return chi2;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  gf_cholesky
+ *  Description:  Cholesky decomposition (in place, lower triangle) of the small
+ *                symmetric matrix a (n <= 3). Returns 0 if not positive definite.
+ * =====================================================================================
+ */
+static int gf_cholesky(double *a, int n)
+{
+    int i, j, k;
+    double s;
+    for (j = 0; j < n; j++)
+    {
+        s = a[j * n + j];
+        for (k = 0; k < j; k++)
+            s -= a[j * n + k] * a[j * n + k];
+        if (s <= 0)
+            return 0;
+        a[j * n + j] = sqrt(s);
+        for (i = j + 1; i < n; i++)
+        {
+            s = a[i * n + j];
+            for (k = 0; k < j; k++)
+                s -= a[i * n + k] * a[j * n + k];
+            a[i * n + j] = s / a[j * n + j];
+        }
+    }
+    return 1;
+}
+
+static void gf_cholesky_solve(const double *l, int n, double *b)
+{
+    int i, k;
+    for (i = 0; i < n; i++)
+    {
+        for (k = 0; k < i; k++)
+            b[i] -= l[i * n + k] * b[k];
+        b[i] /= l[i * n + i];
+    }
+    for (i = n - 1; i >= 0; i--)
+    {
+        for (k = i + 1; k < n; k++)
+            b[i] -= l[k * n + i] * b[k];
+        b[i] /= l[i * n + i];
+    }
+}
+
+/* invert a (n x n) from its cholesky factor */
+static void gf_cholesky_inverse(const double *l, int n, double *inv)
+{
+    int i, j;
+    double e[GF_MAX_LOCAL];
+    for (j = 0; j < n; j++)
+    {
+        for (i = 0; i < n; i++)
+            e[i] = (i == j);
+        gf_cholesky_solve(l, n, e);
+        for (i = 0; i < n; i++)
+            inv[i * n + j] = e[i];
+    }
+}
+
+/* factorize, adding a small ridge if the matrix is numerically singular */
+static void gf_factorize(double *a, const double *a0, int n)
+{
+    int i, tries;
+    double ridge = 0, d = 0;
+    for (i = 0; i < n; i++)
+        d += fabs(a0[i * n + i]);
+    d = (d > 0 ? d / n : 1) * 1e-12;
+    for (tries = 0; tries < 20; tries++)
+    {
+        memcpy(a, a0, n * n * sizeof(double));
+        for (i = 0; i < n; i++)
+            a[i * n + i] += ridge;
+        if (gf_cholesky(a, n))
+            return;
+        ridge = ridge == 0 ? d : ridge * 100;
+    }
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  gf_normal
+ *  Description:  build the blocks of the normal equations J'WJ and J'Wr:
+ *                u  : n_points blocks (L x L)   local  - local
+ *                c  : n_points blocks (L x G)   local  - global
+ *                v  : one block       (G x G)   global - global
+ *                el : n_points vectors (L)      gradient, local
+ *                eg : one vector       (G)      gradient, global
+ *                returns chi2 at the current point
+ * =====================================================================================
+ */
+static double gf_normal(const gf_problem *p, const double *xl, const double *xg,
+        double *u, double *c, double *v, double *el, double *eg)
+{
+    int i, k, a, b;
+    int L = p->n_local, G = p->n_global;
+    double jl[GF_MAX_LOCAL], jg[GF_MAX_GLOBAL];
+    double r, w, chi2 = 0;
+    double *ui, *ci, *eli;
+
+    memset(v, 0, G * G * sizeof(double));
+    memset(eg, 0, G * sizeof(double));
+    for (i = 0; i < p->n_points; i++)
+    {
+        ui  = u  + i * L * L;
+        ci  = c  + i * L * G;
+        eli = el + i * L;
+        memset(ui, 0, L * L * sizeof(double));
+        memset(ci, 0, L * G * sizeof(double));
+        memset(eli, 0, L * sizeof(double));
+        for (k = p->offset[i]; k < p->offset[i + 1]; k++)
+        {
+            r = p->g[k] - gf_eval(p->model, p->t[k], p->q2[i], xl + i * L, xg, jl, jg);
+            w = p->w[k];
+            chi2 += w * r * r;
+            for (a = 0; a < L; a++)
+            {
+                eli[a] += w * jl[a] * r;
+                for (b = 0; b <= a; b++)
+                    ui[a * L + b] += w * jl[a] * jl[b];
+                for (b = 0; b < G; b++)
+                    ci[a * G + b] += w * jl[a] * jg[b];
+            }
+            for (a = 0; a < G; a++)
+            {
+                eg[a] += w * jg[a] * r;
+                for (b = 0; b <= a; b++)
+                    v[a * G + b] += w * jg[a] * jg[b];
+            }
+        }
+        for (a = 0; a < L; a++)
+            for (b = a + 1; b < L; b++)
+                ui[a * L + b] = ui[b * L + a];
+    }
+    for (a = 0; a < G; a++)
+        for (b = a + 1; b < G; b++)
+            v[a * G + b] = v[b * G + a];
+    return chi2;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  gf_step
+ *  Description:  damped step: eliminate the local blocks (Schur complement), solve
+ *                for the global step, back substitute the local steps.
+ *                lambda == 0 -> undamped; if s_inv != NULL it receives S^{-1},
+ *                the covariance (unscaled) of the global parameters.
+ * =====================================================================================
+ */
+static void gf_step(const gf_problem *p, const double *u, const double *c,
+        const double *v, const double *el, const double *eg, double lambda,
+        double *dl, double *dg, double *work, double *s_inv)
+{
+    int i, a, b, k;
+    int L = p->n_local, G = p->n_global;
+    double s[GF_MAX_GLOBAL * GF_MAX_GLOBAL], sl[GF_MAX_GLOBAL * GF_MAX_GLOBAL];
+    double rhs[GF_MAX_GLOBAL];
+    double ud[GF_MAX_LOCAL * GF_MAX_LOCAL], y[GF_MAX_LOCAL * GF_MAX_GLOBAL];
+    double tmp[GF_MAX_LOCAL];
+    double *li;
+
+    for (a = 0; a < G; a++)
+    {
+        rhs[a] = eg[a];
+        for (b = 0; b < G; b++)
+            s[a * G + b] = v[a * G + b] + (a == b ? lambda * v[a * G + a] : 0);
+    }
+    for (i = 0; i < p->n_points; i++)
+    {
+        /*  damped local block and its cholesky factor (kept in work) */
+        li = work + i * L * L;
+        memcpy(ud, u + i * L * L, L * L * sizeof(double));
+        for (a = 0; a < L; a++)
+            ud[a * L + a] += lambda * ud[a * L + a];
+        gf_factorize(li, ud, L);
+        /*  y = U^{-1} C  (L x G) */
+        for (b = 0; b < G; b++)
+        {
+            for (a = 0; a < L; a++)
+                tmp[a] = c[i * L * G + a * G + b];
+            gf_cholesky_solve(li, L, tmp);
+            for (a = 0; a < L; a++)
+                y[a * G + b] = tmp[a];
+        }
+        /*  S -= C' U^{-1} C, rhs -= C' U^{-1} el */
+        for (a = 0; a < L; a++)
+            tmp[a] = el[i * L + a];
+        gf_cholesky_solve(li, L, tmp);
+        for (a = 0; a < G; a++)
+        {
+            for (k = 0; k < L; k++)
+                rhs[a] -= c[i * L * G + k * G + a] * tmp[k];
+            for (b = 0; b < G; b++)
+                for (k = 0; k < L; k++)
+                    s[a * G + b] -= c[i * L * G + k * G + a] * y[k * G + b];
+        }
+    }
+    gf_factorize(sl, s, G);
+    memcpy(dg, rhs, G * sizeof(double));
+    gf_cholesky_solve(sl, G, dg);
+    if (s_inv)
+        gf_cholesky_inverse(sl, G, s_inv);
+    /*  back substitution: dl = U^{-1} (el - C dg) */
+    for (i = 0; i < p->n_points; i++)
+    {
+        li = work + i * L * L;
+        for (a = 0; a < L; a++)
+        {
+            dl[i * L + a] = el[i * L + a];
+            for (b = 0; b < G; b++)
+                dl[i * L + a] -= c[i * L * G + a * G + b] * dg[b];
+        }
+        gf_cholesky_solve(li, L, dl + i * L);
+    }
+}
+
+static double gf_clamp(double x, double lo, double hi)
+{
+    return x < lo ? lo : (x > hi ? hi : x);
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  gf_active_set
+ *  Description:  freeze the parameters sitting on a bound whose gradient points out
+ *                of the box: their rows / columns are removed from the normal
+ *                equations (unit diagonal, zero gradient), so the projected step
+ *                does not stall on them.
+ * =====================================================================================
+ */
+static void gf_active_set(const gf_problem *p, const double *xl, const double *xg,
+        double *u, double *c, double *v, double *el, double *eg)
+{
+    int i, a, b;
+    int L = p->n_local, G = p->n_global;
+    double x;
+
+    for (a = 0; a < G; a++)
+    {
+        x = xg[a];
+        if (!((x <= p->lower[L + a] && eg[a] < 0) || (x >= p->upper[L + a] && eg[a] > 0)))
+            continue;
+        for (b = 0; b < G; b++)
+            v[a * G + b] = v[b * G + a] = 0;
+        v[a * G + a] = 1;
+        eg[a] = 0;
+        for (i = 0; i < p->n_points; i++)
+            for (b = 0; b < L; b++)
+                c[i * L * G + b * G + a] = 0;
+    }
+    for (i = 0; i < p->n_points; i++)
+    {
+        for (a = 0; a < L; a++)
+        {
+            x = xl[i * L + a];
+            if (!((x <= p->lower[a] && el[i * L + a] < 0) || (x >= p->upper[a] && el[i * L + a] > 0)))
+                continue;
+            for (b = 0; b < L; b++)
+                u[i * L * L + a * L + b] = u[i * L * L + b * L + a] = 0;
+            u[i * L * L + a * L + a] = 1;
+            for (b = 0; b < G; b++)
+                c[i * L * G + a * G + b] = 0;
+            el[i * L + a] = 0;
+        }
+    }
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  gf_fit
+ *  Description:  bounded Levenberg-Marquardt on the global problem.
+ *                x_local (L x n_points) and x_global (G) contain the start point on
+ *                input and the result on output; dx_* receive the half widths of
+ *                the 95% confidence intervals. Returns 1 on convergence (a step
+ *                changed chi2 by less than tol relative); a fit without any descent
+ *                step left is not converged but stalled (info->stalled).
+ * =====================================================================================
+ */
+int gf_fit(gf_problem *p, double *x_local, double *x_global, double *dx_local,
+        double *dx_global, int max_iter, double tol, gf_info *info)
+{
+    int L = p->n_local, G = p->n_global, N = p->n_points;
+    int i, a, b, k, n_data;
+    double t0, t1, t2;
+    double lambda = 1e-3, chi2, chi2_new, mse;
+    double *u, *c, *el, *work, *dl, *xl_new;
+    double v[GF_MAX_GLOBAL * GF_MAX_GLOBAL], eg[GF_MAX_GLOBAL];
+    double dg[GF_MAX_GLOBAL], xg_new[GF_MAX_GLOBAL];
+    double s_inv[GF_MAX_GLOBAL * GF_MAX_GLOBAL];
+    double ui[GF_MAX_LOCAL * GF_MAX_LOCAL], y[GF_MAX_LOCAL * GF_MAX_GLOBAL];
+
+    t0 = ls_now();
+    ls_count(LS_FIT, N, 0);
+    memset(info, 0, sizeof(gf_info));
+    u      = malloc(N * L * L * sizeof(double));
+    c      = malloc(N * L * G * sizeof(double));
+    el     = malloc(N * L * sizeof(double));
+    work   = malloc(N * L * L * sizeof(double));
+    dl     = malloc(N * L * sizeof(double));
+    xl_new = malloc(N * L * sizeof(double));
+    if (!u || !c || !el || !work || !dl || !xl_new)
+    {
+        free(u); free(c); free(el); free(work); free(dl); free(xl_new);
+        return 0;
+    }
+    for (i = 0; i < N; i++)
+        for (a = 0; a < L; a++)
+            x_local[i * L + a] = gf_clamp(x_local[i * L + a], p->lower[a], p->upper[a]);
+    for (a = 0; a < G; a++)
+        x_global[a] = gf_clamp(x_global[a], p->lower[L + a], p->upper[L + a]);
+    n_data = p->offset[N] - p->offset[0];
+    t1 = ls_now();
+
+    chi2 = gf_normal(p, x_local, x_global, u, c, v, el, eg);
+    gf_active_set(p, x_local, x_global, u, c, v, el, eg);
+    info->jevals++;
+    info->fevals++;
+    while (info->iterations < max_iter)
+    {
+        info->iterations++;
+        gf_step(p, u, c, v, el, eg, lambda, dl, dg, work, NULL);
+        /*  projected step */
+        for (i = 0; i < N * L; i++)
+            xl_new[i] = gf_clamp(x_local[i] + dl[i], p->lower[i % L], p->upper[i % L]);
+        for (a = 0; a < G; a++)
+            xg_new[a] = gf_clamp(x_global[a] + dg[a], p->lower[L + a], p->upper[L + a]);
+        chi2_new = gf_chi2(p, xl_new, xg_new);
+        info->fevals++;
+        if (chi2_new < chi2)
+        {
+            int small = fabs(chi2 - chi2_new) <= tol * chi2;
+            memcpy(x_local, xl_new, N * L * sizeof(double));
+            memcpy(x_global, xg_new, G * sizeof(double));
+            lambda = lambda > 1e-12 ? lambda / 10 : lambda;
+            chi2 = gf_normal(p, x_local, x_global, u, c, v, el, eg);
+            gf_active_set(p, x_local, x_global, u, c, v, el, eg);
+            info->jevals++;
+            info->fevals++;
+            if (small)
+            {
+                info->converged = 1;
+                break;
+            }
+        }
+        else
+        {
+            lambda *= 10;
+            if (lambda > 1e12)
+            {
+                /*  no descent step left: stalled, not converged */
+                info->stalled = 1;
+                break;
+            }
+        }
+    }
+    t2 = ls_now();
+
+    /*  errors: S^{-1} is the covariance block of the global parameters */
+    info->chi2 = chi2;
+    info->dof  = n_data - N * L - G;
+    mse = info->dof > 0 ? chi2 / info->dof : 1;
+    gf_normal(p, x_local, x_global, u, c, v, el, eg);
+    gf_step(p, u, c, v, el, eg, 0, dl, dg, work, s_inv);
+    for (a = 0; a < G; a++)
+        dx_global[a] = GF_CONF_95 * sqrt(fabs(s_inv[a * G + a]) * mse);
+    for (i = 0; i < N; i++)
+    {
+        /*  cov_l = U^{-1} + U^{-1} C S^{-1} C' U^{-1}, work holds chol(U) */
+        gf_cholesky_inverse(work + i * L * L, L, ui);
+        for (a = 0; a < L; a++)
+            for (b = 0; b < G; b++)
+            {
+                y[a * G + b] = 0;
+                for (k = 0; k < L; k++)
+                    y[a * G + b] += ui[a * L + k] * c[i * L * G + k * G + b];
+            }
+        for (a = 0; a < L; a++)
+        {
+            double var = ui[a * L + a];
+            for (b = 0; b < G; b++)
+                for (k = 0; k < G; k++)
+                    var += y[a * G + b] * s_inv[b * G + k] * y[a * G + k];
+            dx_local[i * L + a] = GF_CONF_95 * sqrt(fabs(var) * mse);
+        }
+    }
+    info->time_setup  = t1 - t0;
+    info->time_solve  = t2 - t1;
+    info->time_errors = ls_now() - t2;
+    if (ls_trace_on)
+    {
+        char arg[LS_TRACE_ARG];
+        snprintf(arg, sizeof(arg), "points=%d iterations=%d", N, info->iterations);
+        ls_trace_phase(LS_FIT, "gf_setup", t0, t1);
+        ls_trace_phase(LS_FIT, "gf_solve", t1, t2);
+        ls_trace_phase(LS_FIT, "gf_errors", t2, t2 + info->time_errors);
+        ls_trace_span(LS_FIT, "gf_fit", t0, t2 + info->time_errors, arg);
+    }
+
+    free(u); free(c); free(el); free(work); free(dl); free(xl_new);
+    return info->converged;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  gf_fit_each
+ *  Description:  gf_fit of every correlogram on its own (nothing shared): the global
+ *                parameters are per point, x_global and dx_global are G x n_points,
+ *                x_global holds the start point of every point on input. The points
+ *                are fitted in parallel. info sums the iterations, evaluations, chi2,
+ *                dof and times of all fits; converged and stalled count the points.
+ *                Returns 1 if every fit converged.
+ * =====================================================================================
+ */
+int gf_fit_each(const gf_problem *p, double *x_local, double *x_global, double *dx_local,
+        double *dx_global, int max_iter, double tol, gf_info *info)
+{
+    int L = p->n_local, G = p->n_global, N = p->n_points;
+    gf_info *each = malloc((N > 0 ? N : 1) * sizeof(gf_info));
+    int i;
+    double t0;
+
+    memset(info, 0, sizeof(gf_info));
+    if (!each)
+        return 0;
+    LS_SPAN_BEGIN(t0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (i = 0; i < N; i++)
+    {
+        gf_problem pi = *p;
+        /*  point i alone: its samples are offset[i] .. offset[i+1]-1 */
+        pi.n_points = 1;
+        pi.offset   = p->offset + i;
+        pi.q2       = p->q2 + i;
+        gf_fit(&pi, x_local + i * L, x_global + i * G, dx_local + i * L, dx_global + i * G,
+                max_iter, tol, &each[i]);
+    }
+    for (i = 0; i < N; i++)
+    {
+        info->iterations  += each[i].iterations;
+        info->fevals      += each[i].fevals;
+        info->jevals      += each[i].jevals;
+        info->converged   += each[i].converged;
+        info->stalled     += each[i].stalled;
+        info->chi2        += each[i].chi2;
+        info->dof         += each[i].dof;
+        info->time_setup  += each[i].time_setup;
+        info->time_solve  += each[i].time_solve;
+        info->time_errors += each[i].time_errors;
+    }
+    free(each);
+    LS_SPAN_END(t0, LS_FIT, "gf_fit_each", NULL);
+    return info->converged == N;
+}
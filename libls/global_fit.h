@@ -0,0 +1,75 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  global_fit.h
+ *
+ *    Description:  bounded Levenberg-Marquardt engine for the discrete models of
+ *                  fit_discrete, with parameters shared between correlograms
+ *                  (see global_fit.c). Part of libls, used by +DLS/@Sample/
+ *                  fit_global_fast.c and +DLS/bootstrap_fast.c.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#ifndef GLOBAL_FIT_H
+#define GLOBAL_FIT_H
+
+/*  maximal number of local / global parameters of a model */
+#define GF_MAX_LOCAL  3
+#define GF_MAX_GLOBAL 2
+/*  convert D [A^2/ns] and q^2 [A^-2] into Gamma [ms^-1] (same as Gf in fit_discrete) */
+#define GF_D_TO_GAMMA 1e6
+/*  half width of the 95% confidence interval in units of the standard error */
+#define GF_CONF_95    1.959963984540054
+
+/*  models, local parameters first, global parameters last */
+enum gf_model
+{
+    GF_SINGLE     = 0,  /* Ae * exp(-2 Gammae t)                            : Ae       | De      */
+    GF_DOUBLE     = 1,  /* (A1 exp(-Gamma1 t) + A2 exp(-Gamma2 t))^2        : A1 A2    | D1 D2   */
+    GF_DOUBLE_BKG = 2   /* (A1 exp(-Gamma1 t) + A2 exp(-Gamma2 t))^2 + b    : A1 A2 b  | D1 D2   */
+};
+
+typedef struct
+{
+    int           model;
+    int           n_local;      /* local parameters per correlogram */
+    int           n_global;     /* shared parameters */
+    int           n_points;     /* number of correlograms */
+    const double *t;            /* concatenated lag times [ms] */
+    const double *g;            /* concatenated correlation functions */
+    double       *w;            /* weights 1 / dg^2 */
+    const int    *offset;       /* point i owns samples offset[i] .. offset[i+1]-1 */
+    const double *q2;           /* q^2 of every point [A^-2] */
+    const double *lower;        /* bounds of the parameters (local | global) */
+    const double *upper;
+} gf_problem;
+
+typedef struct
+{
+    int    iterations;          /* LM iterations */
+    int    fevals;              /* evaluations of the residual */
+    int    jevals;              /* evaluations of the jacobian */
+    int    converged;           /* the relative change of chi2 fell below tol (gf_fit_each: points) */
+    int    stalled;             /* no descent step left (lambda > 1e12): not converged */
+    double chi2;
+    int    dof;
+    double time_setup;          /* [s] */
+    double time_solve;          /* [s] */
+    double time_errors;         /* [s] */
+} gf_info;
+
+int gf_model_size(int model, int *n_local, int *n_global);
+double gf_eval(int model, double t, double q2, const double *xl, const double *xg,
+        double *jl, double *jg);
+int gf_fit(gf_problem *p, double *x_local, double *x_global, double *dx_local,
+        double *dx_global, int max_iter, double tol, gf_info *info);
+int gf_fit_each(const gf_problem *p, double *x_local, double *x_global, double *dx_local,
+        double *dx_global, int max_iter, double tol, gf_info *info);
+
+#endif
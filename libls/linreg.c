@@ -0,0 +1,268 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  linreg.c
+ *
+ *    Description:  weighted linear least squares of many small groups of points,
+ *                  each fitted by the polynomial
+ *
+ *                      y = b0 + b1 x + ... + bd x^d      (b0 = 0 with origin)
+ *
+ *                  with weights 1 / dy^2 (1 without dy). As fit with
+ *                  'LinearLeastSquares' and confint: the covariance is the inverse
+ *                  of the normal matrix scaled by chi2 / dof, the errors are the half
+ *                  widths of the 95% intervals (Student's t). x is scaled to |x| <= 1
+ *                  for a well conditioned normal matrix (q^2 ~ 1e-6 A^-2).
+ *                  Points with a non-finite x, y or dy, or with dy <= 0, are skipped.
+ *                  lr_solve fits the same way a linear model of several variables
+ *                  (columns of regressors), e.g. Kc/R(q^2, c) of the Zimm plot.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "ls.h"
+
+/*  number of coefficients of the model, 0 if degree is out of range */
+int lr_n_par(int degree, int origin)
+{
+    if (degree < 1 || degree > LR_MAX_DEGREE)
+        return 0;
+    return origin ? degree : degree + 1;
+}
+
+static int lr_use(const double *x, const double *y, const double *dy, int k)
+{
+    return isfinite(x[k]) && isfinite(y[k]) && (!dy || (isfinite(dy[k]) && dy[k] > 0));
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  lr_fit
+ *  Description:  fit one group of n points. Returns 0 if the model is undetermined
+ *                (fewer points than coefficients, singular); the results are NaN.
+ * =====================================================================================
+ */
+int lr_fit(const double *x, const double *y, const double *dy, int n, int degree,
+        int origin, lr_result *res)
+{
+    double sw[2 * LR_MAX_DEGREE + 1], swy[LR_MAX_DEGREE + 1];
+    double nm[LR_MAX_PAR * LR_MAX_PAR], b[LR_MAX_PAR], sp[LR_MAX_PAR];
+    double scale = 0, xs, xp, w, r, mse, tq;
+    int i, j, k, np = lr_n_par(degree, origin), e0 = origin ? 1 : 0, m = 0;
+
+    res->n    = 0;
+    res->dof  = 0;
+    res->chi2 = NAN;
+    for (i = 0; i < LR_MAX_PAR; i++)
+        res->coeff[i] = res->error[i] = NAN;
+    for (i = 0; i < LR_MAX_PAR * LR_MAX_PAR; i++)
+        res->cov[i] = NAN;
+    if (np == 0)
+        return 0;
+    for (k = 0; k < n; k++)
+        if (lr_use(x, y, dy, k) && fabs(x[k]) > scale)
+            scale = fabs(x[k]);
+    if (scale == 0)
+        scale = 1;
+
+    /*  moments sum(w x^j), sum(w y x^j) of the scaled x */
+    memset(sw, 0, sizeof(sw));
+    memset(swy, 0, sizeof(swy));
+    for (k = 0; k < n; k++)
+    {
+        if (!lr_use(x, y, dy, k))
+            continue;
+        w  = dy ? 1 / (dy[k] * dy[k]) : 1;
+        xs = x[k] / scale;
+        xp = 1;
+        for (j = 0; j <= 2 * degree; j++)
+        {
+            sw[j] += w * xp;
+            if (j <= degree)
+                swy[j] += w * y[k] * xp;
+            xp *= xs;
+        }
+        m++;
+    }
+    res->n   = m;
+    res->dof = m - np;
+    if (m < np)
+        return 0;
+
+    for (i = 0; i < np; i++)
+        for (j = 0; j < np; j++)
+            nm[i * np + j] = sw[i + j + 2 * e0];
+    if (!cu_invert(nm, np))
+        return 0;
+    for (i = 0; i < np; i++)
+    {
+        b[i] = 0;
+        for (j = 0; j < np; j++)
+            b[i] += nm[i * np + j] * swy[j + e0];
+    }
+
+    /*  chi2 from the residuals (y'Wy - b'X'Wy cancels for exact data) */
+    res->chi2 = 0;
+    for (k = 0; k < n; k++)
+    {
+        if (!lr_use(x, y, dy, k))
+            continue;
+        xs = x[k] / scale;
+        xp = origin ? xs : 1;
+        r  = y[k];
+        for (i = 0; i < np; i++, xp *= xs)
+            r -= b[i] * xp;
+        res->chi2 += (dy ? r / dy[k] : r) * (dy ? r / dy[k] : r);
+    }
+    mse = res->dof > 0 ? res->chi2 / res->dof : NAN;
+    tq  = res->dof > 0 ? cu_student_t95(res->dof) : NAN;
+
+    /*  back to the unscaled x: b_i / scale^(i + e0) */
+    for (i = 0; i < np; i++)
+        sp[i] = pow(scale, i + e0);
+    for (i = 0; i < np; i++)
+    {
+        res->coeff[i] = b[i] / sp[i];
+        for (j = 0; j < np; j++)
+            res->cov[i * np + j] = nm[i * np + j] * mse / (sp[i] * sp[j]);
+        res->error[i] = tq * sqrt(fabs(res->cov[i * np + i]));
+    }
+    return 1;
+}
+
+static int lr_use_column(const double *const *col, int p, const double *y, const double *dy,
+        const unsigned char *mask, int k)
+{
+    int j;
+    if ((mask && !mask[k]) || !isfinite(y[k]) || (dy && !(isfinite(dy[k]) && dy[k] > 0)))
+        return 0;
+    for (j = 0; j < p; j++)
+        if (!isfinite(col[j][k]))
+            return 0;
+    return 1;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  lr_solve
+ *  Description:  weighted least squares y = sum_j b_j col_j of n points with p
+ *                regressors (p <= LR_MAX_PAR, a constant term is a column of ones).
+ *                Points with mask[k] == 0 are skipped (mask may be NULL). Every
+ *                column is scaled to |x| <= 1. Errors as lr_fit; returns 0 if
+ *                undetermined.
+ * =====================================================================================
+ */
+int lr_solve(const double *const *col, int p, const double *y, const double *dy,
+        const unsigned char *mask, int n, lr_result *res)
+{
+    double nm[LR_MAX_PAR * LR_MAX_PAR], rhs[LR_MAX_PAR], b[LR_MAX_PAR];
+    double scale[LR_MAX_PAR], xs[LR_MAX_PAR], w, r, mse, tq;
+    int i, j, k, m = 0;
+
+    res->n    = 0;
+    res->dof  = 0;
+    res->chi2 = NAN;
+    for (i = 0; i < LR_MAX_PAR; i++)
+        res->coeff[i] = res->error[i] = NAN;
+    for (i = 0; i < LR_MAX_PAR * LR_MAX_PAR; i++)
+        res->cov[i] = NAN;
+    if (p < 1 || p > LR_MAX_PAR)
+        return 0;
+    for (j = 0; j < p; j++)
+        scale[j] = 0;
+    for (k = 0; k < n; k++)
+        if (lr_use_column(col, p, y, dy, mask, k))
+            for (j = 0; j < p; j++)
+                if (fabs(col[j][k]) > scale[j])
+                    scale[j] = fabs(col[j][k]);
+    for (j = 0; j < p; j++)
+        if (scale[j] == 0)
+            scale[j] = 1;
+
+    memset(nm, 0, sizeof(nm));
+    memset(rhs, 0, sizeof(rhs));
+    for (k = 0; k < n; k++)
+    {
+        if (!lr_use_column(col, p, y, dy, mask, k))
+            continue;
+        w = dy ? 1 / (dy[k] * dy[k]) : 1;
+        for (i = 0; i < p; i++)
+            xs[i] = col[i][k] / scale[i];
+        for (i = 0; i < p; i++)
+        {
+            rhs[i] += w * y[k] * xs[i];
+            for (j = 0; j <= i; j++)
+                nm[i * p + j] += w * xs[i] * xs[j];
+        }
+        m++;
+    }
+    res->n   = m;
+    res->dof = m - p;
+    if (m < p)
+        return 0;
+    for (i = 0; i < p; i++)
+        for (j = i + 1; j < p; j++)
+            nm[i * p + j] = nm[j * p + i];
+    if (!cu_invert(nm, p))
+        return 0;
+    for (i = 0; i < p; i++)
+    {
+        b[i] = 0;
+        for (j = 0; j < p; j++)
+            b[i] += nm[i * p + j] * rhs[j];
+    }
+
+    res->chi2 = 0;
+    for (k = 0; k < n; k++)
+    {
+        if (!lr_use_column(col, p, y, dy, mask, k))
+            continue;
+        r = y[k];
+        for (i = 0; i < p; i++)
+            r -= b[i] * col[i][k] / scale[i];
+        if (dy)
+            r /= dy[k];
+        res->chi2 += r * r;
+    }
+    mse = res->dof > 0 ? res->chi2 / res->dof : NAN;
+    tq  = res->dof > 0 ? cu_student_t95(res->dof) : NAN;
+    for (i = 0; i < p; i++)
+    {
+        res->coeff[i] = b[i] / scale[i];
+        for (j = 0; j < p; j++)
+            res->cov[i * p + j] = nm[i * p + j] * mse / (scale[i] * scale[j]);
+        res->error[i] = tq * sqrt(fabs(res->cov[i * p + i]));
+    }
+    return 1;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  lr_batch
+ *  Description:  lr_fit of n_groups groups, group i is [offset[i], offset[i + 1]).
+ *                Returns the number of groups fitted.
+ * =====================================================================================
+ */
+int lr_batch(const double *x, const double *y, const double *dy, const int *offset,
+        int n_groups, int degree, int origin, lr_result *res)
+{
+    double t0;
+    int i, ok = 0;
+    LS_SPAN_BEGIN(t0);
+    ls_count(LS_LINREG, n_groups, 0);
+    for (i = 0; i < n_groups; i++)
+        ok += lr_fit(x + offset[i], y + offset[i], dy ? dy + offset[i] : NULL,
+                offset[i + 1] - offset[i], degree, origin, &res[i]);
+    LS_SPAN_END(t0, LS_LINREG, "lr_batch", NULL);
+    return ok;
+}
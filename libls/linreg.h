@@ -0,0 +1,43 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  linreg.h
+ *
+ *    Description:  batched weighted linear least squares of small polynomial models
+ *                  (Kc/R vs c, Gamma vs q^2, ...) and of small linear models of
+ *                  several variables (Zimm plot), see linreg.c. Part of libls, used by
+ *                  ../linreg_fast.c and zimm.c.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#ifndef LINREG_H
+#define LINREG_H
+
+#define LR_MAX_DEGREE 3
+#define LR_MAX_PAR    (LR_MAX_DEGREE + 1)
+
+typedef struct
+{
+    int    n;                               /* points used */
+    int    dof;                             /* n - parameters */
+    double chi2;
+    double coeff[LR_MAX_PAR];               /* of x^0 (not with origin), x^1, ... */
+    double error[LR_MAX_PAR];               /* half width of the 95% confidence interval */
+    double cov[LR_MAX_PAR * LR_MAX_PAR];    /* covariance, scaled by chi2 / dof */
+} lr_result;
+
+int lr_n_par(int degree, int origin);
+int lr_fit(const double *x, const double *y, const double *dy, int n, int degree,
+        int origin, lr_result *res);
+int lr_solve(const double *const *col, int p, const double *y, const double *dy,
+        const unsigned char *mask, int n, lr_result *res);
+int lr_batch(const double *x, const double *y, const double *dy, const int *offset,
+        int n_groups, int degree, int origin, lr_result *res);
+
+#endif
@@ -0,0 +1,193 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  ls.c
+ *
+ *    Description:  state of libls shared by all engines and MEX files (see ls.h):
+ *                    counters   calls, items and bytes of every engine
+ *                    scratch    raw data buffers of rs_read_file, grown on demand
+ *                               and kept between calls
+ *                    windows    the lag windows of the last lag grid: all files of
+ *                               an instrument share the grid, so the windows are
+ *                               found once per session instead of once per call
+ *                    ls_rng     the random streams of the bootstrap (bootstrap.c,
+ *                               contin.c): replicate b draws from stream b, so the
+ *                               result depends on the seed only, not on the threads
+ *                  ls_release frees the buffers and the cache of the .tol files
+ *                  (mexAtExit of the MEX files).
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "ls.h"
+
+static ls_counter ls_counter_table[LS_N_ENGINES];
+
+static const char *const ls_engine_names[LS_N_ENGINES] =
+{
+    "parse", "header", "static", "normalize", "datetime", "cumulants", "fit", "reduce",
+    "contin", "mex", "linreg", "zimm", "attenuator", "rebin", "watch", "bootstrap", "welford",
+    "robust"
+};
+
+static rs_file ls_scratch;
+static as_trace ls_scratch_cr;
+
+static struct
+{
+    double   *t;                /* last lag grid */
+    int       n;
+    double    limits[4];
+    rs_window w;
+} ls_grid;
+
+const char *ls_version(void)
+{
+    return LS_VERSION;
+}
+
+const char *ls_engine_name(int engine)
+{
+    return engine >= 0 && engine < LS_N_ENGINES ? ls_engine_names[engine] : "";
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  ls_count
+ *  Description:  add one call with items and bytes to the counter of engine. Atomic:
+ *                the bootstrap runs gf_fit in parallel.
+ * =====================================================================================
+ */
+void ls_count(int engine, long long items, long long bytes)
+{
+    ls_counter *c;
+    if (engine < 0 || engine >= LS_N_ENGINES)
+        return;
+    c = &ls_counter_table[engine];
+#if defined(__GNUC__)
+    __sync_fetch_and_add(&c->calls, 1);
+    __sync_fetch_and_add(&c->items, items);
+    __sync_fetch_and_add(&c->bytes, bytes);
+#else
+    c->calls++;
+    c->items += items;
+    c->bytes += bytes;
+#endif
+}
+
+/*  copy of the LS_N_ENGINES counters */
+void ls_counters(ls_counter *out)
+{
+    memcpy(out, ls_counter_table, sizeof(ls_counter_table));
+}
+
+void ls_counters_reset(void)
+{
+    memset(ls_counter_table, 0, sizeof(ls_counter_table));
+}
+
+static unsigned long long ls_splitmix64(unsigned long long *x)
+{
+    unsigned long long z = (*x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  ls_rng_seed
+ *  Description:  independent stream 'stream' of the seed (splitmix64 of both)
+ * =====================================================================================
+ */
+void ls_rng_seed(ls_rng *r, unsigned long long seed, unsigned long long stream)
+{
+    unsigned long long x = seed ^ (stream * 0xD1B54A32D192ED03ULL);
+    int i;
+    for (i = 0; i < 4; i++)
+        r->s[i] = ls_splitmix64(&x);
+}
+
+static unsigned long long ls_rotl(unsigned long long x, int k)
+{
+    return (x << k) | (x >> (64 - k));
+}
+
+/*  xoshiro256** */
+unsigned long long ls_rng_next(ls_rng *r)
+{
+    unsigned long long *s = r->s;
+    unsigned long long result = ls_rotl(s[1] * 5, 7) * 9;
+    unsigned long long t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = ls_rotl(s[3], 45);
+    return result;
+}
+
+/*  uniform integer in [0, n) */
+int ls_rng_int(ls_rng *r, int n)
+{
+    return (int) ((ls_rng_next(r) >> 11) * (1.0 / 9007199254740992.0) * n);
+}
+
+/*  scratch of rs_read_file, owned by the library */
+rs_file *ls_scratch_file(void)
+{
+    return &ls_scratch;
+}
+
+/*  scratch of the count rate trace of as_read_file */
+as_trace *ls_scratch_trace(void)
+{
+    return &ls_scratch_cr;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  ls_windows_cached
+ *  Description:  rs_windows, but the result for the last grid and limits is kept.
+ *                Returns 0 if the grid is not ascending.
+ * =====================================================================================
+ */
+int ls_windows_cached(const double *t, int n, const double *limits, rs_window *w)
+{
+    double *grid;
+    if (ls_grid.t && n == ls_grid.n && memcmp(limits, ls_grid.limits, 4 * sizeof(double)) == 0
+            && memcmp(t, ls_grid.t, n * sizeof(double)) == 0)
+    {
+        *w = ls_grid.w;
+        return 1;
+    }
+    if (!rs_windows(t, n, limits, w))
+        return 0;
+    /*  no cache if out of memory, the windows are still valid */
+    if (!(grid = realloc(ls_grid.t, (n > 0 ? n : 1) * sizeof(double))))
+        return 1;
+    memcpy(grid, t, n * sizeof(double));
+    memcpy(ls_grid.limits, limits, 4 * sizeof(double));
+    ls_grid.t = grid;
+    ls_grid.n = n;
+    ls_grid.w = *w;
+    return 1;
+}
+
+void ls_release(void)
+{
+    rs_free(&ls_scratch);
+    as_free_trace(&ls_scratch_cr);
+    free(ls_grid.t);
+    memset(&ls_grid, 0, sizeof(ls_grid));
+    tol_clear_cache();
+}
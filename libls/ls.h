@@ -0,0 +1,117 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  ls.h
+ *
+ *    Description:  C API of libls, the native core shared by the MEX files and the
+ *                  command line tools (bench/ls_bench):
+ *                    alv_autosave.h     readers of the ALV autosave files (rs_, rh_, st_)
+ *                    alv_static.h       .tol and .sta files of the ALV software (tol_, sta_)
+ *                    malvern.h          export tables of the Malvern Zetasizer (mv_)
+ *                    watch.h            files of a directory once written (wd_)
+ *                    datetime_parse.h   date / time strings -> serial date numbers (dt_)
+ *                    cumulants.h        closed-form cumulant analysis (cu_)
+ *                    global_fit.h       shared-parameter Levenberg-Marquardt (gf_)
+ *                    reduce_angles.h    static light scattering reduction (sr_)
+ *                    welford.h          streaming statistics of the counts, per angle (wf_, wa_)
+ *                    linreg.h           batched weighted linear least squares (lr_)
+ *                    zimm.h             Zimm / Berry / Guinier double extrapolation (zb_)
+ *                    attenuator.h       attenuator of the static points, Kc/R correction (at_)
+ *                    rebin.h            log-spaced rebinning of correlograms (rb_)
+ *                    bootstrap.h        bootstrap / jackknife of the discrete fits (bs_)
+ *                    robust.h           outlier rejection of the counts, per angle (ro_)
+ *                    contin.h           CONTIN inversion (needs gsl / ool, LS_WITH_CONTIN)
+ *                  and the state shared by all of them (ls.c): engine counters, the
+ *                  scratch buffers of the readers and the cache of the lag windows,
+ *                  the random streams of the resampling engines (ls_rng) and the
+ *                  spans of the engines (trace.h).
+ *                  The MEX files link the shared library (libls.so), so this state
+ *                  lives once per matlab session. Not thread safe except ls_count:
+ *                  matlab calls the MEX files from one thread.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#ifndef LS_H
+#define LS_H
+
+#include "alv_autosave.h"
+#include "alv_static.h"
+#include "malvern.h"
+#include "watch.h"
+#include "datetime_parse.h"
+#include "cumulants.h"
+#include "global_fit.h"
+#include "reduce_angles.h"
+#include "linreg.h"
+#include "zimm.h"
+#include "attenuator.h"
+#include "rebin.h"
+#include "bootstrap.h"
+#include "robust.h"
+#include "trace.h"
+#ifdef LS_WITH_CONTIN
+#include "contin.h"
+#endif
+
+#define LS_VERSION "1.0.0"
+
+/*  engines with counters */
+enum ls_engine
+{
+    LS_PARSE     = 0,   /* rs_read_file, mv_read */
+    LS_HEADER    = 1,   /* rh_read_header */
+    LS_STATIC    = 2,   /* st_read_file, tol_cached, sta_read */
+    LS_NORMALIZE = 3,   /* rs_normalize */
+    LS_DATETIME  = 4,   /* dt_parse */
+    LS_CUMULANTS = 5,   /* cu_cumulants */
+    LS_FIT       = 6,   /* gf_fit */
+    LS_REDUCE    = 7,   /* sr_reduce */
+    LS_CONTIN    = 8,   /* contin */
+    LS_MEX       = 9,   /* whole MEX calls (spans only) */
+    LS_LINREG    = 10,  /* lr_batch */
+    LS_ZIMM      = 11,  /* zb_fit */
+    LS_ATTENUATOR = 12, /* at_correct */
+    LS_REBIN     = 13,  /* rb_batch */
+    LS_WATCH     = 14,  /* wd_poll (files returned) */
+    LS_BOOTSTRAP = 15,  /* bs_resample (replicates) */
+    LS_WELFORD   = 16,  /* wa_add (counts), wa_merge (angles) */
+    LS_ROBUST    = 17,  /* ro_reject (counts) */
+    LS_N_ENGINES = 18
+};
+
+typedef struct
+{
+    long long calls;
+    long long items;            /* files, correlograms, counts ... */
+    long long bytes;            /* read from disk */
+} ls_counter;
+
+const char *ls_version(void);
+const char *ls_engine_name(int engine);
+
+void ls_count(int engine, long long items, long long bytes);
+void ls_counters(ls_counter *out);
+void ls_counters_reset(void);
+
+/*  random stream: xoshiro256**, seeded with splitmix64 of (seed, stream) */
+typedef struct
+{
+    unsigned long long s[4];
+} ls_rng;
+
+void ls_rng_seed(ls_rng *r, unsigned long long seed, unsigned long long stream);
+unsigned long long ls_rng_next(ls_rng *r);
+int  ls_rng_int(ls_rng *r, int n);
+
+rs_file *ls_scratch_file(void);
+as_trace *ls_scratch_trace(void);
+int  ls_windows_cached(const double *t, int n, const double *limits, rs_window *w);
+void ls_release(void);
+
+#endif
@@ -0,0 +1,84 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  ls_mex.c
+ *
+ *    Description:  helpers of the MEX shims of libls, see ls_mex.h
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "ls_mex.h"
+
+void ls_mex_init(void)
+{
+    mexAtExit(ls_release);
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  dt_formats_from_matlab
+ *  Description:  format list (mxMalloc): the user formats of the registry first, so
+ *                they win over ambiguous builtin ones, then the builtin formats.
+ *                Returns the number of formats.
+ * =====================================================================================
+ */
+int dt_formats_from_matlab(const mxArray *user, char ***formats)
+{
+    int i, n_user = 0;
+    if (user && mxIsCell(user))
+        n_user = (int) mxGetNumberOfElements(user);
+    *formats = mxMalloc((n_user + DT_N_BUILTIN) * sizeof(char *));
+    for (i = 0; i < n_user; i++)
+    {
+        (*formats)[i] = mxArrayToString(mxGetCell(user, i));
+        if (!(*formats)[i])
+            mexErrMsgTxt("datetime formats must be strings");
+    }
+    for (i = 0; i < DT_N_BUILTIN; i++)
+    {
+        (*formats)[n_user + i] = mxMalloc(strlen(dt_builtin_formats[i]) + 1);
+        strcpy((*formats)[n_user + i], dt_builtin_formats[i]);
+    }
+    return n_user + DT_N_BUILTIN;
+}
+
+void dt_free_formats(char **formats, int n_formats)
+{
+    int i;
+    for (i = 0; i < n_formats; i++)
+        mxFree(formats[i]);
+    mxFree(formats);
+}
+
+int rs_select_from_matlab(const mxArray *a)
+{
+    char *name;
+    int select = 0;
+    if (!a || mxIsEmpty(a))
+        return 1;
+    if (mxIsChar(a))
+    {
+        name = mxArrayToString(a);
+        if (strcmp(name, "weighted") == 0)
+            select = RS_CH_WEIGHTED;
+        else if (strcmp(name, "best") == 0)
+            select = RS_CH_BEST;
+        else if (strcmp(name, "all") == 0)
+            select = RS_CH_ALL;
+        mxFree(name);
+    }
+    else if (mxIsNumeric(a))
+        select = (int) mxGetScalar(a);
+    if (select == 0 || select > RS_MAX_CHANNELS || select < RS_CH_ALL)
+        mexErrMsgTxt("channels: a channel number (1 to 4), 'weighted', 'all' or 'best'");
+    return select;
+}
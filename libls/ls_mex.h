@@ -0,0 +1,34 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  ls_mex.h
+ *
+ *    Description:  helpers of the MEX shims of libls (ls_mex.c): compiled into every
+ *                  MEX file with mex, not part of the library (needs mex.h).
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#ifndef LS_MEX_H
+#define LS_MEX_H
+
+#include "mex.h"
+#include "ls.h"
+
+/*  free the shared buffers of libls when the MEX file is cleared */
+void ls_mex_init(void);
+
+/*  user formats (cell array of strings, may be NULL) followed by the builtin ones */
+int  dt_formats_from_matlab(const mxArray *user, char ***formats);
+void dt_free_formats(char **formats, int n_formats);
+
+/*  channel selection of rs_combine: a channel number, 'weighted', 'all' or 'best' (NULL or
+ *  empty: 1, the first channel) */
+int  rs_select_from_matlab(const mxArray *a);
+
+#endif
@@ -0,0 +1,271 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  malvern.c
+ *
+ *    Description:  read the tab separated export tables of the Malvern Zetasizer
+ *                  software in one streaming pass. A table is a header line followed
+ *                  by data lines; a file may hold several tables with different
+ *                  columns. Columns are found by name:
+ *                    Correlation Delay Times[k] (us) : lag times
+ *                    Correlation Data[k]             : correlation function
+ *                    Sample Name, Measurement Date and Time, Temperature (C), Angle
+ *                  Numbers may use decimal commas (localized exports). Only data lines
+ *                  with both lag times and correlation data are returned, one column
+ *                  per record, the lag times in ms as the ALV loaders.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "ls.h"
+
+#define MV_TAU_COLUMN    "Correlation Delay Times["
+#define MV_G_COLUMN      "Correlation Data["
+
+/*  meaning of a column of the current table */
+enum { MV_OTHER, MV_TAU, MV_G, MV_NAME, MV_DATETIME, MV_TEMPERATURE, MV_ANGLE };
+
+typedef struct
+{
+    int kind;
+    int k;                      /* 0-based channel of MV_TAU / MV_G columns */
+} mv_column;
+
+typedef struct
+{
+    int        n_columns, n_channels, has_g;
+    mv_column *column;
+} mv_table;
+
+/*  number in a field, decimal comma or point; NaN if empty or not a number */
+static double mv_number(const char *s, int n)
+{
+    char buf[64], *end;
+    double x;
+    int i;
+    if (n <= 0 || n >= (int) sizeof(buf))
+        return NAN;
+    for (i = 0; i < n; i++)
+        buf[i] = s[i] == ',' ? '.' : s[i];
+    buf[n] = '\0';
+    x = strtod(buf, &end);
+    return end == buf ? NAN : x;
+}
+
+/*  line of arbitrary length (the tables are very wide), NULL at end of file */
+static char *mv_getline(FILE *fp, char **line, size_t *capacity)
+{
+    size_t n = 0;
+    char *tmp;
+    if (*capacity == 0)
+    {
+        *capacity = 16384;
+        if (!(*line = malloc(*capacity)))
+            return NULL;
+    }
+    while (fgets(*line + n, (int) (*capacity - n), fp))
+    {
+        n += strlen(*line + n);
+        if (n > 0 && (*line)[n - 1] == '\n')
+            break;
+        if (n + 1 < *capacity)
+            break;              /* last line without newline */
+        if (!(tmp = realloc(*line, 2 * *capacity)))
+            return NULL;
+        *line = tmp;
+        *capacity *= 2;
+    }
+    if (n == 0)
+        return NULL;
+    while (n > 0 && ((*line)[n - 1] == '\n' || (*line)[n - 1] == '\r'))
+        (*line)[--n] = '\0';
+    return *line;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  mv_header
+ *  Description:  parse a header line into table. Returns 0 if the line is no header
+ *                (no lag time column) or out of memory.
+ * =====================================================================================
+ */
+static int mv_header(const char *line, mv_table *table)
+{
+    const char *s = line, *e;
+    mv_column *c;
+    int n = 1, i;
+
+    if (!strstr(line, MV_TAU_COLUMN))
+        return 0;
+    for (e = line; *e; e++)
+        n += *e == '\t';
+    if (!(c = realloc(table->column, n * sizeof(mv_column))))
+        return 0;
+    table->column     = c;
+    table->n_columns  = n;
+    table->n_channels = 0;
+    table->has_g      = 0;
+    for (i = 0; i < n; i++, s = e + 1)
+    {
+        for (e = s; *e && *e != '\t'; e++);
+        c[i].kind = MV_OTHER;
+        c[i].k    = 0;
+        if (strncmp(s, MV_TAU_COLUMN, strlen(MV_TAU_COLUMN)) == 0)
+        {
+            c[i].kind = MV_TAU;
+            c[i].k    = atoi(s + strlen(MV_TAU_COLUMN)) - 1;
+        }
+        else if (strncmp(s, MV_G_COLUMN, strlen(MV_G_COLUMN)) == 0)
+        {
+            c[i].kind = MV_G;
+            c[i].k    = atoi(s + strlen(MV_G_COLUMN)) - 1;
+            table->has_g = 1;
+        }
+        else if (strncmp(s, "Sample Name", 11) == 0)
+            c[i].kind = MV_NAME;
+        else if (strncmp(s, "Measurement Date and Time", 25) == 0)
+            c[i].kind = MV_DATETIME;
+        else if (strncmp(s, "Temperature", 11) == 0)
+            c[i].kind = MV_TEMPERATURE;
+        else if (strncmp(s, "Angle", 5) == 0 || strncmp(s, "Detector Angle", 14) == 0)
+            c[i].kind = MV_ANGLE;
+        if (c[i].k < 0)
+            c[i].kind = MV_OTHER;
+        if ((c[i].kind == MV_TAU || c[i].kind == MV_G) && c[i].k + 1 > table->n_channels)
+            table->n_channels = c[i].k + 1;
+        if (!*e)
+            break;
+    }
+    return 1;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  mv_row
+ *  Description:  parse a data line of table into a new record. Returns 0 if out of
+ *                memory.
+ * =====================================================================================
+ */
+static int mv_row(const char *line, const mv_table *table, mv_records *out)
+{
+    const char *s = line, *e;
+    mv_record *r;
+    int i, j, n;
+
+    if (out->n == out->capacity)
+    {
+        int capacity = out->capacity > 0 ? 2 * out->capacity : 16;
+        if (!(r = realloc(out->r, capacity * sizeof(mv_record))))
+            return 0;
+        out->r = r;
+        out->capacity = capacity;
+    }
+    r = &out->r[out->n];
+    memset(r, 0, sizeof(mv_record));
+    r->n_channels = table->n_channels;
+    r->tau = malloc(table->n_channels * sizeof(double));
+    r->g   = malloc(table->n_channels * sizeof(double));
+    if (!r->tau || !r->g)
+    {
+        free(r->tau); free(r->g);
+        return 0;
+    }
+    for (j = 0; j < table->n_channels; j++)
+        r->tau[j] = r->g[j] = NAN;
+    r->T = r->angle = NAN;
+    for (i = 0; i < table->n_columns; i++, s = e + 1)
+    {
+        for (e = s; *e && *e != '\t'; e++);
+        n = (int) (e - s);
+        switch (table->column[i].kind)
+        {
+            case MV_TAU:
+                r->tau[table->column[i].k] = 1e-3 * mv_number(s, n);    /* us -> ms */
+                break;
+            case MV_G:
+                r->g[table->column[i].k] = mv_number(s, n);
+                break;
+            case MV_TEMPERATURE:
+                r->T = mv_number(s, n) + 273.15;                        /* C -> K */
+                break;
+            case MV_ANGLE:
+                r->angle = mv_number(s, n);
+                break;
+            case MV_NAME:
+            case MV_DATETIME:
+                if (n >= MV_FIELD_LENGTH)
+                    n = MV_FIELD_LENGTH - 1;
+                memcpy(table->column[i].kind == MV_NAME ? r->name : r->datetime, s, n);
+                break;
+        }
+        if (!*e)
+            break;
+    }
+    /*  keep only lines with a correlogram (not free text between the tables) */
+    for (j = 0; j < r->n_channels && isnan(r->g[j]); j++);
+    if (j == r->n_channels)
+    {
+        free(r->tau); free(r->g);
+        return 1;
+    }
+    out->n++;
+    return 1;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  mv_read
+ *  Description:  read all correlograms of the export at path. Returns 0 if the file
+ *                cannot be read or out of memory.
+ * =====================================================================================
+ */
+int mv_read(const char *path, mv_records *out)
+{
+    FILE *fp = fopen(path, "r");
+    mv_table table = { 0, 0, 0, NULL };
+    char *line = NULL;
+    size_t capacity = 0;
+    int in_table = 0, ok = 1;
+    double t0;
+
+    LS_SPAN_BEGIN(t0);
+    memset(out, 0, sizeof(mv_records));
+    if (!fp)
+        return 0;
+    while (ok && mv_getline(fp, &line, &capacity))
+    {
+        if (mv_header(line, &table))
+            in_table = 1;
+        else if (in_table && table.has_g && line[0] != '\0')
+            ok = mv_row(line, &table, out);
+    }
+    free(line);
+    free(table.column);
+    out->bytes = ftell(fp);
+    fclose(fp);
+    ls_count(LS_PARSE, out->n, out->bytes);
+    LS_SPAN_END(t0, LS_PARSE, "mv_read", path);
+    return ok;
+}
+
+void mv_free(mv_records *out)
+{
+    int i;
+    for (i = 0; i < out->n; i++)
+    {
+        free(out->r[i].tau);
+        free(out->r[i].g);
+    }
+    free(out->r);
+    memset(out, 0, sizeof(mv_records));
+}
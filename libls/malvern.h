@@ -0,0 +1,40 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  malvern.h
+ *
+ *    Description:  export tables of the Malvern Zetasizer software (mv_), see malvern.c.
+ *                  Part of libls, used by ../+Instruments/@Malvern/read_malvern_fast.c.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#ifndef MALVERN_H
+#define MALVERN_H
+
+#define MV_FIELD_LENGTH  256
+
+typedef struct
+{
+    int     n_channels;
+    double *tau, *g;            /* [ms], raw correlation function */
+    double  T, angle;           /* [K], [deg]: NaN if not exported */
+    char    name[MV_FIELD_LENGTH], datetime[MV_FIELD_LENGTH];
+} mv_record;
+
+typedef struct
+{
+    int        n, capacity;
+    mv_record *r;
+    long       bytes;           /* read from the file */
+} mv_records;
+
+int  mv_read(const char *path, mv_records *out);
+void mv_free(mv_records *out);
+
+#endif
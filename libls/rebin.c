@@ -0,0 +1,121 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  rebin.c
+ *
+ *    Description:  the multi-tau lags of the ALV correlator get denser on a log scale
+ *                  towards long times (~25 lags per decade): CONTIN and the fits only
+ *                  need a few well determined points per decade. rb_rebin averages
+ *                  the lags into bins of width 1 / per_decade decades, anchored to
+ *                  the decades (bin b holds 10^(b / per_decade) <= t < 10^((b + 1) /
+ *                  per_decade)), so the grids of all correlograms coincide:
+ *
+ *                      w = 1 / dg^2,   g_b = sum(w g) / sum(w),   dg_b = 1 / sqrt(sum(w))
+ *
+ *                  and t_b is the weighted geometric mean of the lags of the bin.
+ *                  The errors of the lags are taken as independent. Without dg the
+ *                  weights are 1 (dg_b = 1 / sqrt(m)). Lags with t <= 0 or with a
+ *                  non-finite g, dg or dg <= 0 are skipped; empty bins are not written.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "ls.h"
+
+static int rb_use(const double *t, const double *g, const double *dg, int k)
+{
+    return t[k] > 0 && isfinite(t[k]) && isfinite(g[k]) && (!dg || (isfinite(dg[k]) && dg[k] > 0));
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  rb_rebin
+ *  Description:  rebin one correlogram of n lags (t ascending) into tr, gr, dgr (at
+ *                most n points). per_decade <= 0: the usable lags are copied as
+ *                they are. Returns the number of points written.
+ * =====================================================================================
+ */
+int rb_rebin(const double *t, const double *g, const double *dg, int n, double per_decade,
+        double *tr, double *gr, double *dgr)
+{
+    double w, sw = 0, swg = 0, swt = 0;
+    long bin, last = 0;
+    int k, m = 0, in = 0;
+
+    for (k = 0; k < n; k++)
+    {
+        if (!rb_use(t, g, dg, k))
+            continue;
+        w = dg ? 1 / (dg[k] * dg[k]) : 1;
+        if (!(per_decade > 0))
+        {
+            tr[m]  = t[k];
+            gr[m]  = g[k];
+            dgr[m] = dg ? dg[k] : 1;
+            m++;
+            continue;
+        }
+        bin = (long) floor(log10(t[k]) * per_decade);
+        if (in && bin != last)
+        {
+            tr[m]  = exp(swt / sw);
+            gr[m]  = swg / sw;
+            dgr[m] = 1 / sqrt(sw);
+            m++;
+            sw = swg = swt = 0;
+        }
+        sw  += w;
+        swg += w * g[k];
+        swt += w * log(t[k]);
+        last = bin;
+        in   = 1;
+    }
+    if (in && per_decade > 0)
+    {
+        tr[m]  = exp(swt / sw);
+        gr[m]  = swg / sw;
+        dgr[m] = 1 / sqrt(sw);
+        m++;
+    }
+    return m;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  rb_batch
+ *  Description:  rb_rebin of n_groups correlograms, group i is [offset[i], offset[i + 1]).
+ *                per_decade: one value for all groups (n_per_decade = 1) or one per
+ *                group. The groups are written one after the other (at most
+ *                offset[n_groups] points), offset_out (n_groups + 1) holds their
+ *                start indices. Returns the number of points written.
+ * =====================================================================================
+ */
+int rb_batch(const double *t, const double *g, const double *dg, const int *offset,
+        int n_groups, const double *per_decade, int n_per_decade, double *tr, double *gr,
+        double *dgr, int *offset_out)
+{
+    double t0;
+    int i, m = 0;
+    LS_SPAN_BEGIN(t0);
+    ls_count(LS_REBIN, n_groups, 0);
+    for (i = 0; i < n_groups; i++)
+    {
+        offset_out[i] = m;
+        m += rb_rebin(t + offset[i], g + offset[i], dg ? dg + offset[i] : NULL,
+                offset[i + 1] - offset[i], per_decade[n_per_decade > 1 ? i : 0],
+                tr + m, gr + m, dgr + m);
+    }
+    offset_out[n_groups] = m;
+    LS_SPAN_END(t0, LS_REBIN, "rb_batch", NULL);
+    return m;
+}
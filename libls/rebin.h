@@ -0,0 +1,26 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  rebin.h
+ *
+ *    Description:  log-spaced rebinning of correlograms with propagated errors, see
+ *                  rebin.c. Part of libls, used by ../+DLS/rebin_fast.c.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#ifndef REBIN_H
+#define REBIN_H
+
+int rb_rebin(const double *t, const double *g, const double *dg, int n, double per_decade,
+        double *tr, double *gr, double *dgr);
+int rb_batch(const double *t, const double *g, const double *dg, const int *offset,
+        int n_groups, const double *per_decade, int n_per_decade, double *tr, double *gr,
+        double *dgr, int *offset_out);
+
+#endif
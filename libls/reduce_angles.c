@@ -0,0 +1,163 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  reduce_angles.c
+ *
+ *    Description:  reduction of the static light scattering counts of a sample:
+ *                  the counts are sorted by angle and bucketed in one scan (angle
+ *                  within tolerance of the first angle of the bucket), then for every
+ *                  angle the mean and standard deviation of count rate and monitor
+ *                  intensity (Welford, welford.h), the mean temperature, the ratio R
+ *                  of the solution and Kc/R with its error are computed, as
+ *                  SLS.AngleData.calc_mean, calc_kc_over_r and R_error_propagation.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "ls.h"
+
+/*  sort key: angle, ties in input order */
+typedef struct
+{
+    double angle;
+    int    k;
+} sr_key;
+
+static int sr_compare(const void *a, const void *b)
+{
+    const sr_key *x = a, *y = b;
+    if (x->angle != y->angle)
+        return x->angle < y->angle ? -1 : 1;
+    return x->k - y->k;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  sr_table_index
+ *  Description:  row of the table at angle a: the exact match (within 1e-5 deg) or
+ *                the nearest angle (as calc_kc_over_r)
+ * =====================================================================================
+ */
+static int sr_table_index(const sr_table *tab, double a)
+{
+    int i, best = 0;
+    for (i = 0; i < tab->n; i++)
+    {
+        if (fabs(tab->angle[i] - a) < SR_TABLE_TOLERANCE)
+            return i;
+        if (fabs(tab->angle[i] - a) < fabs(tab->angle[best] - a))
+            best = i;
+    }
+    return best;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  sr_kc_over_r
+ *  Description:  R of the solution, Kc/R and the error (R_error_propagation) of one
+ *                angle whose means are already set
+ * =====================================================================================
+ */
+static void sr_kc_over_r(sr_angle *a, const sr_table *standard, const sr_table *solvent,
+        double K, double conc)
+{
+    int    i = sr_table_index(standard, a->angle);
+    double s = sin(a->angle * M_PI / 180);
+    double R_tol, dR_tol, R_solv, dR_solv, RR, R, dR, d;
+
+    /*  the solvent table is indexed as the standard table (as calc_kc_over_r) */
+    R_tol   = standard->ratio[i];
+    dR_tol  = standard->error_ratio[i] * R_tol / 100;
+    R_solv  = i < solvent->n ? solvent->ratio[i] : NAN;
+    dR_solv = i < solvent->n ? solvent->error_ratio[i] * R_solv / 100 : NAN;
+    RR      = standard->rayleigh_ratio[i];
+
+    a->R = a->cr * s / a->imon;
+    a->dR_solution = sqrt(pow(a->dcr / a->imon, 2)
+            + pow(a->cr * a->dimon / (a->imon * a->imon), 2)) * s;
+    R  = (a->R - R_solv) / R_tol * RR;
+    d  = a->R - R_solv;
+    dR = sqrt(pow(dR_tol / d, 2) + pow(R_tol * dR_solv / (d * d), 2)
+            + pow(R_tol * a->dR_solution / (d * d), 2)) / RR;
+    a->KcR  = K * conc / R;
+    a->dKcR = K * conc * dR;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  sr_reduce
+ *  Description:  reduce n counts (angle, count rate, monitor intensity, temperature)
+ *                to one sr_angle per angle (ascending). group[k] receives the 0-based
+ *                angle of count k. Returns the number of angles, -1 if out of memory.
+ *                K: optical constant [mol cm^2 g^-2], conc: concentration [g/ml]
+ * =====================================================================================
+ */
+int sr_reduce(int n, const double *angle, const double *cr, const double *imon,
+        const double *T, const sr_table *standard, const sr_table *solvent, double K,
+        double conc, double tolerance, sr_angle *out, int *group)
+{
+    sr_key *key = malloc((n > 0 ? n : 1) * sizeof(sr_key));
+    int *order = malloc((n > 0 ? n : 1) * sizeof(int));
+    int i, j, k, s, n_angles = 0;
+    double x[WF_N], t0;
+    wf_state acc;
+
+    LS_SPAN_BEGIN(t0);
+    if (!key || !order)
+    {
+        free(key); free(order);
+        return -1;
+    }
+    for (k = 0; k < n; k++)
+    {
+        key[k].angle = angle[k];
+        key[k].k     = k;
+    }
+    qsort(key, n, sizeof(sr_key), sr_compare);
+    for (k = 0; k < n; k++)
+        order[k] = key[k].k;
+    free(key);
+
+    for (s = 0; s < n; s = j)
+    {
+        /*  bucket: all counts within tolerance of the first angle */
+        for (j = s + 1; j < n && fabs(angle[order[j]] - angle[order[s]]) < tolerance; j++);
+        wf_init(&acc);
+        for (i = s; i < j; i++)
+        {
+            k = order[i];
+            x[WF_CR]   = cr[k];
+            x[WF_IMON] = imon[k];
+            x[WF_T]    = T[k];
+            wf_add(&acc, x);
+            group[k]   = n_angles;
+        }
+        out[n_angles].angle = angle[order[s]];
+        out[n_angles].n     = j - s;
+        out[n_angles].cr    = acc.mean[WF_CR];
+        out[n_angles].dcr   = wf_std(&acc, WF_CR);
+        out[n_angles].imon  = acc.mean[WF_IMON] < 0 ? 1 : acc.mean[WF_IMON];
+        out[n_angles].dimon = wf_std(&acc, WF_IMON);
+        out[n_angles].T     = acc.mean[WF_T];
+        if (standard && solvent && standard->n > 0)
+            sr_kc_over_r(&out[n_angles], standard, solvent, K, conc);
+        else
+            out[n_angles].R = out[n_angles].dR_solution = out[n_angles].KcR
+                = out[n_angles].dKcR = NAN;
+        n_angles++;
+    }
+    free(order);
+    ls_count(LS_REDUCE, n, 0);
+    LS_SPAN_END(t0, LS_REDUCE, "sr_reduce", NULL);
+    return n_angles;
+}
@@ -0,0 +1,49 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  reduce_angles.h
+ *
+ *    Description:  reduction of the static light scattering counts of a sample, see
+ *                  reduce_angles.c. Part of libls, used by +SLS/reduce_angles_fast.c.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#ifndef REDUCE_ANGLES_H
+#define REDUCE_ANGLES_H
+
+#include "welford.h"
+
+/*  tolerance to find the angle of a count in the standard / solvent table */
+#define SR_TABLE_TOLERANCE 1e-5
+
+typedef struct
+{
+    int           n;            /* rows */
+    const double *angle;        /* scatt_angle [deg] */
+    const double *ratio;
+    const double *error_ratio;  /* [%] */
+    const double *rayleigh_ratio;
+} sr_table;
+
+typedef struct
+{
+    double angle;
+    int    n;                   /* counts at this angle */
+    double cr, dcr;             /* mean count rate, standard deviation */
+    double imon, dimon;         /* mean monitor intensity, standard deviation */
+    double T;                   /* mean temperature */
+    double R, dR_solution;      /* ratio of the solution and its error */
+    double KcR, dKcR;
+} sr_angle;
+
+int sr_reduce(int n, const double *angle, const double *cr, const double *imon,
+        const double *T, const sr_table *standard, const sr_table *solvent, double K,
+        double conc, double tolerance, sr_angle *out, int *group);
+
+#endif
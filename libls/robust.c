@@ -0,0 +1,277 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  robust.c
+ *
+ *    Description:  outlier rejection of the static counts of a sample, angle by angle
+ *                  (e.g. dust spikes in the count rate). Policies:
+ *                    mad    : reject |x - median| > k * 1.4826 * MAD
+ *                    sigma  : iterative sigma clipping, |x - mean| > k * std
+ *                    hampel : moving window (half width w, acquisition order) median
+ *                             and MAD, |x - median_w| > k * 1.4826 * MAD_w
+ *                  Counts are bucketed by angle with a counting sort, medians are found
+ *                  by quickselect, so the cost is linear in the number of counts
+ *                  (O(n w) for hampel). At least RO_MIN_COUNTS counts (of the angle,
+ *                  of the window for hampel) are needed to reject any: the median and
+ *                  MAD of fewer counts are too noisy. The scale is floored at
+ *                  RO_REL_FLOOR of the center, so counts within a fraction of a
+ *                  percent of each other (MAD close to 0) are never rejected.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "ls.h"
+
+static const char *const ro_policy_names[] = { "none", "mad", "sigma", "hampel" };
+
+/*  policy of its name ("none", "mad", "sigma", "hampel"), -1 if unknown */
+int ro_policy_from_name(const char *name)
+{
+    int i;
+    for (i = RO_NONE; i <= RO_HAMPEL; i++)
+        if (strcmp(name, ro_policy_names[i]) == 0)
+            return i;
+    return -1;
+}
+
+const char *ro_policy_name(int policy)
+{
+    return policy >= RO_NONE && policy <= RO_HAMPEL ? ro_policy_names[policy] : "?";
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  ro_select
+ *  Description:  k-th smallest (0-based) of a[0..n-1], reorders a (quickselect,
+ *                median of three pivot, expected linear time)
+ * =====================================================================================
+ */
+static double ro_select(double *a, int n, int k)
+{
+    int lo = 0, hi = n - 1, i, j, mid;
+    double pivot, tmp;
+    while (hi > lo)
+    {
+        mid = lo + (hi - lo) / 2;
+        if (a[mid] < a[lo]) { tmp = a[mid]; a[mid] = a[lo]; a[lo] = tmp; }
+        if (a[hi]  < a[lo]) { tmp = a[hi];  a[hi]  = a[lo]; a[lo] = tmp; }
+        if (a[hi]  < a[mid]) { tmp = a[hi]; a[hi]  = a[mid]; a[mid] = tmp; }
+        pivot = a[mid];
+        i = lo;
+        j = hi;
+        while (i <= j)
+        {
+            while (a[i] < pivot) i++;
+            while (a[j] > pivot) j--;
+            if (i <= j)
+            {
+                tmp = a[i]; a[i] = a[j]; a[j] = tmp;
+                i++; j--;
+            }
+        }
+        if (k <= j)
+            hi = j;
+        else if (k >= i)
+            lo = i;
+        else
+            break;
+    }
+    return a[k];
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  ro_median
+ *  Description:  median of a[0..n-1] (mean of the middle two for even n), reorders a
+ * =====================================================================================
+ */
+static double ro_median(double *a, int n)
+{
+    double m = ro_select(a, n, n / 2), lower;
+    int i;
+    if (n % 2)
+        return m;
+    /*  after the selection a[0 .. n/2-1] <= m: the lower middle is their maximum */
+    lower = a[0];
+    for (i = 1; i < n / 2; i++)
+        if (a[i] > lower)
+            lower = a[i];
+    return (lower + m) / 2;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  ro_median_mad
+ *  Description:  median and MAD of x[idx[0..n-1]], work: n doubles
+ * =====================================================================================
+ */
+static void ro_median_mad(const double *x, const int *idx, int n, double *work,
+        double *median, double *mad)
+{
+    int i;
+    for (i = 0; i < n; i++)
+        work[i] = x[idx[i]];
+    *median = ro_median(work, n);
+    for (i = 0; i < n; i++)
+        work[i] = fabs(x[idx[i]] - *median);
+    *mad = ro_median(work, n);
+}
+
+/*  spread used for the threshold: at least RO_REL_FLOOR of the center */
+static double ro_floor(double scale, double center)
+{
+    double f = RO_REL_FLOOR * fabs(center);
+    return scale > f ? scale : f;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  ro_group
+ *  Description:  reject outliers among the counts x[idx[0..n-1]] of one angle
+ *                (idx in acquisition order)
+ * =====================================================================================
+ */
+static void ro_group(const double *x, const int *idx, int n, int policy, double k,
+        int window, double *work, unsigned char *reject, double *center, double *scale)
+{
+    double med, mad, mean, var, d;
+    int i, j, s, e, m, changed, iter;
+
+    *center = *scale = NAN;
+    if (n == 0)
+        return;
+    ro_median_mad(x, idx, n, work, &med, &mad);
+    *center = med;
+    *scale  = RO_MAD_SCALE * mad;
+    if (n < RO_MIN_COUNTS || policy == RO_NONE)
+        return;
+
+    switch (policy)
+    {
+        case RO_MAD:
+            d = ro_floor(*scale, med);
+            if (d > 0)
+                for (i = 0; i < n; i++)
+                    reject[idx[i]] = fabs(x[idx[i]] - med) > k * d;
+            break;
+
+        case RO_SIGMA:
+            for (iter = 0, changed = 1; changed && iter < RO_SIGMA_MAX_ITER; iter++)
+            {
+                mean = var = 0;
+                m = 0;
+                for (i = 0; i < n; i++)
+                    if (!reject[idx[i]])
+                    {
+                        mean += x[idx[i]];
+                        m++;
+                    }
+                if (m < RO_MIN_COUNTS)
+                    break;
+                mean /= m;
+                for (i = 0; i < n; i++)
+                    if (!reject[idx[i]])
+                    {
+                        d = x[idx[i]] - mean;
+                        var += d * d;
+                    }
+                *center = mean;
+                *scale  = sqrt(var / (m - 1));
+                d       = ro_floor(*scale, mean);
+                changed = 0;
+                for (i = 0; i < n; i++)
+                    if (!reject[idx[i]] && fabs(x[idx[i]] - mean) > k * d)
+                    {
+                        reject[idx[i]] = 1;
+                        changed = 1;
+                    }
+            }
+            break;
+
+        case RO_HAMPEL:
+            for (i = 0; i < n; i++)
+            {
+                /*  2 window + 1 counts, shifted inside the angle at its ends */
+                s = i - window;
+                e = i + window;
+                if (s < 0)
+                {
+                    e -= s;
+                    s  = 0;
+                }
+                if (e > n - 1)
+                {
+                    s -= e - (n - 1);
+                    e  = n - 1;
+                    s  = s > 0 ? s : 0;
+                }
+                if (e - s + 1 < RO_MIN_COUNTS)
+                    continue;
+                ro_median_mad(x, idx + s, e - s + 1, work, &med, &mad);
+                d = ro_floor(RO_MAD_SCALE * mad, med);
+                reject[idx[i]] = d > 0 && fabs(x[idx[i]] - med) > k * d;
+            }
+            break;
+    }
+    /*  never reject every count of an angle */
+    for (i = 0, j = 0; i < n; i++)
+        j += !reject[idx[i]];
+    if (j == 0)
+        for (i = 0; i < n; i++)
+            reject[idx[i]] = 0;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  ro_reject
+ *  Description:  reject[i] = 1 for the outliers among the n counts x, group[i] is the
+ *                0-based angle of count i (< n_groups). center / scale receive the
+ *                location and spread used for every angle (median and 1.4826 MAD, mean
+ *                and std of the kept counts for sigma clipping).
+ *                Returns 0 if out of memory.
+ * =====================================================================================
+ */
+int ro_reject(const double *x, const int *group, int n, int n_groups, int policy, double k,
+        int window, unsigned char *reject, double *center, double *scale)
+{
+    int *start = calloc(n_groups + 1, sizeof(int));
+    int *idx   = malloc((n > 0 ? n : 1) * sizeof(int));
+    int *fill  = malloc((n_groups > 0 ? n_groups : 1) * sizeof(int));
+    double *work = malloc((n > 0 ? n : 1) * sizeof(double));
+    double t0;
+    int i, g;
+
+    if (!start || !idx || !fill || !work)
+    {
+        free(start); free(idx); free(fill); free(work);
+        return 0;
+    }
+    LS_SPAN_BEGIN(t0);
+    ls_count(LS_ROBUST, n, 0);
+    memset(reject, 0, n);
+    /*  counting sort by angle, stable: acquisition order within an angle */
+    for (i = 0; i < n; i++)
+        start[group[i] + 1]++;
+    for (g = 0; g < n_groups; g++)
+    {
+        start[g + 1] += start[g];
+        fill[g] = start[g];
+    }
+    for (i = 0; i < n; i++)
+        idx[fill[group[i]]++] = i;
+    for (g = 0; g < n_groups; g++)
+        ro_group(x, idx + start[g], start[g + 1] - start[g], policy, k, window, work,
+                reject, &center[g], &scale[g]);
+    free(start); free(idx); free(fill); free(work);
+    LS_SPAN_END(t0, LS_ROBUST, "ro_reject", ro_policy_name(policy));
+    return 1;
+}
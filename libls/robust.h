@@ -0,0 +1,32 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  robust.h
+ *
+ *    Description:  outlier rejection of the static counts, angle by angle, see
+ *                  robust.c. Part of libls, used by ../+SLS/robust_fast.c.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#ifndef ROBUST_H
+#define ROBUST_H
+
+#define RO_MAD_SCALE     1.4826     /* MAD -> standard deviation of a normal distribution */
+#define RO_MIN_COUNTS    7
+#define RO_REL_FLOOR     0.01       /* lower bound of the scale, relative to |center| */
+#define RO_SIGMA_MAX_ITER 10
+
+enum ro_policy { RO_NONE, RO_MAD, RO_SIGMA, RO_HAMPEL };
+
+int         ro_policy_from_name(const char *name);
+const char *ro_policy_name(int policy);
+int ro_reject(const double *x, const int *group, int n, int n_groups, int policy, double k,
+        int window, unsigned char *reject, double *center, double *scale);
+
+#endif
@@ -0,0 +1,231 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  trace.c
+ *
+ *    Description:  spans of the engines of libls, see trace.h.
+ *                  Every thread writes into its own ring buffer (registered on its
+ *                  first span, no lock on the hot path; the bootstrap replicates run
+ *                  in OpenMP threads) and keeps its own sums per engine. Export and
+ *                  reset read all rings: call them while no engine runs (the matlab
+ *                  thread between two MEX calls).
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ls.h"
+
+typedef struct
+{
+    double      t0, t1;         /* [s] ls_now */
+    const char *name;           /* string literal of the engine */
+    int         engine;
+    char        arg[LS_TRACE_ARG];
+} ls_event;
+
+typedef struct
+{
+    ls_event     *e;            /* LS_TRACE_RING spans */
+    long long     n;            /* spans written, e[n % LS_TRACE_RING] is the next */
+    ls_span_total total[LS_N_ENGINES];
+} ls_ring;
+
+volatile int ls_trace_on = 0;
+
+static ls_ring   ls_rings[LS_TRACE_MAX_THREADS];
+static int       ls_n_rings = 0;
+static long long ls_dropped = 0;
+static double    ls_epoch   = 0;
+
+/*  ring of the calling thread: -1 not registered, LS_TRACE_MAX_THREADS none left */
+static __thread int ls_ring_index = -1;
+
+double ls_now(void)
+{
+#if defined(_WIN32)
+    return (double) clock() / CLOCKS_PER_SEC;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + 1e-9 * ts.tv_nsec;
+#endif
+}
+
+/*  on: spans are recorded from now on; the time origin of the trace is the first
+ *  enable after a reset */
+void ls_trace_enable(int on)
+{
+    if (on && ls_epoch == 0)
+        ls_epoch = ls_now();
+    ls_trace_on = on != 0;
+}
+
+void ls_trace_reset(void)
+{
+    int i;
+    for (i = 0; i < ls_n_rings && i < LS_TRACE_MAX_THREADS; i++)
+    {
+        ls_rings[i].n = 0;
+        memset(ls_rings[i].total, 0, sizeof(ls_rings[i].total));
+    }
+    ls_dropped = 0;
+    ls_epoch   = ls_trace_on ? ls_now() : 0;
+}
+
+static ls_ring *ls_thread_ring(void)
+{
+    int i = ls_ring_index;
+    if (i < 0)
+    {
+        i = __sync_fetch_and_add(&ls_n_rings, 1);
+        if (i >= LS_TRACE_MAX_THREADS)
+            i = LS_TRACE_MAX_THREADS;
+        else if (!(ls_rings[i].e = malloc(LS_TRACE_RING * sizeof(ls_event))))
+            i = LS_TRACE_MAX_THREADS;
+        ls_ring_index = i;
+    }
+    return i < LS_TRACE_MAX_THREADS ? &ls_rings[i] : NULL;
+}
+
+static void ls_record(int engine, const char *name, double t0, double t1, const char *arg,
+        int total)
+{
+    ls_ring  *r = ls_thread_ring();
+    ls_event *e;
+    size_t    n;
+    double    d = t1 - t0;
+
+    if (!r || engine < 0 || engine >= LS_N_ENGINES)
+    {
+        __sync_fetch_and_add(&ls_dropped, 1);
+        return;
+    }
+    e = &r->e[r->n % LS_TRACE_RING];
+    e->t0     = t0;
+    e->t1     = t1;
+    e->name   = name;
+    e->engine = engine;
+    e->arg[0] = '\0';
+    if (arg)
+    {
+        n = strlen(arg);
+        strcpy(e->arg, n < LS_TRACE_ARG ? arg : arg + n - (LS_TRACE_ARG - 1));
+    }
+    r->n++;
+    if (!total)
+        return;
+    r->total[engine].spans++;
+    r->total[engine].seconds += d;
+    if (d > r->total[engine].max)
+        r->total[engine].max = d;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  ls_trace_span
+ *  Description:  record a span [t0, t1] of engine. name must be a string literal, of
+ *                arg (may be NULL) the last LS_TRACE_ARG - 1 characters are kept.
+ * =====================================================================================
+ */
+void ls_trace_span(int engine, const char *name, double t0, double t1, const char *arg)
+{
+    ls_record(engine, name, t0, t1, arg, 1);
+}
+
+/*  a phase inside a span of engine: in the trace, but not in the sums of the engine */
+void ls_trace_phase(int engine, const char *name, double t0, double t1)
+{
+    ls_record(engine, name, t0, t1, NULL, 0);
+}
+
+/*  sums of all threads (LS_N_ENGINES entries) */
+void ls_trace_totals(ls_span_total *out)
+{
+    int i, k;
+    memset(out, 0, LS_N_ENGINES * sizeof(ls_span_total));
+    for (i = 0; i < ls_n_rings && i < LS_TRACE_MAX_THREADS; i++)
+        for (k = 0; k < LS_N_ENGINES; k++)
+        {
+            out[k].spans   += ls_rings[i].total[k].spans;
+            out[k].seconds += ls_rings[i].total[k].seconds;
+            if (ls_rings[i].total[k].max > out[k].max)
+                out[k].max = ls_rings[i].total[k].max;
+        }
+}
+
+/*  spans lost: more threads than rings, or overwritten in a full ring */
+long long ls_trace_dropped(void)
+{
+    long long d = ls_dropped;
+    int i;
+    for (i = 0; i < ls_n_rings && i < LS_TRACE_MAX_THREADS; i++)
+        if (ls_rings[i].n > LS_TRACE_RING)
+            d += ls_rings[i].n - LS_TRACE_RING;
+    return d;
+}
+
+/* string as JSON (quotes, backslashes escaped, control characters dropped) */
+static void ls_json_string(FILE *fp, const char *s)
+{
+    fputc('"', fp);
+    for (; *s; s++)
+    {
+        if (*s == '"' || *s == '\\')
+            fputc('\\', fp);
+        if ((unsigned char) *s >= 0x20)
+            fputc(*s, fp);
+    }
+    fputc('"', fp);
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  ls_trace_write_chrome
+ *  Description:  write all recorded spans as Chrome trace events (complete events,
+ *                "ph": "X", times in us since the first enable), oldest first per
+ *                thread. Returns the number of spans written, -1 on error.
+ * =====================================================================================
+ */
+int ls_trace_write_chrome(FILE *fp)
+{
+    const ls_event *e;
+    long long j, first;
+    int i, n = 0, sep = 0;
+
+    fprintf(fp, "{\"traceEvents\": [\n");
+    for (i = 0; i < ls_n_rings && i < LS_TRACE_MAX_THREADS; i++)
+    {
+        fprintf(fp, "%s{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": %d, "
+                "\"args\": {\"name\": \"%s %d\"}}", sep++ ? ",\n" : "", i,
+                i == 0 ? "main" : "worker", i);
+        first = ls_rings[i].n > LS_TRACE_RING ? ls_rings[i].n - LS_TRACE_RING : 0;
+        for (j = first; j < ls_rings[i].n; j++, n++)
+        {
+            e = &ls_rings[i].e[j % LS_TRACE_RING];
+            fprintf(fp, ",\n{\"name\": \"%s\", \"cat\": \"%s\", \"ph\": \"X\", \"ts\": %.3f, "
+                    "\"dur\": %.3f, \"pid\": 1, \"tid\": %d", e->name,
+                    ls_engine_name(e->engine), 1e6 * (e->t0 - ls_epoch),
+                    1e6 * (e->t1 - e->t0), i);
+            if (e->arg[0])
+            {
+                fprintf(fp, ", \"args\": {\"arg\": ");
+                ls_json_string(fp, e->arg);
+                fputc('}', fp);
+            }
+            fputc('}', fp);
+        }
+    }
+    fprintf(fp, "\n], \"displayTimeUnit\": \"ms\", \"otherData\": {\"libls\": \"%s\", "
+            "\"dropped\": %lld}}\n", ls_version(), ls_trace_dropped());
+    return ferror(fp) ? -1 : n;
+}
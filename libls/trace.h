@@ -0,0 +1,58 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  trace.h
+ *
+ *    Description:  tracing of the engines of libls (trace.c): spans (engine, name,
+ *                  start, end, argument e.g. the file) are kept in one ring buffer per
+ *                  thread and exported as Chrome trace events (chrome://tracing,
+ *                  ui.perfetto.dev) or summed per engine. Disabled by default, then a
+ *                  span costs one test of ls_trace_on:
+ *
+ *                      double t0;
+ *                      LS_SPAN_BEGIN(t0);
+ *                      ...
+ *                      LS_SPAN_END(t0, LS_PARSE, "rs_read_file", path);
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdio.h>
+
+#define LS_TRACE_RING        32768  /* spans per thread, the oldest are overwritten */
+#define LS_TRACE_MAX_THREADS 64
+#define LS_TRACE_ARG         48     /* characters of the argument kept (end of a path) */
+
+extern volatile int ls_trace_on;
+
+#define LS_SPAN_BEGIN(t0) \
+    ((t0) = ls_trace_on ? ls_now() : 0)
+#define LS_SPAN_END(t0, engine, name, arg) \
+    do { if ((t0) > 0) ls_trace_span(engine, name, t0, ls_now(), arg); } while (0)
+
+/*  sum of the spans of one engine over all threads */
+typedef struct
+{
+    long long spans;
+    double    seconds;
+    double    max;              /* [s] longest span */
+} ls_span_total;
+
+double ls_now(void);
+void   ls_trace_enable(int on);
+void   ls_trace_reset(void);
+void   ls_trace_span(int engine, const char *name, double t0, double t1, const char *arg);
+void   ls_trace_phase(int engine, const char *name, double t0, double t1);
+void   ls_trace_totals(ls_span_total *out);
+long long ls_trace_dropped(void);
+int    ls_trace_write_chrome(FILE *fp);
+
+#endif
@@ -0,0 +1,324 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  watch.c
+ *
+ *    Description:  report files of a directory once they are completely written, to
+ *                  ingest the autosave files of a running measurement incrementally.
+ *                  On linux the directory is watched by inotify (IN_CLOSE_WRITE,
+ *                  IN_MOVED_TO); elsewhere, or if inotify is not available, it is
+ *                  scanned at every poll and a file is reported when its size and
+ *                  modification time did not change since the previous poll.
+ *                  Files already in the directory when the watch is opened may still be
+ *                  written: they are reported by a scan once they did not change
+ *                  between two polls and were last modified WD_SETTLE s ago, or by
+ *                  inotify when they are closed; with inotify, a file written to after
+ *                  the watch was opened is only reported when closed.
+ *                  A poll returns the queued files without removing them: the caller
+ *                  removes them with 'done' once they are read, so files of a failed
+ *                  read are returned again by the next poll.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <poll.h>
+#include <errno.h>
+#define WD_INOTIFY
+#endif
+
+#include "ls.h"
+
+#define WD_POLL_STEP     100        /* [ms] sleep between scans while waiting */
+#define WD_SETTLE        2          /* [s] since the last modification of a scanned file */
+
+/*  name ends with the suffix (case insensitive, ".ASC" = ".asc") */
+static int wd_match(const wd_watch *w, const char *name)
+{
+    size_t n = strlen(name), m = strlen(w->suffix);
+    return n > m && strcasecmp(name + n - m, w->suffix) == 0;
+}
+
+static int wd_push(wd_watch *w, const char *name)
+{
+    char **q;
+    if (w->n_queue == w->capacity_queue)
+    {
+        int capacity = w->capacity_queue > 0 ? 2 * w->capacity_queue : 64;
+        if (!(q = realloc(w->queue, capacity * sizeof(char *))))
+            return 0;
+        w->queue = q;
+        w->capacity_queue = capacity;
+    }
+    if (!(w->queue[w->n_queue] = malloc(strlen(name) + 1)))
+        return 0;
+    strcpy(w->queue[w->n_queue++], name);
+    return 1;
+}
+
+static int wd_stat(const wd_watch *w, const char *name, struct stat *st)
+{
+    char path[4096];
+    if (snprintf(path, sizeof(path), "%s/%s", w->dir, name) >= (int) sizeof(path))
+        return 0;
+    return stat(path, st) == 0 && S_ISREG(st->st_mode);
+}
+
+/*  index of name in the table of the files seen, added (unreported) if new; -1 if
+ *  out of memory */
+static int wd_file_index(wd_watch *w, const char *name, const struct stat *st)
+{
+    wd_file *f;
+    int i;
+    for (i = 0; i < w->n_file && strcmp(w->file[i].name, name) != 0; i++);
+    if (i < w->n_file)
+        return i;
+    if (w->n_file == w->capacity_file)
+    {
+        int capacity = w->capacity_file > 0 ? 2 * w->capacity_file : 256;
+        if (!(f = realloc(w->file, capacity * sizeof(wd_file))))
+            return -1;
+        w->file = f;
+        w->capacity_file = capacity;
+    }
+    f = &w->file[w->n_file];
+    if (!(f->name = malloc(strlen(name) + 1)))
+        return -1;
+    strcpy(f->name, name);
+    f->size     = st ? st->st_size : 0;
+    f->mtime    = st ? st->st_mtime : 0;
+    f->reported = 0;
+    f->open     = 0;
+    return w->n_file++;
+}
+
+/*  files seen but not yet reported */
+static int wd_pending(const wd_watch *w)
+{
+    int i;
+    for (i = 0; i < w->n_file; i++)
+        if (!w->file[i].reported)
+            return 1;
+    return 0;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  wd_scan
+ *  Description:  read the directory: a file is queued when it has not changed since
+ *                the previous scan and was last modified at least WD_SETTLE s ago.
+ *                With add == 0 only the files already seen are checked (inotify
+ *                reports the new ones). Returns 0 if out of memory or the directory
+ *                cannot be read.
+ * =====================================================================================
+ */
+static int wd_scan(wd_watch *w, int add)
+{
+    DIR *d = opendir(w->dir);
+    struct dirent *entry;
+    struct stat st;
+    wd_file *f;
+    time_t now = time(NULL);
+    int i, n, ok = 1;
+
+    if (!d)
+        return 0;
+    while (ok && (entry = readdir(d)))
+    {
+        if (!wd_match(w, entry->d_name) || !wd_stat(w, entry->d_name, &st))
+            continue;
+        n = w->n_file;
+        if (!add)
+        {
+            for (i = 0; i < n && strcmp(w->file[i].name, entry->d_name) != 0; i++);
+            if (i == n)
+                continue;
+        }
+        else if ((i = wd_file_index(w, entry->d_name, &st)) < 0)
+        {
+            ok = 0;
+            break;
+        }
+        if (i == n)
+            continue;                   /* first seen now */
+        f = &w->file[i];
+        if (f->size != st.st_size || f->mtime != st.st_mtime)
+        {
+            f->size  = st.st_size;      /* still written */
+            f->mtime = st.st_mtime;
+        }
+        else if (!f->reported && !f->open && now - st.st_mtime >= WD_SETTLE)
+        {
+            f->reported = 1;
+            ok = wd_push(w, f->name);
+        }
+    }
+    closedir(d);
+    return ok;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  wd_open
+ *  Description:  watch files of dir ending with suffix. Returns 0 if the directory
+ *                cannot be read or out of memory.
+ * =====================================================================================
+ */
+int wd_open(wd_watch *w, const char *dir, const char *suffix)
+{
+    memset(w, 0, sizeof(wd_watch));
+    w->fd = w->wd = -1;
+    if (!(w->dir = malloc(strlen(dir) + 1)))
+        return 0;
+    strcpy(w->dir, dir);
+    strncpy(w->suffix, suffix, WD_SUFFIX_LENGTH - 1);
+#ifdef WD_INOTIFY
+    /*  watch first, then list: no file is lost in between (a file both listed and
+     *  closed later is reported once) */
+    if ((w->fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC)) >= 0
+            && (w->wd = inotify_add_watch(w->fd, dir, IN_CLOSE_WRITE | IN_MOVED_TO | IN_MODIFY)) < 0)
+    {
+        close(w->fd);
+        w->fd = -1;
+    }
+#endif
+    w->used = 1;
+    /*  the files already there are only recorded: they may still be written */
+    if (!wd_scan(w, 1))
+    {
+        wd_close(w);
+        return 0;
+    }
+    return 1;
+}
+
+#ifdef WD_INOTIFY
+/*  queue the finished files of the pending inotify events (once per file) */
+static int wd_events(wd_watch *w)
+{
+    char buf[4096] __attribute__ ((aligned(__alignof__(struct inotify_event))));
+    const struct inotify_event *event;
+    ssize_t n;
+    char *p;
+    int i;
+
+    while ((n = read(w->fd, buf, sizeof(buf))) > 0)
+        for (p = buf; p < buf + n; p += sizeof(struct inotify_event) + event->len)
+        {
+            event = (const struct inotify_event *) p;
+            if (event->mask & IN_Q_OVERFLOW)
+            {
+                if (!wd_scan(w, 1))     /* events lost: the new files are reported when settled */
+                    return 0;
+            }
+            else if (event->len > 0 && wd_match(w, event->name) && (event->mask & IN_MODIFY))
+            {
+                /*  a listed file still written: wait for its close */
+                for (i = 0; i < w->n_file && strcmp(w->file[i].name, event->name) != 0; i++);
+                if (i < w->n_file)
+                    w->file[i].open = 1;
+            }
+            else if (event->len > 0 && wd_match(w, event->name))
+            {
+                if ((i = wd_file_index(w, event->name, NULL)) < 0)
+                    return 0;
+                if (!w->file[i].reported)
+                {
+                    w->file[i].reported = 1;
+                    if (!wd_push(w, event->name))
+                        return 0;
+                }
+            }
+        }
+    return n >= 0 || errno == EAGAIN || errno == EWOULDBLOCK;
+}
+#endif
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  wd_poll
+ *  Description:  queue the files finished since the previous poll, waiting up to
+ *                timeout ms for the first one. Counts the queued files (watch).
+ *                Returns 0 on error.
+ * =====================================================================================
+ */
+int wd_poll(wd_watch *w, int timeout)
+{
+    struct timespec step = { 0, WD_POLL_STEP * 1000000L };
+    int waited = 0, scan;
+
+    for (;;)
+    {
+#ifdef WD_INOTIFY
+        if (w->fd >= 0 && !wd_events(w))
+            return 0;
+#endif
+        /*  scanning: every file; inotify: the files there before the watch */
+        scan = w->fd < 0 || wd_pending(w);
+        if (scan && !wd_scan(w, w->fd < 0))
+            return 0;
+        if (w->n_queue > 0 || waited >= timeout)
+        {
+            ls_count(LS_WATCH, w->n_queue, 0);
+            return 1;
+        }
+#ifdef WD_INOTIFY
+        if (!scan)
+        {
+            struct pollfd pfd = { w->fd, POLLIN, 0 };
+            poll(&pfd, 1, timeout - waited);
+            waited = timeout;
+            continue;
+        }
+#endif
+        nanosleep(&step, NULL);
+        waited += WD_POLL_STEP;
+    }
+}
+
+/*  remove the first n queued files (read by the caller) */
+void wd_done(wd_watch *w, int n)
+{
+    int i;
+    if (n > w->n_queue)
+        n = w->n_queue;
+    if (n <= 0)
+        return;
+    for (i = 0; i < n; i++)
+        free(w->queue[i]);
+    memmove(w->queue, w->queue + n, (w->n_queue - n) * sizeof(char *));
+    w->n_queue -= n;
+}
+
+void wd_close(wd_watch *w)
+{
+    int i;
+#ifdef WD_INOTIFY
+    if (w->fd >= 0)
+        close(w->fd);               /* removes the watch */
+#endif
+    for (i = 0; i < w->n_file; i++)
+        free(w->file[i].name);
+    for (i = 0; i < w->n_queue; i++)
+        free(w->queue[i]);
+    free(w->file);
+    free(w->queue);
+    free(w->dir);
+    memset(w, 0, sizeof(wd_watch));
+    w->fd = w->wd = -1;
+}
@@ -0,0 +1,51 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  watch.h
+ *
+ *    Description:  files of a directory reported once completely written (wd_), see
+ *                  watch.c. Part of libls, used by ../+Instruments/watch_directory_fast.c.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#ifndef WATCH_H
+#define WATCH_H
+
+#include <time.h>
+#include <sys/types.h>
+
+#define WD_SUFFIX_LENGTH 16
+
+typedef struct
+{
+    char  *name;
+    off_t  size;
+    time_t mtime;
+    int    reported;
+    int    open;                    /* inotify: written after the watch, wait for the close */
+} wd_file;
+
+typedef struct
+{
+    int      used;
+    char    *dir;
+    char     suffix[WD_SUFFIX_LENGTH];
+    int      fd, wd;                /* inotify descriptors, -1 if scanning */
+    wd_file *file;                  /* files seen so far */
+    int      n_file, capacity_file;
+    char   **queue;                 /* finished files not yet read by the caller */
+    int      n_queue, capacity_queue;
+} wd_watch;
+
+int  wd_open(wd_watch *w, const char *dir, const char *suffix);
+int  wd_poll(wd_watch *w, int timeout);
+void wd_done(wd_watch *w, int n);
+void wd_close(wd_watch *w);
+
+#endif
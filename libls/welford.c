@@ -0,0 +1,151 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  welford.c
+ *
+ *    Description:  per-angle accumulators of count rate, monitor intensity and
+ *                  temperature (welford.h): counts are added while the files are read
+ *                  and the accumulators of shards read separately are merged. The
+ *                  buckets are kept sorted by angle, so the bucket of a count is found
+ *                  by bisection; runs of counts at the same angle (a file is one
+ *                  angle, the counts of a series come angle by angle) reuse the bucket
+ *                  of the previous count.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "ls.h"
+
+/*  room for n buckets. Returns 0 if out of memory. */
+int wa_reserve(wa_angles *a, int n)
+{
+    wa_bucket *b;
+    int capacity;
+    if (n <= a->capacity)
+        return 1;
+    capacity = a->capacity > 0 ? a->capacity : 16;
+    while (capacity < n)
+        capacity *= 2;
+    if (!(b = realloc(a->b, capacity * sizeof(wa_bucket))))
+        return 0;
+    a->b = b;
+    a->capacity = capacity;
+    return 1;
+}
+
+static int wa_compare(const void *x, const void *y)
+{
+    double a = ((const wa_bucket *) x)->angle, b = ((const wa_bucket *) y)->angle;
+    return a < b ? -1 : (a > b);
+}
+
+/*  sort the buckets by angle (a state read from elsewhere) */
+void wa_sort(wa_angles *a)
+{
+    int i;
+    for (i = 1; i < a->n && a->b[i - 1].angle <= a->b[i].angle; i++);
+    if (i < a->n)
+        qsort(a->b, a->n, sizeof(wa_bucket), wa_compare);
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  wa_find
+ *  Description:  index of the bucket of the angle: the nearest one if within
+ *                tolerance, else a new one inserted in order. Returns -1 if out of
+ *                memory.
+ * =====================================================================================
+ */
+static int wa_find(wa_angles *a, double angle, double tolerance)
+{
+    int lo = 0, hi = a->n, mid;
+
+    /*  first bucket with angle >= the count */
+    while (lo < hi)
+    {
+        mid = (lo + hi) / 2;
+        if (a->b[mid].angle < angle)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if (lo > 0 && (lo == a->n || angle - a->b[lo - 1].angle <= a->b[lo].angle - angle))
+    {
+        if (angle - a->b[lo - 1].angle < tolerance)
+            return lo - 1;
+    }
+    else if (lo < a->n && a->b[lo].angle - angle < tolerance)
+        return lo;
+    if (!wa_reserve(a, a->n + 1))
+        return -1;
+    memmove(a->b + lo + 1, a->b + lo, (a->n - lo) * sizeof(wa_bucket));
+    a->n++;
+    a->b[lo].angle = angle;
+    wf_init(&a->b[lo].s);
+    return lo;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  wa_add
+ *  Description:  add n counts to the buckets of their angles (a sorted). Returns 0 if
+ *                out of memory.
+ * =====================================================================================
+ */
+int wa_add(wa_angles *a, const double *angle, const double *cr, const double *imon,
+        const double *T, int n, double tolerance)
+{
+    double x[WF_N], t0;
+    int k, i = -1;
+
+    LS_SPAN_BEGIN(t0);
+    ls_count(LS_WELFORD, n, 0);
+    for (k = 0; k < n; k++)
+    {
+        /*  same angle as the previous count: same bucket */
+        if (i < 0 || angle[k] != angle[k - 1])
+            if ((i = wa_find(a, angle[k], tolerance)) < 0)
+                return 0;
+        x[WF_CR]   = cr[k];
+        x[WF_IMON] = imon[k];
+        x[WF_T]    = T[k];
+        wf_add(&a->b[i].s, x);
+    }
+    LS_SPAN_END(t0, LS_WELFORD, "wa_add", NULL);
+    return 1;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  wa_merge
+ *  Description:  a <- a + b, angle by angle (a sorted). Returns 0 if out of memory.
+ * =====================================================================================
+ */
+int wa_merge(wa_angles *a, const wa_angles *b, double tolerance)
+{
+    int i, k;
+
+    ls_count(LS_WELFORD, b->n, 0);
+    for (k = 0; k < b->n; k++)
+    {
+        if ((i = wa_find(a, b->b[k].angle, tolerance)) < 0)
+            return 0;
+        wf_merge(&a->b[i].s, &b->b[k].s);
+    }
+    return 1;
+}
+
+void wa_free(wa_angles *a)
+{
+    free(a->b);
+    memset(a, 0, sizeof(wa_angles));
+}
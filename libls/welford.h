@@ -0,0 +1,102 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  welford.h
+ *
+ *    Description:  streaming mean / variance of the count rate, monitor intensity and
+ *                  temperature of one angle (Welford updates, O(1) memory). Partial
+ *                  states (e.g. of files read by different threads) are combined with
+ *                  the pairwise formula of Chan et al. The accumulators of all angles
+ *                  (wa_) are in welford.c, used by ../+SLS/welford_fast.c.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#ifndef WELFORD_H
+#define WELFORD_H
+
+#include <math.h>
+
+/*  accumulated quantities: count rate, monitor intensity, temperature */
+#define WF_CR   0
+#define WF_IMON 1
+#define WF_T    2
+#define WF_N    3
+
+typedef struct
+{
+    double n;
+    double mean[WF_N];
+    double m2[WF_N];            /* sum of squared deviations from the mean */
+} wf_state;
+
+static inline void wf_init(wf_state *s)
+{
+    int j;
+    s->n = 0;
+    for (j = 0; j < WF_N; j++)
+        s->mean[j] = s->m2[j] = 0;
+}
+
+/* add one count x = (cr, imon, T) */
+static inline void wf_add(wf_state *s, const double *x)
+{
+    double d;
+    int j;
+    s->n += 1;
+    for (j = 0; j < WF_N; j++)
+    {
+        d = x[j] - s->mean[j];
+        s->mean[j] += d / s->n;
+        s->m2[j]   += d * (x[j] - s->mean[j]);
+    }
+}
+
+/* a <- a + b */
+static inline void wf_merge(wf_state *a, const wf_state *b)
+{
+    double n = a->n + b->n, d;
+    int j;
+    if (b->n == 0)
+        return;
+    for (j = 0; j < WF_N; j++)
+    {
+        d = b->mean[j] - a->mean[j];
+        a->mean[j] += d * b->n / n;
+        a->m2[j]   += b->m2[j] + d * d * a->n * b->n / n;
+    }
+    a->n = n;
+}
+
+/* sample standard deviation (n - 1), NaN for a single count (as calc_mean) */
+static inline double wf_std(const wf_state *s, int j)
+{
+    return sqrt(s->m2[j] / (s->n - 1));
+}
+
+/*  accumulators of all angles, sorted by angle */
+typedef struct
+{
+    double   angle;
+    wf_state s;
+} wa_bucket;
+
+typedef struct
+{
+    int        n, capacity;
+    wa_bucket *b;
+} wa_angles;
+
+int  wa_reserve(wa_angles *a, int n);
+void wa_sort(wa_angles *a);
+int  wa_add(wa_angles *a, const double *angle, const double *cr, const double *imon,
+        const double *T, int n, double tolerance);
+int  wa_merge(wa_angles *a, const wa_angles *b, double tolerance);
+void wa_free(wa_angles *a);
+
+#endif
@@ -0,0 +1,178 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  zimm.c
+ *
+ *    Description:  double extrapolation (q -> 0, c -> 0) of Kc/R of all angles and
+ *                  concentrations of an experiment in one weighted least squares fit
+ *                  (lr_solve, model linear in q^2 and c):
+ *
+ *                    Zimm     Kc/R       = 1/M ( 1 + Rg^2 q^2 / 3 ) + 2 B2 c
+ *                    Berry    sqrt(Kc/R) = 1/sqrt(M) ( 1 + Rg^2 q^2 / 6 ) + B2 sqrt(M) c
+ *                    Guinier  log(Kc/R)  = -log(M) + Rg^2 q^2 / 3 + 2 B2 M c
+ *
+ *                  dy is propagated from dKc/R. The covariance of M, Rg, B2 is that of
+ *                  the three coefficients transformed with the Jacobian (delta
+ *                  method), the errors are the half widths of the 95% intervals.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "ls.h"
+
+/*  M, Rg, B2 and their covariance (J cov_a J') from the coefficients a0, a1, a2 */
+static void zb_parameters(int model, const lr_result *lr, zb_result *res)
+{
+    double J[ZB_N_PAR * ZB_N_PAR], a0 = lr->coeff[0], a1 = lr->coeff[1], a2 = lr->coeff[2];
+    double M, Rg, B2, rg2, tq, s;
+    int i, j, k, l;
+
+    /*  J: rows M, Rg, B2, columns a0, a1, a2 */
+    memset(J, 0, sizeof(J));
+    switch (model)
+    {
+        case ZB_BERRY:
+            M   = 1 / (a0 * a0);
+            rg2 = 6 * a1 / a0;
+            B2  = a2 * a0;
+            J[0] = -2 / (a0 * a0 * a0);
+            J[6] = a2;
+            J[8] = a0;
+            break;
+        case ZB_GUINIER:
+            M   = exp(-a0);
+            rg2 = 3 * a1;
+            B2  = a2 / (2 * M);
+            J[0] = -M;
+            J[6] = B2;
+            J[8] = 1 / (2 * M);
+            break;
+        default:
+            M   = 1 / a0;
+            rg2 = 3 * a1 / a0;
+            B2  = a2 / 2;
+            J[0] = -1 / (a0 * a0);
+            J[8] = 0.5;
+    }
+    Rg = rg2 >= 0 ? sqrt(rg2) : NAN;
+    /*  dRg = dRg^2 / (2 Rg) */
+    switch (model)
+    {
+        case ZB_BERRY:
+            J[3] = -3 * a1 / (a0 * a0) / Rg;
+            J[4] = 3 / a0 / Rg;
+            break;
+        case ZB_GUINIER:
+            J[4] = 1.5 / Rg;
+            break;
+        default:
+            J[3] = -1.5 * a1 / (a0 * a0) / Rg;
+            J[4] = 1.5 / a0 / Rg;
+    }
+    for (i = 0; i < ZB_N_PAR; i++)
+        res->coeff[i] = lr->coeff[i];
+    res->p[0] = M;
+    res->p[1] = Rg;
+    res->p[2] = B2;
+    tq = lr->dof > 0 ? cu_student_t95(lr->dof) : NAN;
+    for (i = 0; i < ZB_N_PAR; i++)
+        for (j = 0; j < ZB_N_PAR; j++)
+        {
+            s = 0;
+            for (k = 0; k < ZB_N_PAR; k++)
+                for (l = 0; l < ZB_N_PAR; l++)
+                    s += J[i * ZB_N_PAR + k] * lr->cov[k * ZB_N_PAR + l] * J[j * ZB_N_PAR + l];
+            res->cov[i * ZB_N_PAR + j] = s;
+        }
+    for (i = 0; i < ZB_N_PAR; i++)
+        res->error[i] = tq * sqrt(fabs(res->cov[i * ZB_N_PAR + i]));
+}
+
+/*  1 if the used points span more than one value of x */
+static int zb_spread(const double *x, const double *y, const unsigned char *mask, int n)
+{
+    double lo = INFINITY, hi = -INFINITY;
+    int k;
+    for (k = 0; k < n; k++)
+        if ((!mask || mask[k]) && isfinite(x[k]) && isfinite(y[k]))
+        {
+            lo = x[k] < lo ? x[k] : lo;
+            hi = x[k] > hi ? x[k] : hi;
+        }
+    return hi > lo;
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  zb_fit
+ *  Description:  fit the n points (q^2 [A^-2], c, Kc/R, dKc/R) with mask[k] != 0
+ *                (mask may be NULL). Returns 0 if undetermined (fewer than 4 points,
+ *                a single angle or concentration); the results are then NaN.
+ *                Rg is NaN if the slope in q^2 is negative.
+ * =====================================================================================
+ */
+int zb_fit(const double *q2, const double *c, const double *kcr, const double *dkcr,
+        const unsigned char *mask, int n, int model, zb_result *res)
+{
+    const double *col[ZB_N_PAR];
+    double *one = malloc((n > 0 ? n : 1) * sizeof(double));
+    double *y   = malloc((n > 0 ? n : 1) * sizeof(double));
+    double *dy  = malloc((n > 0 ? n : 1) * sizeof(double));
+    lr_result lr;
+    int i, k, ok = 0;
+    double t0;
+
+    LS_SPAN_BEGIN(t0);
+    ls_count(LS_ZIMM, n, 0);
+    memset(res, 0, sizeof(zb_result));
+    for (i = 0; i < ZB_N_PAR; i++)
+        res->coeff[i] = res->p[i] = res->error[i] = NAN;
+    for (i = 0; i < ZB_N_PAR * ZB_N_PAR; i++)
+        res->cov[i] = NAN;
+    res->chi2 = NAN;
+
+    if (one && y && dy && model >= ZB_ZIMM && model <= ZB_GUINIER)
+    {
+        for (k = 0; k < n; k++)
+        {
+            one[k] = 1;
+            switch (model)
+            {
+                case ZB_BERRY:
+                    y[k]  = kcr[k] > 0 ? sqrt(kcr[k]) : NAN;
+                    dy[k] = dkcr[k] / (2 * y[k]);
+                    break;
+                case ZB_GUINIER:
+                    y[k]  = kcr[k] > 0 ? log(kcr[k]) : NAN;
+                    dy[k] = dkcr[k] / kcr[k];
+                    break;
+                default:
+                    y[k]  = kcr[k];
+                    dy[k] = dkcr[k];
+            }
+        }
+        col[0] = one;
+        col[1] = q2;
+        col[2] = c;
+        ok = lr_solve(col, ZB_N_PAR, y, dy, mask, n, &lr) && zb_spread(q2, y, mask, n)
+            && zb_spread(c, y, mask, n);
+        res->n    = lr.n;
+        res->dof  = lr.dof;
+        res->chi2 = lr.chi2;
+        if (ok)
+            zb_parameters(model, &lr, res);
+    }
+    free(one); free(y); free(dy);
+    LS_SPAN_END(t0, LS_ZIMM, "zb_fit", NULL);
+    return ok;
+}
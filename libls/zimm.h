@@ -0,0 +1,44 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  zimm.h
+ *
+ *    Description:  double extrapolation of the static light scattering of many
+ *                  concentrations and angles (Zimm, Berry, Guinier), see zimm.c.
+ *                  Part of libls, used by ../+SLS/zimm_fast.c.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#ifndef ZIMM_H
+#define ZIMM_H
+
+enum zb_model
+{
+    ZB_ZIMM    = 0,     /* Kc/R linear in q^2 and c */
+    ZB_BERRY   = 1,     /* sqrt(Kc/R) */
+    ZB_GUINIER = 2      /* log(Kc/R) */
+};
+
+/*  M, Rg, B2 */
+#define ZB_N_PAR 3
+
+typedef struct
+{
+    int    n, dof;
+    double chi2;
+    double coeff[ZB_N_PAR];             /* of the linear model: 1, q^2, c */
+    double p[ZB_N_PAR];                 /* M, Rg, B2 */
+    double error[ZB_N_PAR];             /* half widths of the 95% confidence intervals */
+    double cov[ZB_N_PAR * ZB_N_PAR];    /* covariance of M, Rg, B2 */
+} zb_result;
+
+int zb_fit(const double *q2, const double *c, const double *kcr, const double *dkcr,
+        const unsigned char *mask, int n, int model, zb_result *res);
+
+#endif
@@ -0,0 +1,38 @@
+function res = linreg ( x, y, dy, group, degree, origin )
+% weighted linear least squares of many groups of points in one native call
+% (linreg_fast): y = b0 + b1 * x + ... + bd * x^d per group, weights 1 ./ dy.^2,
+% errors as confint of fit (95%, covariance scaled by chi2 / dof).
+% input : x, y, dy ([] for unit weights), group: one label per point ([] for a
+%         single group), degree (1 to 3, default 1), origin (true: b0 = 0)
+% output: struct with the sorted labels Group and one column per group: Coeff,
+%         Error (constant term first), N, Chi2, Dof, Cov (n_par x n_par x groups)
+ if nargin < 4 || isempty(group)
+  group	= ones(size(x));
+ end
+ if nargin < 5
+  degree	= 1;
+ end
+ if nargin < 6
+  origin	= false;
+ end
+
+ [ labels tmp j ]	= unique( group(:) );
+ [ j order ]		= sort( j );
+ offset		= [ 0 cumsum( accumarray( j, 1, [ length(labels) 1 ] ) )' ];
+ x		= x(order);
+ y		= y(order);
+ if ~isempty(dy)
+  dy		= dy(order);
+ end
+
+ [ cf dcf n chi2 cov ]	= linreg_fast( x, y, dy, offset, degree, origin );
+
+ np		= size(cf, 1);
+ res.Group	= labels';
+ res.Coeff	= cf;
+ res.Error	= dcf;
+ res.N		= n;
+ res.Chi2	= chi2;
+ res.Dof	= n - np;
+ res.Cov	= reshape( cov, np, np, [] );
+end
@@ -0,0 +1,116 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  linreg_fast.c
+ *
+ *    Description:  MEX shim of the batched weighted linear least squares of libls
+ *                  (lr_batch, libls/linreg.c): many small regressions (Kc/R vs c per
+ *                  experiment, Gamma vs q^2 per sample ...) in one call.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/* check if calling from matlab and include necessary mex.h*/
+#ifdef MATLAB_MEX_FILE
+#include "mex.h"
+#endif
+
+#include "libls/ls.h"
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  mexFunction
+ *  Description:  comunicate between matlab and c program
+ *
+ *  [cf dcf n chi2 cov] = linreg_fast(x, y, dy, offset, degree, origin)
+ *
+ *  x, y, dy : points of all groups, concatenated (dy = [] for unit weights)
+ *  offset   : (n_groups + 1) 0-based start indices of every group
+ *  degree   : of the polynomial, 1 (default) to 3
+ *  origin   : true: no constant term (default false)
+ *  cf, dcf  : n_par x n_groups coefficients (constant term first) and the half
+ *             widths of their 95% confidence intervals; NaN if undetermined
+ *  n, chi2  : points used and chi2 of every group
+ *  cov      : n_par^2 x n_groups covariance matrices (column-major)
+ * =====================================================================================
+ */
+#ifdef MATLAB_MEX_FILE
+void mexFunction(int nlhs,
+        mxArray *plhs[],
+        int nrhs,
+        const mxArray *prhs[])
+{
+    const double *x, *y, *dy = NULL, *offset;
+    double *cf, *dcf, *nused, *chi2, *cov;
+    int i, j, k, n_groups, n_data, degree = 1, origin = 0, np, *off;
+    lr_result *res;
+    double t0;
+
+    LS_SPAN_BEGIN(t0);
+    if (nrhs < 4)
+        mexErrMsgTxt("usage: [cf dcf n chi2 cov] = linreg_fast(x, y, dy, offset, degree, origin)");
+    if (nrhs > 4)
+        degree = (int) mxGetScalar(prhs[4]);
+    if (nrhs > 5)
+        origin = mxGetScalar(prhs[5]) != 0;
+    if (!(np = lr_n_par(degree, origin)))
+        mexErrMsgTxt("linreg_fast: degree must be 1, 2 or 3");
+
+    n_data   = (int) mxGetNumberOfElements(prhs[0]);
+    n_groups = (int) mxGetNumberOfElements(prhs[3]) - 1;
+    if (n_groups < 0 || (int) mxGetNumberOfElements(prhs[1]) != n_data
+            || (!mxIsEmpty(prhs[2]) && (int) mxGetNumberOfElements(prhs[2]) != n_data))
+        mexErrMsgTxt("linreg_fast: x, y and dy must have the same length");
+    x      = mxGetPr(prhs[0]);
+    y      = mxGetPr(prhs[1]);
+    if (!mxIsEmpty(prhs[2]))
+        dy = mxGetPr(prhs[2]);
+    offset = mxGetPr(prhs[3]);
+
+    off = mxMalloc((n_groups + 1) * sizeof(int));
+    res = mxMalloc((n_groups > 0 ? n_groups : 1) * sizeof(lr_result));
+    for (i = 0; i <= n_groups; i++)
+    {
+        off[i] = (int) offset[i];
+        if (off[i] < 0 || off[i] > n_data || (i > 0 && off[i] < off[i - 1]))
+            mexErrMsgTxt("linreg_fast: offsets out of range");
+    }
+    lr_batch(x, y, dy, off, n_groups, degree, origin, res);
+
+    plhs[0] = mxCreateDoubleMatrix(np, n_groups, mxREAL);
+    plhs[1] = mxCreateDoubleMatrix(np, n_groups, mxREAL);
+    plhs[2] = mxCreateDoubleMatrix(1, n_groups, mxREAL);
+    plhs[3] = mxCreateDoubleMatrix(1, n_groups, mxREAL);
+    plhs[4] = mxCreateDoubleMatrix(np * np, n_groups, mxREAL);
+    cf    = mxGetPr(plhs[0]);
+    dcf   = mxGetPr(plhs[1]);
+    nused = mxGetPr(plhs[2]);
+    chi2  = mxGetPr(plhs[3]);
+    cov   = mxGetPr(plhs[4]);
+    for (i = 0; i < n_groups; i++)
+    {
+        for (j = 0; j < np; j++)
+        {
+            cf[i * np + j]  = res[i].coeff[j];
+            dcf[i * np + j] = res[i].error[j];
+            for (k = 0; k < np; k++)
+                cov[i * np * np + k * np + j] = res[i].cov[j * np + k];
+        }
+        nused[i] = res[i].n;
+        chi2[i]  = res[i].chi2;
+    }
+    mxFree(off);
+    mxFree(res);
+    LS_SPAN_END(t0, LS_MEX, "linreg_fast", NULL);
+}				/* ----------  end of function mexFunction  ---------- */
+#endif
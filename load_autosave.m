@@ -0,0 +1,49 @@
+function [ dls sls data ] = load_autosave ( varargin )
+% DLS.Sample and SLS.Sample of the same series of ALV autosave files from one
+% parse of every file (Instruments.ALVBASE.read_autosave_series): the
+% correlations, the mean count rates and the monitor intensities are read
+% together instead of once by each sample.
+% input : the arguments of DLS.Sample and SLS.Sample together ('Path',
+%         'Instrument', 'Protein', ..., 'path_standard', 'path_solvent', 'dndc',
+%         'dndc_set', optional 'filegroup_index', 'start_index', 'end_index',
+%         'number_of_counts', 'Channels')
+% output: the samples and the data of the shared parse
+ a	= Args(varargin{:});
+ inst	= Instruments.(a.Instrument);
+ names	= properties(a);
+ group	= 1;
+ if any(strcmp('filegroup_index', names))
+  group	= a.filegroup_index;
+ end
+ if all( ismember( { 'start_index', 'end_index', 'number_of_counts' }, names ) )
+  s	= a.start_index;
+  e	= a.end_index;
+  nc	= a.number_of_counts;
+ else
+  [ s e nc ]	= inst.find_start_end( a.Path );
+  s	= s(group);
+  e	= e(group);
+  nc	= nc(group);
+ end
+
+ files	= cell( 1, ( e - s + 1 ) * nc );
+ k	= 0;
+ for i = s : e
+  for j = 1 : nc
+   k		= k + 1;
+   files{k}	= inst.generate_filename( a.Path, i, j );
+  end
+ end
+ channels	= 1;
+ if any(strcmp('Channels', names))
+  channels	= a.Channels;
+ end
+ data	= inst.read_autosave_series( files, channels );
+
+ % same series for both samples, no second lookup of the files
+ drop	= ismember( varargin(1:2:end), { 'start_index', 'end_index', 'number_of_counts', 'Autosave' } );
+ drop	= reshape( [ drop; drop ], 1, [] );
+ args	= [ varargin(~drop) { 'start_index', s, 'end_index', e, 'number_of_counts', nc, 'Autosave', data } ];
+ dls	= DLS.Sample( args{:} );
+ sls	= SLS.Sample( args{:} );
+end
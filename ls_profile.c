@@ -0,0 +1,152 @@
+/*
+ * =====================================================================================
+ *
+ *       Filename:  ls_profile.c
+ *
+ *    Description:  MEX interface of the counters and spans of libls (libls/trace.h):
+ *                  switch tracing on and off, read the summary per engine and write
+ *                  the spans as Chrome trace (chrome://tracing, ui.perfetto.dev).
+ *                  Shares the state of all MEX files through libls.so.
+ *
+ *        Version:  1.0
+ *        Created:  19.10.2026
+ *       Revision:  none
+ *       Compiler:  gcc
+ *
+ * =====================================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/* check if calling from matlab and include necessary mex.h*/
+#ifdef MATLAB_MEX_FILE
+#include "libls/ls_mex.h"
+
+static const char *ls_fields[] =
+{
+    "engine", "calls", "items", "bytes", "spans", "seconds", "mean_us", "max_us"
+};
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  ls_summary
+ *  Description:  struct array with one entry per engine that was called or traced
+ * =====================================================================================
+ */
+static mxArray *ls_summary(void)
+{
+    ls_counter    c[LS_N_ENGINES];
+    ls_span_total s[LS_N_ENGINES];
+    mxArray *out;
+    int k, n = 0;
+
+    ls_counters(c);
+    ls_trace_totals(s);
+    for (k = 0; k < LS_N_ENGINES; k++)
+        n += c[k].calls > 0 || s[k].spans > 0;
+    out = mxCreateStructMatrix(n, 1, sizeof(ls_fields) / sizeof(ls_fields[0]), ls_fields);
+    for (k = 0, n = 0; k < LS_N_ENGINES; k++)
+    {
+        if (c[k].calls == 0 && s[k].spans == 0)
+            continue;
+        mxSetField(out, n, "engine",  mxCreateString(ls_engine_name(k)));
+        mxSetField(out, n, "calls",   mxCreateDoubleScalar((double) c[k].calls));
+        mxSetField(out, n, "items",   mxCreateDoubleScalar((double) c[k].items));
+        mxSetField(out, n, "bytes",   mxCreateDoubleScalar((double) c[k].bytes));
+        mxSetField(out, n, "spans",   mxCreateDoubleScalar((double) s[k].spans));
+        mxSetField(out, n, "seconds", mxCreateDoubleScalar(s[k].seconds));
+        mxSetField(out, n, "mean_us", mxCreateDoubleScalar(s[k].spans > 0 ? 1e6 * s[k].seconds / s[k].spans : NAN));
+        mxSetField(out, n, "max_us",  mxCreateDoubleScalar(s[k].spans > 0 ? 1e6 * s[k].max : NAN));
+        n++;
+    }
+    return out;
+}
+
+/*  table of the summary in the command window */
+static void ls_print(void)
+{
+    ls_counter    c[LS_N_ENGINES];
+    ls_span_total s[LS_N_ENGINES];
+    int k;
+
+    ls_counters(c);
+    ls_trace_totals(s);
+    mexPrintf("libls %s, tracing %s\n", ls_version(), ls_trace_on ? "on" : "off");
+    mexPrintf("%-10s %10s %12s %14s %10s %12s %12s %12s\n", "engine", "calls", "items", "bytes",
+            "spans", "seconds", "mean [us]", "max [us]");
+    for (k = 0; k < LS_N_ENGINES; k++)
+    {
+        if (c[k].calls == 0 && s[k].spans == 0)
+            continue;
+        mexPrintf("%-10s %10lld %12lld %14lld %10lld %12.6f %12.1f %12.1f\n", ls_engine_name(k),
+                c[k].calls, c[k].items, c[k].bytes, s[k].spans, s[k].seconds,
+                s[k].spans > 0 ? 1e6 * s[k].seconds / s[k].spans : 0, 1e6 * s[k].max);
+    }
+    if (ls_trace_dropped() > 0)
+        mexPrintf("%lld spans dropped\n", ls_trace_dropped());
+}
+
+/*
+ * ===  FUNCTION  ======================================================================
+ *         Name:  mexFunction
+ *  Description:  comunicate between matlab and c program
+ *
+ *  ls_profile                   print the summary
+ *  ls_profile('on')             record the spans of the engines from now on
+ *  ls_profile('off')            stop recording (counters are always on)
+ *  ls_profile('reset')          clear spans and counters
+ *  s = ls_profile('summary')    struct array: engine, calls, items, bytes, spans,
+ *                               seconds, mean_us, max_us (one entry per used engine)
+ *  s = ls_profile('dump', file) write the spans to file (Chrome trace JSON) and
+ *                               return the summary
+ * =====================================================================================
+ */
+void mexFunction(int nlhs,
+        mxArray *plhs[],
+        int nrhs,
+        const mxArray *prhs[])
+{
+    char *cmd, *path;
+    FILE *fp;
+    int n;
+
+    if (nrhs < 1)
+    {
+        if (nlhs > 0)
+            plhs[0] = ls_summary();
+        else
+            ls_print();
+        return;
+    }
+    if (!(cmd = mxArrayToString(prhs[0])))
+        mexErrMsgTxt("usage: ls_profile('on' | 'off' | 'reset' | 'summary' | 'dump', file)");
+
+    if (strcmp(cmd, "on") == 0 || strcmp(cmd, "off") == 0)
+        ls_trace_enable(cmd[1] == 'n');
+    else if (strcmp(cmd, "reset") == 0)
+    {
+        ls_trace_reset();
+        ls_counters_reset();
+    }
+    else if (strcmp(cmd, "summary") == 0)
+        plhs[0] = ls_summary();
+    else if (strcmp(cmd, "dump") == 0)
+    {
+        if (nrhs < 2 || !(path = mxArrayToString(prhs[1])))
+            mexErrMsgTxt("usage: s = ls_profile('dump', file)");
+        if (!(fp = fopen(path, "w")))
+            mexErrMsgIdAndTxt("ls_profile:open", "cannot write %s", path);
+        n = ls_trace_write_chrome(fp);
+        if (fclose(fp) != 0 || n < 0)
+            mexErrMsgIdAndTxt("ls_profile:write", "cannot write %s", path);
+        mxFree(path);
+        plhs[0] = ls_summary();
+    }
+    else
+        mexErrMsgIdAndTxt("ls_profile:command", "unknown command '%s'", cmd);
+    mxFree(cmd);
+}				/* ----------  end of function mexFunction  ---------- */
+#endif
@@ -1,5 +1,6 @@
 function [ xr yr dyr ] = reduce ( x, y, dy )
 % average the values of y according to x
+% (for log-spaced bins of correlograms see DLS.concat_points / rebin_fast)
 
  if nargin < 3
   dy = ones(1,length(y));
@@ -10,17 +11,11 @@ function [ xr yr dyr ] = reduce ( x, y, dy )
  dy	= dy(:);
 
  w	= 1 ./ dy.^2;
- xr	= unique(x);
- lr	= length(xr);
+ [ xr tmp j ]	= unique(x);
 
- f	= @(x,w)(sum(x.*w) / sum(w)); 
-
- for i = 1 : lr
-  ind	= ( x == xr(i) );
-
-  yr(i)		= f( y(ind),	w(ind) );
-  dyr(i)	= f( dy(ind),	w(ind) );
-
- end
+ % weighted means of all groups at once
+ sw	= accumarray( j(:), w );
+ yr	= ( accumarray( j(:), w .* y  ) ./ sw )';
+ dyr	= ( accumarray( j(:), w .* dy ) ./ sw )';
  
 end